@@ -0,0 +1,62 @@
+# Copyright 2026 The Draco Authors
+#
+# Licensed under the Apache License, Version 2.0 (the "License"); you may not
+# use this file except in compliance with the License. You may obtain a copy of
+# the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+# WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. See the
+# License for the specific language governing permissions and limitations under
+# the License.
+
+if(DRACO_CMAKE_DRACO_BENCHMARKS_CMAKE)
+  return()
+endif()
+set(DRACO_CMAKE_DRACO_BENCHMARKS_CMAKE 1)
+
+list(APPEND draco_benchmark_common_sources
+            "${draco_src_root}/core/draco_benchmark_utils.cc"
+            "${draco_src_root}/core/draco_benchmark_utils.h")
+
+list(
+  APPEND
+    draco_benchmark_sources
+    "${draco_src_root}/attributes/attribute_transform_kernels_benchmark.cc"
+    "${draco_src_root}/compression/decode_benchmark.cc"
+    "${draco_src_root}/compression/encode_benchmark.cc"
+    "${draco_src_root}/compression/entropy/symbol_coding_benchmark.cc"
+    "${draco_src_root}/compression/mesh/mesh_edgebreaker_decoder_benchmark.cc"
+    "${draco_src_root}/compression/point_cloud/point_cloud_kd_tree_benchmark.cc"
+    "${draco_src_root}/core/buffer_bit_coding_benchmark.cc"
+    "${draco_src_root}/mesh/corner_table_benchmark.cc"
+)
+
+if(DRACO_TRANSCODER_SUPPORTED)
+  list(APPEND draco_benchmark_sources
+              "${draco_src_root}/scene/scene_utils_benchmark.cc")
+endif()
+
+macro(draco_setup_benchmark_targets)
+  if(DRACO_BENCHMARKS)
+    draco_setup_benchmark()
+
+    # The benchmarks read their inputs from testdata/ through the same
+    # configuration header that is used by draco_tests.
+    set(DRACO_TEST_DATA_DIR "${draco_root}/testdata")
+    set(DRACO_TEST_TEMP_DIR "${draco_build}/draco_test_temp")
+    set(DRACO_TEST_ROOT_DIR "${draco_root}")
+    configure_file("${draco_root}/cmake/draco_test_config.h.cmake"
+                   "${draco_build}/testing/draco_test_config.h")
+
+    draco_add_executable(
+      NAME draco_benchmarks
+      SOURCES ${draco_benchmark_common_sources} ${draco_benchmark_sources}
+              ${draco_io_sources}
+      DEFINES ${draco_defines}
+      INCLUDES ${draco_include_paths}
+      LIB_DEPS ${draco_dependency} ${draco_benchmark_lib})
+  endif()
+endmacro()
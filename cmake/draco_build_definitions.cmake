@@ -76,6 +76,15 @@ macro(draco_set_build_definitions)
 
   endif()
 
+  if(NOT EMSCRIPTEN)
+    # draco::ThreadPool is implemented using std::thread.
+    set(THREADS_PREFER_PTHREAD_FLAG ON)
+    find_package(Threads)
+    if(CMAKE_THREAD_LIBS_INIT)
+      list(APPEND draco_lib_deps ${CMAKE_THREAD_LIBS_INIT})
+    endif()
+  endif()
+
 
   list(APPEND draco_defines "DRACO_CMAKE=1"
               "DRACO_FLAGS_SRCDIR=\"${draco_root}\""
@@ -132,6 +141,8 @@ macro(draco_set_build_definitions)
     endif()
   endif()
 
+  draco_optimization_detect()
+
   # Source file names ending in these suffixes will have the appropriate
   # compiler flags added to their compile commands to enable intrinsics.
   set(draco_neon_source_file_suffix "neon.cc")
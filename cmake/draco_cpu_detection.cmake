@@ -19,7 +19,7 @@ set(DRACO_CMAKE_DRACO_CPU_DETECTION_CMAKE_ 1)
 
 # Detect optimizations available for the current target CPU.
 macro(draco_optimization_detect)
-  if(DRACO_ENABLE_OPTIMIZATIONS)
+  if(DRACO_ENABLE_OPTIMIZATIONS AND NOT EMSCRIPTEN)
     string(TOLOWER "${CMAKE_SYSTEM_PROCESSOR}" cpu_lowercase)
     if(cpu_lowercase MATCHES "^arm|^aarch64")
       set(draco_have_neon ON)
@@ -29,6 +29,12 @@ include("${draco_root}/cmake/draco_variables.cmake")
 set(DRACO_EIGEN_PATH)
 draco_track_configuration_variable(DRACO_EIGEN_PATH)
 
+# Path to the google/benchmark installation. The path must be to the root of the
+# benchmark project directory. When empty an installed copy of the library is
+# located via find_package().
+set(DRACO_BENCHMARK_PATH)
+draco_track_configuration_variable(DRACO_BENCHMARK_PATH)
+
 # Path to the gulrak/filesystem installation. The path specified must contain
 # the ghc subdirectory that houses the filesystem includes.
 set(DRACO_FILESYSTEM_PATH)
@@ -114,6 +120,28 @@ macro(draco_setup_googletest)
   list(APPEND draco_gtest_main "${gtest_path}/googletest/src/gtest_main.cc")
 endmacro()
 
+# Determines the google/benchmark location and sets $draco_benchmark_lib to the
+# targets that must be linked by the draco_benchmarks build.
+macro(draco_setup_benchmark)
+  if(DRACO_BENCHMARK_PATH)
+    if(NOT IS_DIRECTORY "${DRACO_BENCHMARK_PATH}")
+      message(FATAL_ERROR "DRACO_BENCHMARK_PATH does not exist.")
+    endif()
+
+    set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+    set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+    add_subdirectory("${DRACO_BENCHMARK_PATH}"
+                     "${draco_build}/third_party/benchmark" EXCLUDE_FROM_ALL)
+  else()
+    find_package(benchmark QUIET)
+    if(NOT benchmark_FOUND)
+      message(FATAL_ERROR "google/benchmark missing, install it or set "
+                          "DRACO_BENCHMARK_PATH.")
+    endif()
+  endif()
+
+  set(draco_benchmark_lib benchmark::benchmark benchmark::benchmark_main)
+endmacro()
 
 # Determines the location of TinyGLTF and updates the build configuration
 # accordingly.
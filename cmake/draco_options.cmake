@@ -103,6 +103,10 @@ macro(draco_set_default_options)
     NAME DRACO_TESTS
     HELPSTRING "Enables tests."
     VALUE OFF)
+  draco_option(
+    NAME DRACO_BENCHMARKS
+    HELPSTRING "Enables benchmarks."
+    VALUE OFF)
   draco_option(
     NAME DRACO_WASM
     HELPSTRING "Enables WASM support."
@@ -127,6 +131,18 @@ macro(draco_set_default_options)
     NAME DRACO_TRANSCODER_SUPPORTED
     HELPSTRING "Enable the Draco transcoder."
     VALUE OFF)
+  draco_option(
+    NAME DRACO_ENABLE_OPTIMIZATIONS
+    HELPSTRING "Enable SIMD optimizations for the target CPU."
+    VALUE ON)
+  draco_option(
+    NAME DRACO_ENABLE_SSE4_1
+    HELPSTRING "Enable SSE4.1 optimizations."
+    VALUE ON)
+  draco_option(
+    NAME DRACO_ENABLE_NEON
+    HELPSTRING "Enable NEON optimizations."
+    VALUE ON)
   draco_option(
     NAME DRACO_DEBUG_COMPILER_WARNINGS
     HELPSTRING "Turn on more warnings."
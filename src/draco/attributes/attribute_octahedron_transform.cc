@@ -15,6 +15,7 @@
 
 #include "draco/attributes/attribute_octahedron_transform.h"
 
+#include "draco/attributes/attribute_transform_kernels.h"
 #include "draco/attributes/attribute_transform_type.h"
 #include "draco/compression/attributes/normal_compression_utils.h"
 
@@ -56,25 +57,24 @@ bool AttributeOctahedronTransform::InverseTransformAttribute(
   if (num_components != 3) {
     return false;
   }
-  constexpr int kEntrySize = sizeof(float) * 3;
-  float att_val[3];
-  const int32_t *source_attribute_data = reinterpret_cast<const int32_t *>(
-      attribute.GetAddress(AttributeValueIndex(0)));
-  uint8_t *target_address =
-      target_attribute->GetAddress(AttributeValueIndex(0));
+  if (attribute.buffer()->data_size() <
+          sizeof(int32_t) * 2 * static_cast<size_t>(num_points) ||
+      target_attribute->buffer()->data_size() <
+          sizeof(float) * 3 * static_cast<size_t>(num_points)) {
+    return false;
+  }
+  const int32_t *const source_attribute_data =
+      reinterpret_cast<const int32_t *>(
+          attribute.GetAddress(AttributeValueIndex(0)));
+  float *const target_attribute_data = reinterpret_cast<float *>(
+      target_attribute->GetAddress(AttributeValueIndex(0)));
   OctahedronToolBox octahedron_tool_box;
   if (!octahedron_tool_box.SetQuantizationBits(quantization_bits_)) {
     return false;
   }
-  for (uint32_t i = 0; i < num_points; ++i) {
-    const int32_t s = *source_attribute_data++;
-    const int32_t t = *source_attribute_data++;
-    octahedron_tool_box.QuantizedOctahedralCoordsToUnitVector(s, t, att_val);
-
-    // Store the decoded floating point values into the attribute buffer.
-    std::memcpy(target_address, att_val, kEntrySize);
-    target_address += kEntrySize;
-  }
+  QuantizedOctahedralCoordsToUnitVectors(octahedron_tool_box,
+                                         source_attribute_data, num_points,
+                                         target_attribute_data);
   return true;
 }
 
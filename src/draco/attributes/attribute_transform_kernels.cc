@@ -0,0 +1,97 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_transform_kernels.h"
+
+#if DRACO_ENABLE_SSE4_1 && defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace draco {
+
+namespace {
+
+#if DRACO_ENABLE_SSE4_1
+// Returns true when the CPU supports SSE4.1 instructions.
+bool CpuHasSse4() {
+#if defined(_MSC_VER)
+  int cpu_info[4];
+  __cpuid(cpu_info, 1);
+  return (cpu_info[2] & (1 << 19)) != 0;
+#else
+  return __builtin_cpu_supports("sse4.1");
+#endif
+}
+
+bool UseSse4() {
+  static const bool use_sse4 = CpuHasSse4();
+  return use_sse4;
+}
+#endif
+
+}  // namespace
+
+void DequantizeFloatValues(const int32_t *quantized_values, int num_entries,
+                           int num_components, float delta,
+                           const float *min_values, float *out_values) {
+  int num_processed_entries = 0;
+#if DRACO_ENABLE_SSE4_1
+  if (UseSse4()) {
+    num_processed_entries =
+        DequantizeFloatValuesSse4(quantized_values, num_entries, num_components,
+                                  delta, min_values, out_values);
+  }
+#elif DRACO_ENABLE_NEON && defined(__aarch64__)
+  num_processed_entries =
+      DequantizeFloatValuesNeon(quantized_values, num_entries, num_components,
+                                delta, min_values, out_values);
+#endif
+  const int64_t num_values =
+      static_cast<int64_t>(num_entries) * num_components;
+  int c = 0;
+  for (int64_t i = static_cast<int64_t>(num_processed_entries) * num_components;
+       i < num_values; ++i) {
+    out_values[i] = static_cast<float>(quantized_values[i]) * delta +
+                    min_values[c];
+    if (++c == num_components) {
+      c = 0;
+    }
+  }
+}
+
+void QuantizedOctahedralCoordsToUnitVectors(const OctahedronToolBox &tool_box,
+                                            const int32_t *coords,
+                                            int num_entries,
+                                            float *out_vectors) {
+  int num_processed_entries = 0;
+#if DRACO_ENABLE_SSE4_1
+  if (UseSse4()) {
+    num_processed_entries = QuantizedOctahedralCoordsToUnitVectorsSse4(
+        tool_box.dequantization_scale(), coords, num_entries, out_vectors);
+  }
+#elif DRACO_ENABLE_NEON && defined(__aarch64__)
+  num_processed_entries = QuantizedOctahedralCoordsToUnitVectorsNeon(
+      tool_box.dequantization_scale(), coords, num_entries, out_vectors);
+#endif
+  coords += 2 * static_cast<int64_t>(num_processed_entries);
+  out_vectors += 3 * static_cast<int64_t>(num_processed_entries);
+  for (int i = num_processed_entries; i < num_entries; ++i) {
+    tool_box.QuantizedOctahedralCoordsToUnitVector(coords[0], coords[1],
+                                                   out_vectors);
+    coords += 2;
+    out_vectors += 3;
+  }
+}
+
+}  // namespace draco
@@ -0,0 +1,80 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_ATTRIBUTES_ATTRIBUTE_TRANSFORM_KERNELS_H_
+#define DRACO_ATTRIBUTES_ATTRIBUTE_TRANSFORM_KERNELS_H_
+
+#include <cstdint>
+
+#include "draco/compression/attributes/normal_compression_utils.h"
+
+namespace draco {
+
+// Kernels that revert attribute transforms of whole attribute buffers in a
+// single pass. The functions use SIMD instructions when they are available on
+// the target CPU. The SIMD code performs the same single precision operations
+// in the same order as the per-value scalar functions of Dequantizer and
+// OctahedronToolBox and it never uses fused multiply-add instructions. The
+// results are therefore bit-exact with the scalar functions unless the
+// compiler contracts the scalar multiply-adds into FMA instructions (e.g.,
+// -ffp-contract=fast on targets with FMA such as AArch64), in which case the
+// results may differ in the last bits.
+
+// Dequantizes |num_entries| entries with |num_components| components each
+// stored in |quantized_values| and writes the results into |out_values|:
+//
+//   out_values[i] = quantized_values[i] * |delta| + min_values[i % c]
+//
+// where c is |num_components|. |delta| is the distance between two quantized
+// values (see Dequantizer).
+void DequantizeFloatValues(const int32_t *quantized_values, int num_entries,
+                           int num_components, float delta,
+                           const float *min_values, float *out_values);
+
+// Converts |num_entries| quantized octahedral coordinates stored as (s, t)
+// pairs in |coords| into unit vectors stored as (x, y, z) triplets in
+// |out_vectors|. |tool_box| must be initialized with the quantization bits of
+// the coordinates.
+void QuantizedOctahedralCoordsToUnitVectors(const OctahedronToolBox &tool_box,
+                                            const int32_t *coords,
+                                            int num_entries,
+                                            float *out_vectors);
+
+// Instruction set specific versions of the above kernels. They process a
+// prefix of the input and return the number of processed entries. The
+// remaining entries are processed by the generic code.
+#if DRACO_ENABLE_SSE4_1
+int DequantizeFloatValuesSse4(const int32_t *quantized_values,
+                              int num_entries, int num_components,
+                              float delta, const float *min_values,
+                              float *out_values);
+int QuantizedOctahedralCoordsToUnitVectorsSse4(float dequantization_scale,
+                                               const int32_t *coords,
+                                               int num_entries,
+                                               float *out_vectors);
+#endif
+#if DRACO_ENABLE_NEON && defined(__aarch64__)
+int DequantizeFloatValuesNeon(const int32_t *quantized_values,
+                              int num_entries, int num_components,
+                              float delta, const float *min_values,
+                              float *out_values);
+int QuantizedOctahedralCoordsToUnitVectorsNeon(float dequantization_scale,
+                                               const int32_t *coords,
+                                               int num_entries,
+                                               float *out_vectors);
+#endif
+
+}  // namespace draco
+
+#endif  // DRACO_ATTRIBUTES_ATTRIBUTE_TRANSFORM_KERNELS_H_
@@ -0,0 +1,86 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "draco/attributes/attribute_transform_kernels.h"
+#include "draco/core/quantization_utils.h"
+
+namespace draco {
+namespace {
+
+constexpr int kNumEntries = 1 << 16;
+
+// Dequantizes 3-component values with the per-value Dequantizer (mode 0) or
+// with the DequantizeFloatValues() kernel (mode 1).
+void BM_DequantizeFloatValues(benchmark::State &state) {
+  const int num_components = 3;
+  const float min_values[3] = {-1.f, -2.f, -3.f};
+  std::vector<int32_t> quantized_values(kNumEntries * num_components);
+  for (int i = 0; i < static_cast<int>(quantized_values.size()); ++i) {
+    quantized_values[i] = (i * 337) % 16384;
+  }
+  std::vector<float> values(quantized_values.size());
+  Dequantizer dequantizer;
+  dequantizer.Init(10.f, (1 << 14) - 1);
+  for (auto _ : state) {
+    if (state.range(0) == 0) {
+      for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+        values[i] = dequantizer.DequantizeFloat(quantized_values[i]) +
+                    min_values[i % num_components];
+      }
+    } else {
+      DequantizeFloatValues(quantized_values.data(), kNumEntries,
+                            num_components, dequantizer.DequantizeFloat(1),
+                            min_values, values.data());
+    }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kNumEntries);
+}
+BENCHMARK(BM_DequantizeFloatValues)->DenseRange(0, 1)->ArgName("mode");
+
+// Decodes octahedral normals with the per-value OctahedronToolBox (mode 0) or
+// with the QuantizedOctahedralCoordsToUnitVectors() kernel (mode 1).
+void BM_QuantizedOctahedralCoordsToUnitVectors(benchmark::State &state) {
+  OctahedronToolBox tool_box;
+  tool_box.SetQuantizationBits(10);
+  std::vector<int32_t> coords(2 * kNumEntries);
+  for (int i = 0; i < static_cast<int>(coords.size()); ++i) {
+    coords[i] = (i * 337) % (tool_box.max_value() + 1);
+  }
+  std::vector<float> vectors(3 * kNumEntries);
+  for (auto _ : state) {
+    if (state.range(0) == 0) {
+      for (int i = 0; i < kNumEntries; ++i) {
+        tool_box.QuantizedOctahedralCoordsToUnitVector(
+            coords[2 * i], coords[2 * i + 1], &vectors[3 * i]);
+      }
+    } else {
+      QuantizedOctahedralCoordsToUnitVectors(tool_box, coords.data(),
+                                             kNumEntries, vectors.data());
+    }
+    benchmark::DoNotOptimize(vectors.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * kNumEntries);
+}
+BENCHMARK(BM_QuantizedOctahedralCoordsToUnitVectors)
+    ->DenseRange(0, 1)
+    ->ArgName("mode");
+
+}  // namespace
+}  // namespace draco
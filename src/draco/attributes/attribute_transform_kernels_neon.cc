@@ -0,0 +1,97 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_transform_kernels.h"
+
+#if DRACO_ENABLE_NEON && defined(__aarch64__)
+
+#include <arm_neon.h>
+
+namespace draco {
+
+int DequantizeFloatValuesNeon(const int32_t *quantized_values,
+                              int num_entries, int num_components,
+                              float delta, const float *min_values,
+                              float *out_values) {
+  if (num_components < 1 || num_components > 4) {
+    return 0;
+  }
+  // See DequantizeFloatValuesSse4().
+  float min_pattern[16];
+  for (int i = 0; i < 4 * num_components; ++i) {
+    min_pattern[i] = min_values[i % num_components];
+  }
+  float32x4_t min_regs[4];
+  for (int r = 0; r < num_components; ++r) {
+    min_regs[r] = vld1q_f32(min_pattern + 4 * r);
+  }
+  const float32x4_t delta_reg = vdupq_n_f32(delta);
+  const int num_groups = num_entries / 4;
+  for (int g = 0; g < num_groups; ++g) {
+    for (int r = 0; r < num_components; ++r) {
+      const float32x4_t values = vcvtq_f32_s32(vld1q_s32(quantized_values));
+      vst1q_f32(out_values,
+                vaddq_f32(vmulq_f32(values, delta_reg), min_regs[r]));
+      quantized_values += 4;
+      out_values += 4;
+    }
+  }
+  return 4 * num_groups;
+}
+
+int QuantizedOctahedralCoordsToUnitVectorsNeon(float dequantization_scale,
+                                               const int32_t *coords,
+                                               int num_entries,
+                                               float *out_vectors) {
+  const int num_groups = num_entries / 4;
+  const float32x4_t scale = vdupq_n_f32(dequantization_scale);
+  const float32x4_t one = vdupq_n_f32(1.f);
+  const float32x4_t zero = vdupq_n_f32(0.f);
+  // See QuantizedOctahedralCoordsToUnitVectorsSse4().
+  const float32x4_t min_norm_squared = vdupq_n_f32(1e-6f);
+  for (int g = 0; g < num_groups; ++g) {
+    const int32x4x2_t st = vld2q_s32(coords);
+    coords += 8;
+    float32x4_t y =
+        vsubq_f32(vmulq_f32(vcvtq_f32_s32(st.val[0]), scale), one);
+    float32x4_t z =
+        vsubq_f32(vmulq_f32(vcvtq_f32_s32(st.val[1]), scale), one);
+
+    // Same computation as in OctahedronToolBox::OctahedralCoordsToUnitVector()
+    // for four vectors at once.
+    const float32x4_t x =
+        vsubq_f32(vsubq_f32(one, vabsq_f32(y)), vabsq_f32(z));
+    float32x4_t x_offset = vnegq_f32(x);
+    x_offset = vbslq_f32(vcltq_f32(x_offset, zero), zero, x_offset);
+    const float32x4_t neg_x_offset = vnegq_f32(x_offset);
+    y = vaddq_f32(y, vbslq_f32(vcltq_f32(y, zero), x_offset, neg_x_offset));
+    z = vaddq_f32(z, vbslq_f32(vcltq_f32(z, zero), x_offset, neg_x_offset));
+
+    const float32x4_t norm_squared = vaddq_f32(
+        vaddq_f32(vmulq_f32(x, x), vmulq_f32(y, y)), vmulq_f32(z, z));
+    const uint32x4_t is_zero = vcleq_f32(norm_squared, min_norm_squared);
+    const float32x4_t d = vdivq_f32(one, vsqrtq_f32(norm_squared));
+    float32x4x3_t out;
+    out.val[0] = vbslq_f32(is_zero, zero, vmulq_f32(x, d));
+    out.val[1] = vbslq_f32(is_zero, zero, vmulq_f32(y, d));
+    out.val[2] = vbslq_f32(is_zero, zero, vmulq_f32(z, d));
+    vst3q_f32(out_vectors, out);
+    out_vectors += 12;
+  }
+  return 4 * num_groups;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_NEON && defined(__aarch64__)
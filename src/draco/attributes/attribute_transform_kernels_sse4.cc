@@ -0,0 +1,121 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_transform_kernels.h"
+
+#if DRACO_ENABLE_SSE4_1
+
+#include <smmintrin.h>
+
+namespace draco {
+
+int DequantizeFloatValuesSse4(const int32_t *quantized_values,
+                              int num_entries, int num_components,
+                              float delta, const float *min_values,
+                              float *out_values) {
+  if (num_components < 1 || num_components > 4) {
+    return 0;
+  }
+  // Groups of four entries are processed at once. Their values fill exactly
+  // |num_components| registers and each register uses a different pattern of
+  // the minimum values.
+  float min_pattern[16];
+  for (int i = 0; i < 4 * num_components; ++i) {
+    min_pattern[i] = min_values[i % num_components];
+  }
+  __m128 min_regs[4];
+  for (int r = 0; r < num_components; ++r) {
+    min_regs[r] = _mm_loadu_ps(min_pattern + 4 * r);
+  }
+  const __m128 delta_reg = _mm_set1_ps(delta);
+  const int num_groups = num_entries / 4;
+  for (int g = 0; g < num_groups; ++g) {
+    for (int r = 0; r < num_components; ++r) {
+      const __m128 values = _mm_cvtepi32_ps(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(quantized_values)));
+      _mm_storeu_ps(out_values,
+                    _mm_add_ps(_mm_mul_ps(values, delta_reg), min_regs[r]));
+      quantized_values += 4;
+      out_values += 4;
+    }
+  }
+  return 4 * num_groups;
+}
+
+int QuantizedOctahedralCoordsToUnitVectorsSse4(float dequantization_scale,
+                                               const int32_t *coords,
+                                               int num_entries,
+                                               float *out_vectors) {
+  // Each output vector is stored with a four float write that overwrites the
+  // first value of the next vector. The last group of entries is therefore
+  // left to the generic code so that we never write past the output.
+  const int num_groups = num_entries > 0 ? (num_entries - 1) / 4 : 0;
+  const __m128 scale = _mm_set1_ps(dequantization_scale);
+  const __m128 one = _mm_set1_ps(1.f);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 sign_mask = _mm_set1_ps(-0.f);
+  // OctahedronToolBox compares the squared norm with 1e-6 in double precision
+  // which is equivalent to (norm <= 1e-6f) in single precision.
+  const __m128 min_norm_squared = _mm_set1_ps(1e-6f);
+  for (int g = 0; g < num_groups; ++g) {
+    // Load the (s, t) coordinates of four entries and split them into the
+    // (y, z) components scaled to the <-1, 1> range.
+    const __m128 st01 = _mm_cvtepi32_ps(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(coords)));
+    const __m128 st23 = _mm_cvtepi32_ps(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(coords + 4)));
+    coords += 8;
+    __m128 y = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(st01, st23, _MM_SHUFFLE(2, 0, 2, 0)), scale),
+        one);
+    __m128 z = _mm_sub_ps(
+        _mm_mul_ps(_mm_shuffle_ps(st01, st23, _MM_SHUFFLE(3, 1, 3, 1)), scale),
+        one);
+
+    // Same computation as in OctahedronToolBox::OctahedralCoordsToUnitVector()
+    // for four vectors at once.
+    __m128 x = _mm_sub_ps(_mm_sub_ps(one, _mm_andnot_ps(sign_mask, y)),
+                          _mm_andnot_ps(sign_mask, z));
+    __m128 x_offset = _mm_xor_ps(x, sign_mask);
+    x_offset = _mm_andnot_ps(_mm_cmplt_ps(x_offset, zero), x_offset);
+    const __m128 neg_x_offset = _mm_xor_ps(x_offset, sign_mask);
+    y = _mm_add_ps(
+        y, _mm_blendv_ps(neg_x_offset, x_offset, _mm_cmplt_ps(y, zero)));
+    z = _mm_add_ps(
+        z, _mm_blendv_ps(neg_x_offset, x_offset, _mm_cmplt_ps(z, zero)));
+
+    const __m128 norm_squared =
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+                   _mm_mul_ps(z, z));
+    const __m128 is_zero = _mm_cmple_ps(norm_squared, min_norm_squared);
+    const __m128 d = _mm_div_ps(one, _mm_sqrt_ps(norm_squared));
+    x = _mm_andnot_ps(is_zero, _mm_mul_ps(x, d));
+    y = _mm_andnot_ps(is_zero, _mm_mul_ps(y, d));
+    z = _mm_andnot_ps(is_zero, _mm_mul_ps(z, d));
+
+    // Interleave the components and store the four vectors.
+    __m128 w = zero;
+    _MM_TRANSPOSE4_PS(x, y, z, w);
+    _mm_storeu_ps(out_vectors, x);
+    _mm_storeu_ps(out_vectors + 3, y);
+    _mm_storeu_ps(out_vectors + 6, z);
+    _mm_storeu_ps(out_vectors + 9, w);
+    out_vectors += 12;
+  }
+  return 4 * num_groups;
+}
+
+}  // namespace draco
+
+#endif  // DRACO_ENABLE_SSE4_1
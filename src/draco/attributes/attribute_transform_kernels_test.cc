@@ -0,0 +1,94 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/attributes/attribute_transform_kernels.h"
+
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/quantization_utils.h"
+
+namespace {
+
+// Asserts that a kernel result matches the result of the scalar code. The
+// results are bit-exact unless the compiler can contract the scalar
+// multiply-adds into FMA instructions (see attribute_transform_kernels.h).
+void AssertSameFloat(float value, float expected_value) {
+#ifdef __FP_FAST_FMAF
+  ASSERT_FLOAT_EQ(value, expected_value);
+#else
+  ASSERT_EQ(value, expected_value);
+#endif
+}
+
+TEST(AttributeTransformKernelsTest, TestDequantizeFloatValues) {
+  // The kernel must match the scalar Dequantizer for all supported numbers of
+  // components and for inputs that do not fill complete SIMD registers.
+  const float min_values[5] = {-1.5f, 0.25f, 3.f, -7.f, 100.f};
+  draco::Dequantizer dequantizer;
+  ASSERT_TRUE(dequantizer.Init(10.f, (1 << 11) - 1));
+  const float delta = dequantizer.DequantizeFloat(1);
+  for (int num_components = 1; num_components <= 5; ++num_components) {
+    for (int num_entries = 0; num_entries <= 13; ++num_entries) {
+      const int num_values = num_entries * num_components;
+      std::vector<int32_t> quantized_values(num_values);
+      for (int i = 0; i < num_values; ++i) {
+        quantized_values[i] = (i * 337) % 2048;
+      }
+      std::vector<float> values(num_values);
+      draco::DequantizeFloatValues(quantized_values.data(), num_entries,
+                                   num_components, delta, min_values,
+                                   values.data());
+      for (int i = 0; i < num_values; ++i) {
+        AssertSameFloat(values[i],
+                        dequantizer.DequantizeFloat(quantized_values[i]) +
+                            min_values[i % num_components]);
+      }
+    }
+  }
+}
+
+TEST(AttributeTransformKernelsTest,
+     TestQuantizedOctahedralCoordsToUnitVectors) {
+  // Compare the kernel with the scalar OctahedronToolBox for all coordinates
+  // of a small quantization.
+  draco::OctahedronToolBox tool_box;
+  ASSERT_TRUE(tool_box.SetQuantizationBits(6));
+  std::vector<int32_t> coords;
+  for (int32_t s = 0; s <= tool_box.max_value(); ++s) {
+    for (int32_t t = 0; t <= tool_box.max_value(); ++t) {
+      coords.push_back(s);
+      coords.push_back(t);
+    }
+  }
+  // Test also inputs that do not fill complete SIMD registers.
+  const int num_coords = static_cast<int>(coords.size() / 2);
+  for (int num_entries : {0, 1, 3, 4, 5, 9, num_coords}) {
+    std::vector<float> vectors(3 * num_entries + 1, -2.f);
+    draco::QuantizedOctahedralCoordsToUnitVectors(tool_box, coords.data(),
+                                                  num_entries, vectors.data());
+    for (int i = 0; i < num_entries; ++i) {
+      float expected_vector[3];
+      tool_box.QuantizedOctahedralCoordsToUnitVector(
+          coords[2 * i], coords[2 * i + 1], expected_vector);
+      for (int c = 0; c < 3; ++c) {
+        AssertSameFloat(vectors[3 * i + c], expected_vector[c]);
+      }
+    }
+    // Nothing must be written past the output vectors.
+    ASSERT_EQ(vectors.back(), -2.f);
+  }
+}
+
+}  // namespace
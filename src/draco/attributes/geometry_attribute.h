@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <limits>
 
 #include "draco/attributes/geometry_indices.h"
@@ -230,6 +231,34 @@ class GeometryAttribute {
     return ConvertValue<OutT>(att_index, num_components_, out_value);
   }
 
+  // Converts |num_values| consecutive attribute entries starting at
+  // |first_att_index| to a specific output format. The converted values are
+  // stored one after another in |out_values| that needs to be able to store
+  // |num_values| * |out_num_components| values. The conversion follows the
+  // same rules as ConvertValue(), but the stored data type is resolved only
+  // once for all entries and tightly packed entries are converted in a single
+  // loop that the compiler can vectorize.
+  // Returns false when the conversion of any entry failed.
+  template <typename OutT>
+  bool ConvertValues(AttributeValueIndex first_att_index, int num_values,
+                     int8_t out_num_components, OutT *out_values) const {
+    return ConvertValuesInternal<OutT>(first_att_index, nullptr, num_values,
+                                       out_num_components, out_values);
+  }
+
+  // Same as above but the converted entries are given by |num_values| indices
+  // stored in |att_indices|.
+  template <typename OutT>
+  bool ConvertValues(const AttributeValueIndex *att_indices, int num_values,
+                     int8_t out_num_components, OutT *out_values) const {
+    if (att_indices == nullptr) {
+      return false;
+    }
+    return ConvertValuesInternal<OutT>(kInvalidAttributeValueIndex,
+                                       att_indices, num_values,
+                                       out_num_components, out_values);
+  }
+
   // Utility function. Returns |attribute_type| as std::string.
   static std::string TypeToString(Type attribute_type) {
     switch (attribute_type) {
@@ -325,6 +354,147 @@ class GeometryAttribute {
     return true;
   }
 
+  // Resolves the stored data type for ConvertValues(). When |att_indices| is
+  // nullptr, entries starting at |first_att_index| are converted.
+  template <typename OutT>
+  bool ConvertValuesInternal(AttributeValueIndex first_att_index,
+                             const AttributeValueIndex *att_indices,
+                             int num_values, int8_t out_num_components,
+                             OutT *out_values) const {
+    if (out_values == nullptr || num_values < 0 || out_num_components < 0) {
+      return false;
+    }
+    switch (data_type_) {
+      case DT_INT8:
+        return ConvertTypedValues<int8_t, OutT>(first_att_index, att_indices,
+                                                num_values, out_num_components,
+                                                out_values);
+      case DT_UINT8:
+        return ConvertTypedValues<uint8_t, OutT>(first_att_index, att_indices,
+                                                 num_values, out_num_components,
+                                                 out_values);
+      case DT_INT16:
+        return ConvertTypedValues<int16_t, OutT>(first_att_index, att_indices,
+                                                 num_values, out_num_components,
+                                                 out_values);
+      case DT_UINT16:
+        return ConvertTypedValues<uint16_t, OutT>(
+            first_att_index, att_indices, num_values, out_num_components,
+            out_values);
+      case DT_INT32:
+        return ConvertTypedValues<int32_t, OutT>(first_att_index, att_indices,
+                                                 num_values, out_num_components,
+                                                 out_values);
+      case DT_UINT32:
+        return ConvertTypedValues<uint32_t, OutT>(
+            first_att_index, att_indices, num_values, out_num_components,
+            out_values);
+      case DT_INT64:
+        return ConvertTypedValues<int64_t, OutT>(first_att_index, att_indices,
+                                                 num_values, out_num_components,
+                                                 out_values);
+      case DT_UINT64:
+        return ConvertTypedValues<uint64_t, OutT>(
+            first_att_index, att_indices, num_values, out_num_components,
+            out_values);
+      case DT_FLOAT32:
+        return ConvertTypedValues<float, OutT>(first_att_index, att_indices,
+                                               num_values, out_num_components,
+                                               out_values);
+      case DT_FLOAT64:
+        return ConvertTypedValues<double, OutT>(first_att_index, att_indices,
+                                                num_values, out_num_components,
+                                                out_values);
+      case DT_BOOL:
+        return ConvertTypedValues<bool, OutT>(first_att_index, att_indices,
+                                              num_values, out_num_components,
+                                              out_values);
+      default:
+        // Wrong attribute type.
+        return false;
+    }
+  }
+
+  // Converts multiple attribute entries given a format of the stored
+  // attribute. See ConvertValuesInternal().
+  template <typename T, typename OutT>
+  bool ConvertTypedValues(AttributeValueIndex first_att_index,
+                          const AttributeValueIndex *att_indices,
+                          int num_values, uint8_t out_num_components,
+                          OutT *out_values) const {
+    if (num_values == 0) {
+      return true;
+    }
+    const int num_components = std::min(num_components_, out_num_components);
+    const int64_t value_size = sizeof(T) * num_components;
+    const int64_t data_size = static_cast<int64_t>(buffer_->data_size());
+    if (att_indices == nullptr && out_num_components == num_components_ &&
+        byte_stride_ == value_size) {
+      // Both input and output entries are tightly packed so all components of
+      // all entries can be converted as a single array.
+      const int64_t begin = GetBytePos(first_att_index);
+      if (begin < 0 || begin + value_size * num_values > data_size) {
+        return false;
+      }
+      return ConvertComponentValues<T, OutT>(
+          reinterpret_cast<const T *>(buffer_->data() + begin),
+          static_cast<int64_t>(num_values) * num_components, normalized_,
+          out_values);
+    }
+    for (int i = 0; i < num_values; ++i) {
+      const AttributeValueIndex avi =
+          att_indices ? att_indices[i] : first_att_index + i;
+      const int64_t begin = GetBytePos(avi);
+      if (begin < 0 || begin + value_size > data_size) {
+        return false;
+      }
+      OutT *const out_value = out_values + i * out_num_components;
+      if (!ConvertComponentValues<T, OutT>(
+              reinterpret_cast<const T *>(buffer_->data() + begin),
+              num_components, normalized_, out_value)) {
+        return false;
+      }
+      // Fill empty data for unused output components if needed.
+      for (int c = num_components; c < out_num_components; ++c) {
+        out_value[c] = static_cast<OutT>(0);
+      }
+    }
+    return true;
+  }
+
+  // Converts |num_values| component values stored in |in_values| using the
+  // same rules as ConvertComponentValue(). Conversions that can not fail are
+  // done in simple loops without any checks.
+  template <typename T, typename OutT>
+  static bool ConvertComponentValues(const T *in_values, int64_t num_values,
+                                     bool normalized, OutT *out_values) {
+    if (std::is_floating_point<OutT>::value) {
+      if (std::is_integral<T>::value && normalized) {
+        const OutT max_value =
+            static_cast<OutT>(std::numeric_limits<T>::max());
+        for (int64_t i = 0; i < num_values; ++i) {
+          out_values[i] = static_cast<OutT>(in_values[i]) / max_value;
+        }
+      } else {
+        for (int64_t i = 0; i < num_values; ++i) {
+          out_values[i] = static_cast<OutT>(in_values[i]);
+        }
+      }
+      return true;
+    }
+    if (std::is_same<T, OutT>::value) {
+      memcpy(out_values, in_values, sizeof(T) * num_values);
+      return true;
+    }
+    for (int64_t i = 0; i < num_values; ++i) {
+      if (!ConvertComponentValue<T, OutT>(in_values[i], normalized,
+                                          out_values + i)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
 #ifdef DRACO_TRANSCODER_SUPPORTED
   // Function that converts input |value| from type T to the internal attribute
   // representation defined by OutT and |num_components_|.
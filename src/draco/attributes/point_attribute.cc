@@ -14,9 +14,13 @@
 //
 #include "draco/attributes/point_attribute.h"
 
-#include <tuple>
-#include <unordered_map>
-using std::unordered_map;
+#include <array>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "draco/core/index_hash_set.h"
+#include "draco/core/thread_pool.h"
 
 // Shortcut for typed conditionals.
 template <bool B, class T, class F>
@@ -63,6 +67,34 @@ void PointAttribute::CopyFrom(const PointAttribute &src_att) {
   }
 }
 
+void PointAttribute::MoveFrom(PointAttribute *src_att) {
+  const DataBuffer *const src_buffer = src_att->GeometryAttribute::buffer();
+  if (src_buffer == nullptr || src_buffer != src_att->attribute_buffer_.get()) {
+    // The values of |src_att| are not owned by |src_att|.
+    CopyFrom(*src_att);
+    return;
+  }
+  GeometryAttribute::operator=(*src_att);
+  attribute_buffer_ = std::move(src_att->attribute_buffer_);
+  identity_mapping_ = src_att->identity_mapping_;
+  num_unique_entries_ = src_att->num_unique_entries_;
+  indices_map_ = std::move(src_att->indices_map_);
+  // The transform data is small. It is copied so that |src_att| can be moved
+  // again after its values are decoded anew (e.g. by progressive decoders).
+  if (src_att->attribute_transform_data_) {
+    attribute_transform_data_ = std::unique_ptr<AttributeTransformData>(
+        new AttributeTransformData(*src_att->attribute_transform_data_));
+  } else {
+    attribute_transform_data_ = nullptr;
+  }
+
+  src_att->attribute_buffer_ = std::unique_ptr<DataBuffer>(new DataBuffer());
+  src_att->ResetBuffer(src_att->attribute_buffer_.get(),
+                       src_att->byte_stride(), 0);
+  src_att->num_unique_entries_ = 0;
+  src_att->indices_map_.clear();
+}
+
 bool PointAttribute::Reset(size_t num_attribute_values) {
   if (attribute_buffer_ == nullptr) {
     attribute_buffer_ = std::unique_ptr<DataBuffer>(new DataBuffer());
@@ -77,6 +109,25 @@ bool PointAttribute::Reset(size_t num_attribute_values) {
   return true;
 }
 
+void PointAttribute::RecycleStorage(PointAttribute *src_att) {
+  attribute_buffer_ = std::move(src_att->attribute_buffer_);
+  if (attribute_buffer_ == nullptr) {
+    attribute_buffer_ = std::unique_ptr<DataBuffer>(new DataBuffer());
+  }
+  // Resizing the buffer keeps its allocated memory.
+  attribute_buffer_->Resize(0);
+  ResetBuffer(attribute_buffer_.get(), byte_stride(), 0);
+  num_unique_entries_ = 0;
+  indices_map_ = std::move(src_att->indices_map_);
+  indices_map_.clear();
+
+  src_att->attribute_buffer_ = std::unique_ptr<DataBuffer>(new DataBuffer());
+  src_att->ResetBuffer(src_att->attribute_buffer_.get(),
+                       src_att->byte_stride(), 0);
+  src_att->num_unique_entries_ = 0;
+  src_att->indices_map_.clear();
+}
+
 void PointAttribute::Resize(size_t new_num_unique_entries) {
   num_unique_entries_ = static_cast<uint32_t>(new_num_unique_entries);
   attribute_buffer_->Resize(new_num_unique_entries * byte_stride());
@@ -90,30 +141,43 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
 
 AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
     const GeometryAttribute &in_att, AttributeValueIndex in_att_offset) {
+  return DeduplicateValues(in_att, in_att_offset, 1);
+}
+
+AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
+    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+    int num_threads) {
   AttributeValueIndex::ValueType unique_vals = 0;
   switch (in_att.data_type()) {
     // Currently we support only float, uint8, and uint16 arguments.
     case DT_FLOAT32:
-      unique_vals = DeduplicateTypedValues<float>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<float>(in_att, in_att_offset,
+                                                  num_threads);
       break;
     case DT_INT8:
-      unique_vals = DeduplicateTypedValues<int8_t>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<int8_t>(in_att, in_att_offset,
+                                                   num_threads);
       break;
     case DT_UINT8:
     case DT_BOOL:
-      unique_vals = DeduplicateTypedValues<uint8_t>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<uint8_t>(in_att, in_att_offset,
+                                                    num_threads);
       break;
     case DT_UINT16:
-      unique_vals = DeduplicateTypedValues<uint16_t>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<uint16_t>(in_att, in_att_offset,
+                                                     num_threads);
       break;
     case DT_INT16:
-      unique_vals = DeduplicateTypedValues<int16_t>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<int16_t>(in_att, in_att_offset,
+                                                    num_threads);
       break;
     case DT_UINT32:
-      unique_vals = DeduplicateTypedValues<uint32_t>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<uint32_t>(in_att, in_att_offset,
+                                                     num_threads);
       break;
     case DT_INT32:
-      unique_vals = DeduplicateTypedValues<int32_t>(in_att, in_att_offset);
+      unique_vals = DeduplicateTypedValues<int32_t>(in_att, in_att_offset,
+                                                    num_threads);
       break;
     default:
       return -1;  // Unsupported data type.
@@ -129,18 +193,23 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateValues(
 // Returns the number of unique attribute values.
 template <typename T>
 AttributeValueIndex::ValueType PointAttribute::DeduplicateTypedValues(
-    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset) {
+    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+    int num_threads) {
   // Select the correct method to call based on the number of attribute
   // components.
   switch (in_att.num_components()) {
     case 1:
-      return DeduplicateFormattedValues<T, 1>(in_att, in_att_offset);
+      return DeduplicateFormattedValues<T, 1>(in_att, in_att_offset,
+                                              num_threads);
     case 2:
-      return DeduplicateFormattedValues<T, 2>(in_att, in_att_offset);
+      return DeduplicateFormattedValues<T, 2>(in_att, in_att_offset,
+                                              num_threads);
     case 3:
-      return DeduplicateFormattedValues<T, 3>(in_att, in_att_offset);
+      return DeduplicateFormattedValues<T, 3>(in_att, in_att_offset,
+                                              num_threads);
     case 4:
-      return DeduplicateFormattedValues<T, 4>(in_att, in_att_offset);
+      return DeduplicateFormattedValues<T, 4>(in_att, in_att_offset,
+                                              num_threads);
     default:
       return 0;
   }
@@ -148,7 +217,8 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateTypedValues(
 
 template <typename T, int num_components_t>
 AttributeValueIndex::ValueType PointAttribute::DeduplicateFormattedValues(
-    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset) {
+    const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+    int num_threads) {
   // We want to detect duplicates using a hash map but we cannot hash floating
   // point numbers directly so bit-copy floats to the same sized integers and
   // hash them.
@@ -163,38 +233,119 @@ AttributeValueIndex::ValueType PointAttribute::DeduplicateFormattedValues(
                                                     /*else*/ uint64_t>>>
       HashType;
 
-  AttributeValueIndex unique_vals(0);
   typedef std::array<T, num_components_t> AttributeValue;
   typedef std::array<HashType, num_components_t> AttributeHashableValue;
-  typedef unordered_map<AttributeHashableValue, AttributeValueIndex,
-                        HashArray<AttributeHashableValue>>
-      ValueToIndexMap;
+  if (num_threads < 1) {
+    num_threads = 1;
+  }
+  const uint32_t num_values = num_unique_entries_;
+  ThreadPool thread_pool(num_threads);
 
-  // Hash map storing index of the first attribute with a given value.
-  ValueToIndexMap value_to_index_map;
-  AttributeValue att_value;
-  AttributeHashableValue hashable_value;
+  // Duplicate values are found in three steps. First, all values are hashed.
+  // Second, the values are split into |num_threads| partitions based on their
+  // hashes and each partition is searched for duplicates independently. For
+  // each value we find the first value with the same bits. Finally, the
+  // unique values are assigned new indices in their original order, which
+  // makes the result independent of the number of threads.
+  std::vector<uint32_t> hashes(num_values);
+  for (int t = 0; t < num_threads; ++t) {
+    thread_pool.Schedule([&, t]() {
+      const uint32_t begin = static_cast<uint64_t>(num_values) * t /
+                             num_threads;
+      const uint32_t end = static_cast<uint64_t>(num_values) * (t + 1) /
+                           num_threads;
+      AttributeHashableValue hashable_value;
+      for (uint32_t i = begin; i < end; ++i) {
+        const AttributeValue att_value =
+            in_att.GetValue<T, num_components_t>(in_att_offset + i);
+        // Bit-copy real attributes to integers.
+        memcpy(&(hashable_value[0]), &(att_value[0]), sizeof(att_value));
+        uint64_t hash = 0;
+        for (int c = 0; c < num_components_t; ++c) {
+          hash = (hash ^ hashable_value[c]) * 0xff51afd7ed558ccdull;
+        }
+        hashes[i] = static_cast<uint32_t>(hash >> 32);
+      }
+    });
+  }
+  thread_pool.Wait();
+
+  auto value_hash = [&hashes](AttributeValueIndex i) {
+    return hashes[i.value()];
+  };
+  auto value_equal = [&hashes, &in_att, in_att_offset](AttributeValueIndex i0,
+                                                       AttributeValueIndex i1) {
+    if (hashes[i0.value()] != hashes[i1.value()]) {
+      return false;
+    }
+    // Compare the bits of the values like the hashes do.
+    const AttributeValue value0 =
+        in_att.GetValue<T, num_components_t>(in_att_offset + i0.value());
+    const AttributeValue value1 =
+        in_att.GetValue<T, num_components_t>(in_att_offset + i1.value());
+    return memcmp(&(value0[0]), &(value1[0]), sizeof(AttributeValue)) == 0;
+  };
+  // Index of the first value with the same bits for each value.
+  IndexTypeVector<AttributeValueIndex, AttributeValueIndex> first_values(
+      num_values);
+  if (num_threads == 1) {
+    auto value_set = CreateIndexHashSet<AttributeValueIndex>(
+        num_values, value_hash, value_equal);
+    for (AttributeValueIndex i(0); i < num_values; ++i) {
+      first_values[i] = value_set.FindOrInsert(i);
+    }
+  } else {
+    // The partition of a value is given by the prefix of its hash. Indices of
+    // values in each partition are stored in increasing order so that the
+    // first value with given bits is always found first.
+    const int num_parts = num_threads;
+    auto get_part = [&hashes, num_parts](uint32_t i) {
+      return static_cast<int>((static_cast<uint64_t>(hashes[i]) * num_parts) >>
+                              32);
+    };
+    std::vector<std::vector<std::vector<AttributeValueIndex>>> buckets(
+        num_threads, std::vector<std::vector<AttributeValueIndex>>(num_parts));
+    for (int t = 0; t < num_threads; ++t) {
+      thread_pool.Schedule([&, t]() {
+        const uint32_t begin = static_cast<uint64_t>(num_values) * t /
+                               num_threads;
+        const uint32_t end = static_cast<uint64_t>(num_values) * (t + 1) /
+                             num_threads;
+        for (uint32_t i = begin; i < end; ++i) {
+          buckets[t][get_part(i)].push_back(AttributeValueIndex(i));
+        }
+      });
+    }
+    thread_pool.Wait();
+    for (int p = 0; p < num_parts; ++p) {
+      thread_pool.Schedule([&, p]() {
+        size_t part_size = 0;
+        for (int t = 0; t < num_threads; ++t) {
+          part_size += buckets[t][p].size();
+        }
+        auto value_set = CreateIndexHashSet<AttributeValueIndex>(
+            part_size, value_hash, value_equal);
+        for (int t = 0; t < num_threads; ++t) {
+          for (const AttributeValueIndex i : buckets[t][p]) {
+            first_values[i] = value_set.FindOrInsert(i);
+          }
+        }
+      });
+    }
+    thread_pool.Wait();
+  }
+
+  AttributeValueIndex unique_vals(0);
   IndexTypeVector<AttributeValueIndex, AttributeValueIndex> value_map(
       num_unique_entries_);
   for (AttributeValueIndex i(0); i < num_unique_entries_; ++i) {
-    const AttributeValueIndex att_pos = i + in_att_offset;
-    att_value = in_att.GetValue<T, num_components_t>(att_pos);
-    // Convert the value to hashable type. Bit-copy real attributes to integers.
-    memcpy(&(hashable_value[0]), &(att_value[0]), sizeof(att_value));
-
-    typename ValueToIndexMap::iterator it;
-    bool inserted;
-    std::tie(it, inserted) = value_to_index_map.insert(
-        std::pair<AttributeHashableValue, AttributeValueIndex>(hashable_value,
-                                                               unique_vals));
-
-    // Try to update the hash map with a new entry pointing to the latest unique
-    // vertex index.
-    if (!inserted) {
+    if (first_values[i] != i) {
       // Duplicated value found. Update index mapping.
-      value_map[i] = it->second;
+      value_map[i] = value_map[first_values[i]];
     } else {
       // New unique value.
+      const AttributeValue att_value =
+          in_att.GetValue<T, num_components_t>(in_att_offset + i.value());
       SetAttributeValue(unique_vals, &att_value);
       // Update index mapping.
       value_map[i] = unique_vals;
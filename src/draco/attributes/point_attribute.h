@@ -49,9 +49,22 @@ class PointAttribute : public GeometryAttribute {
   // Copies attribute data from the provided |src_att| attribute.
   void CopyFrom(const PointAttribute &src_att);
 
+  // Same as CopyFrom() but the attribute values and the mapping between points
+  // and attribute values are moved from |src_att| without copying. |src_att|
+  // is left without any attribute values. The transform data is copied and
+  // stays on |src_att|.
+  void MoveFrom(PointAttribute *src_att);
+
   // Prepares the attribute storage for the specified number of entries.
   bool Reset(size_t num_attribute_values);
 
+  // Moves the memory allocated for attribute values and for the mapping
+  // between points and attribute values from |src_att| to this attribute so
+  // that it can be reused when the attribute is filled with new data using
+  // Reset() and SetExplicitMapping(). Both attributes are left without any
+  // attribute values.
+  void RecycleStorage(PointAttribute *src_att);
+
   size_t size() const { return num_unique_entries_; }
   AttributeValueIndex mapped_index(PointIndex point_index) const {
     if (identity_mapping_) {
@@ -109,6 +122,25 @@ class PointAttribute : public GeometryAttribute {
     return GetValue(mapped_index(point_index), out_data);
   }
 
+  // Same as GeometryAttribute::ConvertValues(), but converts values of
+  // |num_points| consecutive points starting at |first_point|. Mapping to
+  // attribute value indices is performed automatically.
+  template <typename OutT>
+  bool ConvertMappedValues(PointIndex first_point, int num_points,
+                           int8_t out_num_components, OutT *out_values) const {
+    if (identity_mapping_) {
+      return ConvertValues(AttributeValueIndex(first_point.value()),
+                           num_points, out_num_components, out_values);
+    }
+    if (num_points < 0 ||
+        first_point.value() + static_cast<int64_t>(num_points) >
+                static_cast<int64_t>(indices_map_.size())) {
+      return false;
+    }
+    return ConvertValues(indices_map_.data() + first_point.value(), num_points,
+                         out_num_components, out_values);
+  }
+
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   // Deduplicate |in_att| values into |this| attribute. |in_att| can be equal
   // to |this|.
@@ -120,6 +152,13 @@ class PointAttribute : public GeometryAttribute {
   // provided offset |in_att_offset|.
   AttributeValueIndex::ValueType DeduplicateValues(
       const GeometryAttribute &in_att, AttributeValueIndex in_att_offset);
+
+  // Same as above but the duplicate values are found using up to
+  // |num_threads| threads. The resulting attribute is the same for any number
+  // of threads.
+  AttributeValueIndex::ValueType DeduplicateValues(
+      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+      int num_threads);
 #endif
 
   // Set attribute transform data for the attribute. The data is used to store
@@ -143,10 +182,12 @@ class PointAttribute : public GeometryAttribute {
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   template <typename T>
   AttributeValueIndex::ValueType DeduplicateTypedValues(
-      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset);
+      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+      int num_threads);
   template <typename T, int COMPONENTS_COUNT>
   AttributeValueIndex::ValueType DeduplicateFormattedValues(
-      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset);
+      const GeometryAttribute &in_att, AttributeValueIndex in_att_offset,
+      int num_threads);
 #endif
 
   // Data storage for attribute values. GeometryAttribute itself doesn't own its
@@ -14,6 +14,9 @@
 //
 #include "draco/attributes/point_attribute.h"
 
+#include <cmath>
+#include <vector>
+
 #include "draco/core/draco_test_base.h"
 
 namespace {
@@ -51,6 +54,43 @@ TEST_F(PointAttributeTest, TestCopy) {
   }
 }
 
+TEST_F(PointAttributeTest, TestMove) {
+  // This test verifies that PointAttribute can take over data of another point
+  // attribute without copying it.
+  draco::PointAttribute pa;
+  pa.Init(draco::GeometryAttribute::POSITION, 1, draco::DT_INT32, false, 10);
+  for (int32_t i = 0; i < 10; ++i) {
+    pa.SetAttributeValue(draco::AttributeValueIndex(i), &i);
+  }
+  pa.SetExplicitMapping(20);
+  for (draco::PointIndex pi(0); pi < 20; ++pi) {
+    pa.SetPointMapEntry(pi, draco::AttributeValueIndex(pi.value() / 2));
+  }
+  pa.set_unique_id(12);
+  const uint8_t *const data_address =
+      pa.GetAddress(draco::AttributeValueIndex(0));
+
+  draco::PointAttribute other_pa;
+  other_pa.Init(draco::GeometryAttribute::GENERIC, 2, draco::DT_FLOAT32, false,
+                5);
+  other_pa.MoveFrom(&pa);
+
+  ASSERT_EQ(other_pa.attribute_type(), draco::GeometryAttribute::POSITION);
+  ASSERT_EQ(other_pa.data_type(), draco::DT_INT32);
+  ASSERT_EQ(other_pa.num_components(), 1);
+  ASSERT_EQ(other_pa.unique_id(), 12);
+  ASSERT_EQ(other_pa.size(), 10);
+  ASSERT_EQ(other_pa.indices_map_size(), 20);
+  ASSERT_EQ(other_pa.GetAddress(draco::AttributeValueIndex(0)), data_address);
+  for (draco::PointIndex pi(0); pi < 20; ++pi) {
+    int32_t data;
+    other_pa.GetMappedValue(pi, &data);
+    ASSERT_EQ(data, pi.value() / 2);
+  }
+  ASSERT_EQ(pa.size(), 0);
+  ASSERT_EQ(pa.buffer()->data_size(), 0);
+}
+
 TEST_F(PointAttributeTest, TestGetValueFloat) {
   draco::PointAttribute pa;
   pa.Init(draco::GeometryAttribute::POSITION, 3, draco::DT_FLOAT32, false, 5);
@@ -125,4 +165,114 @@ TEST_F(PointAttributeTest, TestResize) {
   ASSERT_EQ(pa.buffer()->data_size(), 4 * 3 * 10);
 }
 
+TEST_F(PointAttributeTest, TestConvertValues) {
+  // Tests that ConvertValues() produces the same values as ConvertValue()
+  // called for each attribute entry.
+  draco::PointAttribute pa;
+  pa.Init(draco::GeometryAttribute::GENERIC, 3, draco::DT_INT16, true, 5);
+  for (int16_t i = 0; i < 5; ++i) {
+    const int16_t value[3] = {static_cast<int16_t>(i * 1000),
+                              static_cast<int16_t>(-i * 100),
+                              static_cast<int16_t>(i)};
+    pa.SetAttributeValue(draco::AttributeValueIndex(i), value);
+  }
+
+  // Normalized integers to floats with the same number of components.
+  std::vector<float> float_values(4 * 3);
+  ASSERT_TRUE(pa.ConvertValues<float>(draco::AttributeValueIndex(1), 4, 3,
+                                      float_values.data()));
+  for (int i = 0; i < 4; ++i) {
+    float expected[3];
+    ASSERT_TRUE(pa.ConvertValue<float>(draco::AttributeValueIndex(i + 1), 3,
+                                       expected));
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_EQ(float_values[i * 3 + c], expected[c]);
+    }
+  }
+
+  // Integers to integers with padded output components.
+  std::vector<int32_t> int_values(5 * 4);
+  ASSERT_TRUE(pa.ConvertValues<int32_t>(draco::AttributeValueIndex(0), 5, 4,
+                                        int_values.data()));
+  for (int i = 0; i < 5; ++i) {
+    ASSERT_EQ(int_values[i * 4 + 0], i * 1000);
+    ASSERT_EQ(int_values[i * 4 + 1], -i * 100);
+    ASSERT_EQ(int_values[i * 4 + 2], i);
+    ASSERT_EQ(int_values[i * 4 + 3], 0);
+  }
+
+  // Conversion of negative values to an unsigned type fails.
+  std::vector<uint16_t> uint_values(5 * 3);
+  ASSERT_FALSE(pa.ConvertValues<uint16_t>(draco::AttributeValueIndex(0), 5, 3,
+                                          uint_values.data()));
+
+  // Entries out of the attribute range fail.
+  ASSERT_FALSE(pa.ConvertValues<float>(draco::AttributeValueIndex(2), 4, 3,
+                                       float_values.data()));
+}
+
+TEST_F(PointAttributeTest, TestConvertMappedValues) {
+  draco::PointAttribute pa;
+  pa.Init(draco::GeometryAttribute::POSITION, 2, draco::DT_FLOAT32, false, 3);
+  for (int i = 0; i < 3; ++i) {
+    const float value[2] = {i * 2.f, i * 2.f + 1.f};
+    pa.SetAttributeValue(draco::AttributeValueIndex(i), value);
+  }
+  pa.SetExplicitMapping(4);
+  pa.SetPointMapEntry(draco::PointIndex(0), draco::AttributeValueIndex(2));
+  pa.SetPointMapEntry(draco::PointIndex(1), draco::AttributeValueIndex(0));
+  pa.SetPointMapEntry(draco::PointIndex(2), draco::AttributeValueIndex(2));
+  pa.SetPointMapEntry(draco::PointIndex(3), draco::AttributeValueIndex(1));
+
+  std::vector<double> values(3 * 2);
+  ASSERT_TRUE(pa.ConvertMappedValues<double>(draco::PointIndex(1), 3, 2,
+                                             values.data()));
+  const std::vector<double> expected = {0., 1., 4., 5., 2., 3.};
+  ASSERT_EQ(values, expected);
+
+  // Points out of the mapping range fail.
+  ASSERT_FALSE(pa.ConvertMappedValues<double>(draco::PointIndex(2), 3, 2,
+                                              values.data()));
+}
+
+#ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
+TEST_F(PointAttributeTest, TestDeduplicateValues) {
+  // Tests that values are deduplicated in the order of their first occurrence
+  // and that the result does not depend on the number of threads.
+  const int kNumValues = 1000;
+  for (const int num_threads : {1, 2, 3, 8}) {
+    draco::PointAttribute pa;
+    pa.Init(draco::GeometryAttribute::POSITION, 2, draco::DT_FLOAT32, false,
+            kNumValues);
+    for (int i = 0; i < kNumValues; ++i) {
+      // Values 0.f and -0.f have different bits so they are not merged.
+      const float value[2] = {static_cast<float>((i * 7) % 50),
+                              (i % 3 == 0) ? -0.f : 0.f};
+      pa.SetAttributeValue(draco::AttributeValueIndex(i), value);
+    }
+    ASSERT_EQ(pa.DeduplicateValues(pa, draco::AttributeValueIndex(0),
+                                   num_threads),
+              100);
+    ASSERT_EQ(pa.size(), 100);
+    for (int i = 0; i < kNumValues; ++i) {
+      float value[2];
+      pa.GetMappedValue(draco::PointIndex(i), value);
+      ASSERT_EQ(value[0], static_cast<float>((i * 7) % 50));
+      ASSERT_EQ(std::signbit(value[1]), i % 3 == 0);
+    }
+    // Unique values are indexed in the order of their first occurrence.
+    std::vector<int> expected_indices(100, -1);
+    int num_unique_values = 0;
+    for (int i = 0; i < kNumValues; ++i) {
+      const int key = 2 * ((i * 7) % 50) + (i % 3 == 0 ? 1 : 0);
+      if (expected_indices[key] == -1) {
+        expected_indices[key] = num_unique_values++;
+      }
+      ASSERT_EQ(pa.mapped_index(draco::PointIndex(i)).value(),
+                expected_indices[key]);
+    }
+  }
+}
+#endif
+
 }  // namespace
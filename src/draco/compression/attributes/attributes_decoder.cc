@@ -109,8 +109,8 @@ bool AttributesDecoder::DecodeAttributesDecoderData(DecoderBuffer *in_buffer) {
       }
       ga.set_unique_id(unique_id);
     }
-    const int att_id = pc->AddAttribute(
-        std::unique_ptr<PointAttribute>(new PointAttribute(ga)));
+    const int att_id =
+        pc->AddAttribute(point_cloud_decoder_->CreateAttribute(ga));
     pc->attribute(att_id)->set_unique_id(unique_id);
     point_attribute_ids_[i] = att_id;
 
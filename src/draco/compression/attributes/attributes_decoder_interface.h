@@ -44,6 +44,31 @@ class AttributesDecoderInterface {
   // the derived classes.
   virtual bool DecodeAttributes(DecoderBuffer *in_buffer) = 0;
 
+  // Same as DecodeAttributes() but the decoder may postpone any work that does
+  // not read from the |in_buffer| until FinalizeAttribute() is called for each
+  // of its attributes. Decoders that do not support the deferred decoding
+  // decode all attributes directly.
+  virtual bool DecodeAttributesDeferred(DecoderBuffer *in_buffer) {
+    return DecodeAttributes(in_buffer);
+  }
+
+  // Completes the deferred decoding of the i-th attribute of the decoder.
+  // All attributes returned by GetParentAttributeIds(i) must be finalized
+  // before this method is called. Different attributes can be finalized
+  // concurrently.
+  virtual bool FinalizeAttribute(int /* i */) { return true; }
+
+  // Returns point attribute ids of all attributes that are needed to finalize
+  // the i-th attribute of the decoder.
+  virtual std::vector<int32_t> GetParentAttributeIds(int /* i */) const {
+    return std::vector<int32_t>();
+  }
+
+  // Called when all attributes of the decoded geometry are decoded. At this
+  // point the portable attributes are no longer used by prediction schemes of
+  // other attributes.
+  virtual bool OnAllAttributesDecoded() { return true; }
+
   virtual int32_t GetAttributeId(int i) const = 0;
   virtual int32_t GetNumAttributes() const = 0;
   virtual PointCloudDecoder *GetDecoder() const = 0;
@@ -14,6 +14,10 @@
 //
 #include "draco/compression/attributes/kd_tree_attributes_decoder.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 #include "draco/compression/attributes/kd_tree_attributes_shared.h"
 #include "draco/compression/point_cloud/algorithms/dynamic_integer_points_kd_tree_decoder.h"
 #include "draco/compression/point_cloud/algorithms/float_points_tree_decoder.h"
@@ -23,9 +27,7 @@
 
 namespace draco {
 
-// attribute, offset_dimensionality, data_type, data_size, num_components
-using AttributeTuple =
-    std::tuple<PointAttribute *, uint32_t, DataType, uint32_t, uint32_t>;
+using AttributeTuple = KdTreeAttributesDecoder::AttributeTuple;
 
 // Output iterator that is used to decode values directly into the data buffer
 // of the modified PointAttribute.
@@ -129,7 +131,99 @@ class PointAttributeVectorOutputIterator {
       PointAttributeVectorOutputIterator const &) = delete;
 };
 
-KdTreeAttributesDecoder::KdTreeAttributesDecoder() {}
+// Output iterator that appends all decoded points to a vector.
+class PointVectorOutputIterator {
+ public:
+  explicit PointVectorOutputIterator(std::vector<uint32_t> *points)
+      : points_(points) {}
+
+  PointVectorOutputIterator &operator++() { return *this; }
+  PointVectorOutputIterator &operator*() { return *this; }
+  PointVectorOutputIterator &operator=(const std::vector<uint32_t> &val) {
+    points_->insert(points_->end(), val.begin(), val.end());
+    return *this;
+  }
+
+ private:
+  std::vector<uint32_t> *points_;
+};
+
+// Output iterator that forwards only points inside of a query box to another
+// output iterator. The box is defined on three consecutive components of the
+// decoded points starting at |offset|.
+template <class OutputIteratorT>
+class BoxFilterOutputIterator {
+ public:
+  explicit BoxFilterOutputIterator(OutputIteratorT *out_it)
+      : out_it_(out_it), has_box_(false), offset_(0), num_points_(0) {}
+
+  void SetBox(uint32_t offset, const uint32_t *min_values,
+              const uint32_t *max_values) {
+    has_box_ = true;
+    offset_ = offset;
+    for (int c = 0; c < 3; ++c) {
+      min_values_[c] = min_values[c];
+      max_values_[c] = max_values[c];
+    }
+  }
+
+  // Returns true when the cell of the subtree given by |root| intersects the
+  // query box.
+  bool IntersectsCell(const KdTreeSubtreeRoot &root,
+                      uint32_t bit_length) const {
+    if (!has_box_) {
+      return true;
+    }
+    for (int c = 0; c < 3; ++c) {
+      const uint64_t cell_min = root.base[offset_ + c];
+      const uint64_t cell_max =
+          cell_min + (uint64_t(1) << (bit_length - root.levels[offset_ + c])) -
+          1;
+      if (cell_min > max_values_[c] || cell_max < min_values_[c]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  BoxFilterOutputIterator &operator++() { return *this; }
+  BoxFilterOutputIterator &operator*() { return *this; }
+  BoxFilterOutputIterator &operator=(const std::vector<uint32_t> &val) {
+    if (has_box_) {
+      for (int c = 0; c < 3; ++c) {
+        const uint32_t value = val[offset_ + c];
+        if (value < min_values_[c] || value > max_values_[c]) {
+          return *this;
+        }
+      }
+    }
+    **out_it_ = val;
+    ++(*out_it_);
+    ++num_points_;
+    return *this;
+  }
+
+  // Returns the number of points forwarded to the output iterator.
+  uint32_t num_points() const { return num_points_; }
+
+ private:
+  OutputIteratorT *out_it_;
+  bool has_box_;
+  uint32_t offset_;
+  uint32_t min_values_[3];
+  uint32_t max_values_[3];
+  uint32_t num_points_;
+};
+
+KdTreeAttributesDecoder::KdTreeAttributesDecoder()
+    : layout_(kKdTreeDepthFirstLayout),
+      kd_tree_dimensionality_(0),
+      kd_tree_compression_level_(0),
+      kd_tree_bit_length_(0),
+      index_depth_(0),
+      allow_partial_levels_(false),
+      num_levels_(0),
+      num_decoded_levels_(0) {}
 
 bool KdTreeAttributesDecoder::DecodePortableAttributes(
     DecoderBuffer *in_buffer) {
@@ -142,6 +236,23 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
   if (!in_buffer->Decode(&compression_level)) {
     return false;
   }
+  uint8_t index_depth = 0;
+  if (in_buffer->bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 5)) {
+    if (!in_buffer->Decode(&layout_)) {
+      return false;
+    }
+    if (layout_ == kKdTreeSubtreeIndexLayout) {
+      if (!in_buffer->Decode(&index_depth) || index_depth == 0) {
+        return false;
+      }
+    } else if (layout_ != kKdTreeDepthFirstLayout &&
+               layout_ != kKdTreeProgressiveLayout) {
+      return false;
+    }
+  }
+  if (allow_partial_levels_ && layout_ != kKdTreeProgressiveLayout) {
+    return false;
+  }
   const int32_t num_points = GetDecoder()->point_cloud()->num_points();
 
   // Decode data using the kd tree decoding into integer (portable) attributes.
@@ -185,6 +296,7 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
       port_att->SetIdentityMapping();
       port_att->Reset(num_points);
       quantized_portable_attributes_.push_back(std::move(port_att));
+      quantized_attribute_ids_.push_back(att_id);
       target_att = quantized_portable_attributes_.back().get();
     } else {
       // Unsupported type.
@@ -198,6 +310,71 @@ bool KdTreeAttributesDecoder::DecodePortableAttributes(
                               data_size, num_components);
     total_dimensionality += num_components;
   }
+
+  if (layout_ == kKdTreeProgressiveLayout) {
+    // Only the header is decoded here. The levels of the tree are stored
+    // after the data of the portable transforms and they are decoded in
+    // DecodeDataNeededByPortableTransforms().
+    if (total_dimensionality == 0) {
+      return false;
+    }
+    kd_tree_atts_ = atts;
+    kd_tree_dimensionality_ = total_dimensionality;
+    kd_tree_compression_level_ = compression_level;
+    level_max_values_.resize(total_dimensionality);
+    for (uint32_t &max_value : level_max_values_) {
+      if (!DecodeVarint(&max_value, in_buffer)) {
+        return false;
+      }
+    }
+    switch (compression_level) {
+      case 0:
+        return DecodeLevelsHeader<0>(num_points, in_buffer);
+      case 1:
+        return DecodeLevelsHeader<1>(num_points, in_buffer);
+      case 2:
+        return DecodeLevelsHeader<2>(num_points, in_buffer);
+      case 3:
+        return DecodeLevelsHeader<3>(num_points, in_buffer);
+      case 4:
+        return DecodeLevelsHeader<4>(num_points, in_buffer);
+      case 5:
+        return DecodeLevelsHeader<5>(num_points, in_buffer);
+      case 6:
+        return DecodeLevelsHeader<6>(num_points, in_buffer);
+      default:
+        return false;
+    }
+  }
+
+  if (index_depth > 0) {
+    // Only the top levels of the tree are decoded here. The subtrees are
+    // decoded in DecodeDataNeededByPortableTransforms() once the quantization
+    // parameters needed to evaluate the query box are known.
+    kd_tree_atts_ = atts;
+    kd_tree_dimensionality_ = total_dimensionality;
+    index_depth_ = index_depth;
+    kd_tree_compression_level_ = compression_level;
+    switch (compression_level) {
+      case 0:
+        return DecodeSubtreeIndex<0>(index_depth, num_points, in_buffer);
+      case 1:
+        return DecodeSubtreeIndex<1>(index_depth, num_points, in_buffer);
+      case 2:
+        return DecodeSubtreeIndex<2>(index_depth, num_points, in_buffer);
+      case 3:
+        return DecodeSubtreeIndex<3>(index_depth, num_points, in_buffer);
+      case 4:
+        return DecodeSubtreeIndex<4>(index_depth, num_points, in_buffer);
+      case 5:
+        return DecodeSubtreeIndex<5>(index_depth, num_points, in_buffer);
+      case 6:
+        return DecodeSubtreeIndex<6>(index_depth, num_points, in_buffer);
+      default:
+        return false;
+    }
+  }
+
   typedef PointAttributeVectorOutputIterator<uint32_t> OutIt;
   OutIt out_it(atts);
 
@@ -270,6 +447,387 @@ bool KdTreeAttributesDecoder::DecodePoints(int total_dimensionality,
   return true;
 }
 
+template <int level_t>
+bool KdTreeAttributesDecoder::DecodeSubtreeIndex(uint32_t index_depth,
+                                                 int num_points,
+                                                 DecoderBuffer *in_buffer) {
+  DynamicIntegerPointsKdTreeDecoder<level_t> decoder(kd_tree_dimensionality_);
+  PointVectorOutputIterator top_points_it(&index_top_points_);
+  std::vector<KdTreeSubtreeRoot> roots;
+  if (!decoder.DecodeIndexedPoints(in_buffer, index_depth, top_points_it,
+                                   num_points, &roots)) {
+    return false;
+  }
+  kd_tree_bit_length_ = decoder.bit_length();
+
+  // All points must be stored either in the top levels or in the subtrees.
+  uint64_t num_index_points =
+      index_top_points_.size() / std::max(kd_tree_dimensionality_, 1u);
+  for (const KdTreeSubtreeRoot &root : roots) {
+    num_index_points += root.num_points;
+  }
+  if (num_index_points != static_cast<uint64_t>(num_points)) {
+    return false;
+  }
+
+  uint32_t num_subtrees;
+  if (!DecodeVarint(&num_subtrees, in_buffer) ||
+      num_subtrees != roots.size()) {
+    return false;
+  }
+  index_subtrees_.resize(num_subtrees);
+  for (uint32_t i = 0; i < num_subtrees; ++i) {
+    uint64_t size;
+    if (!DecodeVarint(&size, in_buffer)) {
+      return false;
+    }
+    index_subtrees_[i].root = std::move(roots[i]);
+    index_subtrees_[i].size = static_cast<size_t>(size);
+  }
+  for (Subtree &subtree : index_subtrees_) {
+    if (subtree.size > static_cast<uint64_t>(in_buffer->remaining_size())) {
+      return false;
+    }
+    subtree.data = in_buffer->data_head();
+    in_buffer->Advance(subtree.size);
+  }
+  return true;
+}
+
+template <int level_t, typename OutIteratorT>
+bool KdTreeAttributesDecoder::DecodeSubtrees(uint32_t max_points_per_subtree,
+                                             OutIteratorT *out_iterator) {
+  DynamicIntegerPointsKdTreeDecoder<level_t> decoder(kd_tree_dimensionality_);
+  for (const Subtree &subtree : index_subtrees_) {
+    if (!out_iterator->IntersectsCell(subtree.root, kd_tree_bit_length_)) {
+      continue;
+    }
+    DecoderBuffer buffer;
+    buffer.Init(subtree.data, subtree.size);
+    buffer.set_bitstream_version(GetDecoder()->bitstream_version());
+    if (!decoder.DecodeSubtree(&buffer, kd_tree_bit_length_, subtree.root,
+                               *out_iterator, max_points_per_subtree) ||
+        decoder.num_decoded_points() !=
+            std::min(max_points_per_subtree, subtree.root.num_points)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool KdTreeAttributesDecoder::DecodeIndexedPoints() {
+  typedef PointAttributeVectorOutputIterator<uint32_t> OutIt;
+  OutIt out_it(kd_tree_atts_);
+  BoxFilterOutputIterator<OutIt> filter_it(&out_it);
+
+  const DecoderOptions *const options = GetDecoder()->options();
+  float query_box[6];
+  if (options->GetGlobalVector("kd_tree_query_box", 6, query_box)) {
+    for (int c = 0; c < 6; ++c) {
+      if (!std::isfinite(query_box[c])) {
+        return false;
+      }
+    }
+    // Convert the query box to the quantized positions. The box is applied
+    // only to quantized 3D positions.
+    int num_processed_quantized_attributes = 0;
+    for (int i = 0; i < GetNumAttributes(); ++i) {
+      const PointAttribute *const att =
+          GetDecoder()->point_cloud()->attribute(GetAttributeId(i));
+      if (att->data_type() != DT_FLOAT32) {
+        continue;
+      }
+      const AttributeQuantizationTransform &transform =
+          attribute_quantization_transforms_
+              [num_processed_quantized_attributes++];
+      if (att->attribute_type() != GeometryAttribute::POSITION ||
+          att->num_components() != 3) {
+        continue;
+      }
+      const uint32_t max_quantized_value =
+          (1u << static_cast<uint32_t>(transform.quantization_bits())) - 1;
+      Dequantizer dequantizer;
+      if (!dequantizer.Init(transform.range(), max_quantized_value)) {
+        return false;
+      }
+      const double delta =
+          static_cast<double>(transform.range()) / max_quantized_value;
+      uint32_t min_values[3];
+      uint32_t max_values[3];
+      for (int c = 0; c < 3; ++c) {
+        // Returns the value of |q| after dequantization.
+        const auto dequantize = [&](int64_t q) {
+          return dequantizer.DequantizeFloat(static_cast<int32_t>(q)) +
+                 transform.min_value(c);
+        };
+        // Find the range of quantized values that are dequantized to values
+        // within the box. Start with an estimate and correct rounding errors.
+        int64_t min_q = 0;
+        int64_t max_q = max_quantized_value;
+        if (delta <= 0.0) {
+          // All values are the same.
+          if (dequantize(0) < query_box[c] ||
+              dequantize(0) > query_box[3 + c]) {
+            min_q = 1;
+            max_q = 0;
+          }
+        } else {
+          // Clamp the estimates before the conversion so that boxes far
+          // outside of the encoded range do not overflow int64_t. NaNs are
+          // mapped to -1.
+          const auto clamp_q = [max_quantized_value](double q) {
+            return static_cast<int64_t>(std::max(
+                -1.0,
+                std::min(q, static_cast<double>(max_quantized_value) + 1.0)));
+          };
+          min_q = clamp_q(
+              std::ceil((query_box[c] - transform.min_value(c)) / delta));
+          max_q = clamp_q(
+              std::floor((query_box[3 + c] - transform.min_value(c)) / delta));
+          min_q = std::max<int64_t>(min_q, 0);
+          max_q = std::min<int64_t>(max_q, max_quantized_value);
+          while (min_q > 0 && dequantize(min_q - 1) >= query_box[c]) {
+            --min_q;
+          }
+          while (min_q <= max_q && dequantize(min_q) < query_box[c]) {
+            ++min_q;
+          }
+          while (max_q < max_quantized_value &&
+                 dequantize(max_q + 1) <= query_box[3 + c]) {
+            ++max_q;
+          }
+          while (max_q >= min_q && dequantize(max_q) > query_box[3 + c]) {
+            --max_q;
+          }
+        }
+        if (min_q > max_q) {
+          // Empty box.
+          min_q = 1;
+          max_q = 0;
+        }
+        min_values[c] = static_cast<uint32_t>(min_q);
+        max_values[c] = static_cast<uint32_t>(max_q);
+      }
+      filter_it.SetBox(std::get<1>(kd_tree_atts_[i]), min_values, max_values);
+      break;
+    }
+  }
+
+  // Subtrees are not refined when the maximum depth does not exceed the
+  // depth of the index.
+  const int max_depth = options->GetGlobalInt("kd_tree_max_depth", -1);
+  const uint32_t max_points_per_subtree =
+      (max_depth >= 0 && max_depth <= static_cast<int>(index_depth_))
+          ? 1
+          : std::numeric_limits<uint32_t>::max();
+
+  // Points stored in the top levels of the tree.
+  std::vector<uint32_t> point(kd_tree_dimensionality_);
+  for (size_t i = 0; i + kd_tree_dimensionality_ <= index_top_points_.size() &&
+                     kd_tree_dimensionality_ > 0;
+       i += kd_tree_dimensionality_) {
+    point.assign(index_top_points_.begin() + i,
+                 index_top_points_.begin() + i + kd_tree_dimensionality_);
+    *filter_it = point;
+    ++filter_it;
+  }
+
+  typedef BoxFilterOutputIterator<OutIt> FilterIt;
+  switch (kd_tree_compression_level_) {
+    case 0:
+      if (!DecodeSubtrees<0, FilterIt>(max_points_per_subtree, &filter_it)) {
+        return false;
+      }
+      break;
+    case 1:
+      if (!DecodeSubtrees<1, FilterIt>(max_points_per_subtree, &filter_it)) {
+        return false;
+      }
+      break;
+    case 2:
+      if (!DecodeSubtrees<2, FilterIt>(max_points_per_subtree, &filter_it)) {
+        return false;
+      }
+      break;
+    case 3:
+      if (!DecodeSubtrees<3, FilterIt>(max_points_per_subtree, &filter_it)) {
+        return false;
+      }
+      break;
+    case 4:
+      if (!DecodeSubtrees<4, FilterIt>(max_points_per_subtree, &filter_it)) {
+        return false;
+      }
+      break;
+    case 5:
+      if (!DecodeSubtrees<5, FilterIt>(max_points_per_subtree, &filter_it)) {
+        return false;
+      }
+      break;
+    case 6:
+      if (!DecodeSubtrees<6, FilterIt>(max_points_per_subtree, &filter_it)) {
+        return false;
+      }
+      break;
+    default:
+      return false;
+  }
+  index_top_points_.clear();
+  index_subtrees_.clear();
+
+  // Remove values of points that were not decoded.
+  const uint32_t num_points = filter_it.num_points();
+  for (int i = 0; i < GetNumAttributes(); ++i) {
+    GetDecoder()->point_cloud()->attribute(GetAttributeId(i))->Resize(
+        num_points);
+  }
+  for (auto &att : quantized_portable_attributes_) {
+    att->Resize(num_points);
+  }
+  GetDecoder()->point_cloud()->set_num_points(num_points);
+  return true;
+}
+
+template <int level_t>
+bool KdTreeAttributesDecoder::DecodeLevelsHeader(int num_points,
+                                                 DecoderBuffer *in_buffer) {
+  DynamicIntegerPointsKdTreeDecoder<level_t> decoder(kd_tree_dimensionality_);
+  if (!decoder.DecodeLevelsHeader(in_buffer, num_points, &level_nodes_)) {
+    return false;
+  }
+  const uint32_t num_header_points =
+      level_nodes_.empty() ? 0 : level_nodes_[0].num_points;
+  if (num_header_points != static_cast<uint32_t>(num_points)) {
+    return false;
+  }
+  kd_tree_bit_length_ = decoder.bit_length();
+  if (!DecodeVarint(&num_levels_, in_buffer)) {
+    return false;
+  }
+  // Each level of the tree refines one of the axes by one bit.
+  if (num_levels_ > kd_tree_bit_length_ * kd_tree_dimensionality_ + 1) {
+    return false;
+  }
+  num_decoded_levels_ = 0;
+  level_points_.clear();
+  return true;
+}
+
+bool KdTreeAttributesDecoder::DecodeLevels(int max_depth,
+                                           DecoderBuffer *in_buffer) {
+  switch (kd_tree_compression_level_) {
+    case 0:
+      return DecodeLevelsInternal<0>(max_depth, in_buffer);
+    case 1:
+      return DecodeLevelsInternal<1>(max_depth, in_buffer);
+    case 2:
+      return DecodeLevelsInternal<2>(max_depth, in_buffer);
+    case 3:
+      return DecodeLevelsInternal<3>(max_depth, in_buffer);
+    case 4:
+      return DecodeLevelsInternal<4>(max_depth, in_buffer);
+    case 5:
+      return DecodeLevelsInternal<5>(max_depth, in_buffer);
+    case 6:
+      return DecodeLevelsInternal<6>(max_depth, in_buffer);
+    default:
+      return false;
+  }
+}
+
+template <int level_t>
+bool KdTreeAttributesDecoder::DecodeLevelsInternal(int max_depth,
+                                                   DecoderBuffer *in_buffer) {
+  DynamicIntegerPointsKdTreeDecoder<level_t> decoder(kd_tree_dimensionality_);
+  PointVectorOutputIterator out_it(&level_points_);
+  while (num_decoded_levels_ < num_levels_ &&
+         (max_depth < 0 ||
+          num_decoded_levels_ < static_cast<uint32_t>(max_depth))) {
+    if (level_nodes_.empty()) {
+      return false;
+    }
+    // Parse the level size from a copy of the buffer so that |in_buffer| is
+    // not modified when the level is not fully available.
+    DecoderBuffer size_buffer = *in_buffer;
+    uint64_t size;
+    if (!DecodeVarint(&size, &size_buffer) ||
+        size > static_cast<uint64_t>(size_buffer.remaining_size())) {
+      if (allow_partial_levels_) {
+        break;
+      }
+      return false;
+    }
+    DecoderBuffer level_buffer;
+    level_buffer.Init(size_buffer.data_head(), size);
+    level_buffer.set_bitstream_version(GetDecoder()->bitstream_version());
+    if (!decoder.DecodeLevel(&level_buffer, kd_tree_bit_length_, &level_nodes_,
+                             out_it)) {
+      return false;
+    }
+    in_buffer->Advance(size_buffer.data_head() - in_buffer->data_head() +
+                       size);
+    ++num_decoded_levels_;
+  }
+  if (num_decoded_levels_ == num_levels_ && !level_nodes_.empty()) {
+    return false;
+  }
+  return StoreLevelPoints();
+}
+
+bool KdTreeAttributesDecoder::StoreLevelPoints() {
+  const uint32_t num_leaf_points =
+      static_cast<uint32_t>(level_points_.size() / kd_tree_dimensionality_);
+  const uint64_t num_points =
+      static_cast<uint64_t>(num_leaf_points) + level_nodes_.size();
+  if (num_points > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+    return false;
+  }
+  for (int i = 0; i < GetNumAttributes(); ++i) {
+    PointAttribute *const att =
+        GetDecoder()->point_cloud()->attribute(GetAttributeId(i));
+    att->Reset(num_points);
+    att->SetIdentityMapping();
+  }
+  for (auto &att : quantized_portable_attributes_) {
+    att->Reset(num_points);
+  }
+
+  typedef PointAttributeVectorOutputIterator<uint32_t> OutIt;
+  OutIt out_it(kd_tree_atts_);
+  std::vector<uint32_t> point(kd_tree_dimensionality_);
+  for (uint32_t i = 0; i < num_leaf_points; ++i) {
+    point.assign(level_points_.begin() + i * kd_tree_dimensionality_,
+                 level_points_.begin() + (i + 1) * kd_tree_dimensionality_);
+    *out_it = point;
+    ++out_it;
+  }
+  // Nodes that were not refined yet are represented by the centers of their
+  // cells. The centers are clamped to the range of the encoded values.
+  for (const KdTreeSubtreeRoot &node : level_nodes_) {
+    for (uint32_t c = 0; c < kd_tree_dimensionality_; ++c) {
+      const uint64_t cell_size = uint64_t(1)
+                                 << (kd_tree_bit_length_ - node.levels[c]);
+      const uint64_t center = node.base[c] + cell_size / 2;
+      point[c] = static_cast<uint32_t>(std::max<uint64_t>(
+          node.base[c], std::min<uint64_t>(center, level_max_values_[c])));
+    }
+    *out_it = point;
+    ++out_it;
+  }
+  GetDecoder()->point_cloud()->set_num_points(
+      static_cast<PointIndex::ValueType>(num_points));
+  return true;
+}
+
+bool KdTreeAttributesDecoder::DecodeMoreLevels(int max_depth,
+                                               DecoderBuffer *in_buffer) {
+  if (layout_ != kKdTreeProgressiveLayout) {
+    return false;
+  }
+  return DecodeLevels(max_depth, in_buffer) &&
+         TransformAttributesToOriginalFormat();
+}
+
 bool KdTreeAttributesDecoder::DecodeDataNeededByPortableTransforms(
     DecoderBuffer *in_buffer) {
   if (in_buffer->bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 3)) {
@@ -317,6 +875,14 @@ bool KdTreeAttributesDecoder::DecodeDataNeededByPortableTransforms(
       }
       min_signed_values_[i] = val;
     }
+    if (layout_ == kKdTreeProgressiveLayout) {
+      return DecodeLevels(
+          GetDecoder()->options()->GetGlobalInt("kd_tree_max_depth", -1),
+          in_buffer);
+    }
+    if (index_depth_ > 0) {
+      return DecodeIndexedPoints();
+    }
     return true;
   }
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
@@ -500,8 +1066,13 @@ bool KdTreeAttributesDecoder::TransformAttributesToOriginalFormat() {
   for (int i = 0; i < GetNumAttributes(); ++i) {
     const int att_id = GetAttributeId(i);
     PointAttribute *const att = GetDecoder()->point_cloud()->attribute(att_id);
-    if (att->data_type() == DT_INT32 || att->data_type() == DT_INT16 ||
-        att->data_type() == DT_INT8) {
+    const bool is_quantized =
+        num_processed_quantized_attributes <
+            static_cast<int>(quantized_attribute_ids_.size()) &&
+        quantized_attribute_ids_[num_processed_quantized_attributes] == att_id;
+    if (!is_quantized &&
+        (att->data_type() == DT_INT32 || att->data_type() == DT_INT16 ||
+         att->data_type() == DT_INT8)) {
       std::vector<uint32_t> unsigned_val(att->num_components());
       std::vector<int32_t> signed_val(att->num_components());
       // Values are stored as unsigned in the attribute, make them signed again.
@@ -522,11 +1093,11 @@ bool KdTreeAttributesDecoder::TransformAttributesToOriginalFormat() {
         }
       }
       num_processed_signed_components += att->num_components();
-    } else if (att->data_type() == DT_FLOAT32) {
+    } else if (is_quantized) {
       // TODO(ostava): This code should be probably moved out to attribute
       // transform and shared with the SequentialQuantizationAttributeDecoder.
 
-      const PointAttribute *const src_att =
+      PointAttribute *const src_att =
           quantized_portable_attributes_[num_processed_quantized_attributes]
               .get();
 
@@ -539,11 +1110,10 @@ bool KdTreeAttributesDecoder::TransformAttributesToOriginalFormat() {
       if (GetDecoder()->options()->GetAttributeBool(
               att->attribute_type(), "skip_attribute_transform", false)) {
         // Attribute transform should not be performed. In this case, we replace
-        // the output geometry attribute with the portable attribute.
-        // TODO(ostava): We can potentially avoid this copy by introducing a new
-        // mechanism that would allow to use the final attributes as portable
-        // attributes for predictors that may need them.
-        att->CopyFrom(*src_att);
+        // the output geometry attribute with the portable attribute. The
+        // portable attributes are not used by any predictors so their data can
+        // be moved.
+        att->MoveFrom(src_att);
         continue;
       }
 
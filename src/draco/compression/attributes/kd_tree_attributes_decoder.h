@@ -15,16 +15,61 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_DECODER_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_DECODER_H_
 
+#include <tuple>
+#include <vector>
+
 #include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/compression/attributes/attributes_decoder.h"
+#include "draco/compression/point_cloud/algorithms/point_cloud_types.h"
 
 namespace draco {
 
 // Decodes attributes encoded with the KdTreeAttributesEncoder.
+//
+// When the data was encoded with a subtree index, the decoder can be limited
+// to a subset of the points using the following global decoder options:
+//   "kd_tree_query_box" - Vector of 6 floats with the minimum and maximum
+//                         corners of a box. Only points whose position lies
+//                         in the box are decoded and subtrees outside of the
+//                         box are skipped without being decoded.
+//   "kd_tree_max_depth" - When it is not greater than the depth of the
+//                         index, each subtree of the index is represented by
+//                         a single decoded point.
+// The options are ignored for data encoded without the index.
+//
+// When the data was encoded with the progressive layout, the kd-tree is
+// decoded level by level and the "kd_tree_max_depth" option limits the number
+// of decoded levels. Each node of the tree at the maximum depth is represented
+// by a single point at the center of the node. See also
+// PointCloudKdTreeDecoder::DecodeProgressive().
 class KdTreeAttributesDecoder : public AttributesDecoder {
  public:
+  // attribute, offset_dimensionality, data_type, data_size, num_components
+  typedef std::tuple<PointAttribute *, uint32_t, DataType, uint32_t, uint32_t>
+      AttributeTuple;
+
   KdTreeAttributesDecoder();
 
+  // Allows decoding of partially received data encoded with the progressive
+  // layout. Levels of the kd-tree whose data is not fully available are left
+  // for DecodeMoreLevels() instead of failing the decoding. Data encoded with
+  // other layouts is rejected. Must be called before the attributes are
+  // decoded.
+  void EnableProgressiveDecoding() { allow_partial_levels_ = true; }
+
+  // Decodes more levels of the kd-tree encoded with the progressive layout up
+  // to |max_depth| (-1 for all levels) and updates the decoded attributes.
+  // |in_buffer| must start at the data of the first level that was not
+  // decoded yet.
+  bool DecodeMoreLevels(int max_depth, DecoderBuffer *in_buffer);
+
+  // Returns the number of levels of the kd-tree encoded with the progressive
+  // layout and the number of levels decoded so far.
+  int num_levels() const { return static_cast<int>(num_levels_); }
+  int num_decoded_levels() const {
+    return static_cast<int>(num_decoded_levels_);
+  }
+
  protected:
   bool DecodePortableAttributes(DecoderBuffer *in_buffer) override;
   bool DecodeDataNeededByPortableTransforms(DecoderBuffer *in_buffer) override;
@@ -35,6 +80,37 @@ class KdTreeAttributesDecoder : public AttributesDecoder {
   bool DecodePoints(int total_dimensionality, int num_expected_points,
                     DecoderBuffer *in_buffer, OutIteratorT *out_iterator);
 
+  // Decodes the top levels of a kd-tree encoded with a subtree index and
+  // locates the data of all subtrees in |in_buffer|.
+  template <int level_t>
+  bool DecodeSubtreeIndex(uint32_t index_depth, int num_points,
+                          DecoderBuffer *in_buffer);
+
+  // Decodes points of the kd-tree with the subtree index that were selected
+  // by the decoder options.
+  bool DecodeIndexedPoints();
+
+  // Decodes all subtrees that intersect the query box of |out_iterator|.
+  // At most |max_points_per_subtree| points are decoded from each subtree.
+  template <int level_t, typename OutIteratorT>
+  bool DecodeSubtrees(uint32_t max_points_per_subtree,
+                      OutIteratorT *out_iterator);
+
+  // Decodes the header of a kd-tree encoded with the progressive layout.
+  template <int level_t>
+  bool DecodeLevelsHeader(int num_points, DecoderBuffer *in_buffer);
+
+  // Decodes levels of the kd-tree encoded with the progressive layout up to
+  // |max_depth| and stores the decoded points in the attributes.
+  bool DecodeLevels(int max_depth, DecoderBuffer *in_buffer);
+
+  template <int level_t>
+  bool DecodeLevelsInternal(int max_depth, DecoderBuffer *in_buffer);
+
+  // Stores points of all decoded leaf nodes followed by one point for each
+  // node of the next level in the portable attributes.
+  bool StoreLevelPoints();
+
   template <typename SignedDataTypeT>
   bool TransformAttributeBackToSignedType(PointAttribute *att,
                                           int num_processed_signed_components);
@@ -43,6 +119,43 @@ class KdTreeAttributesDecoder : public AttributesDecoder {
       attribute_quantization_transforms_;
   std::vector<int32_t> min_signed_values_;
   std::vector<std::unique_ptr<PointAttribute>> quantized_portable_attributes_;
+  // Ids of the attributes that receive the values of the quantized portable
+  // attributes. Their data type is not DT_FLOAT32 anymore after the portable
+  // values were moved to them with skipped attribute transform.
+  std::vector<int> quantized_attribute_ids_;
+
+  // Encoded subtree of the kd-tree with the subtree index.
+  struct Subtree {
+    KdTreeSubtreeRoot root;
+    const char *data;
+    size_t size;
+  };
+
+  uint8_t layout_;
+
+  // Data of the kd-tree that is needed to decode the rest of the tree after
+  // the parameters of the portable transforms are known.
+  std::vector<AttributeTuple> kd_tree_atts_;
+  uint32_t kd_tree_dimensionality_;
+  uint8_t kd_tree_compression_level_;
+  uint32_t kd_tree_bit_length_;
+
+  // Subtree index layout.
+  uint32_t index_depth_;
+  // Points stored in the top levels of the tree.
+  std::vector<uint32_t> index_top_points_;
+  std::vector<Subtree> index_subtrees_;
+
+  // Progressive layout.
+  bool allow_partial_levels_;
+  uint32_t num_levels_;
+  uint32_t num_decoded_levels_;
+  // Maximum value of each component of the encoded points.
+  std::vector<uint32_t> level_max_values_;
+  // Nodes of the first level that was not decoded yet.
+  std::vector<KdTreeSubtreeRoot> level_nodes_;
+  // Points of all decoded leaf nodes.
+  std::vector<uint32_t> level_points_;
 };
 
 }  // namespace draco
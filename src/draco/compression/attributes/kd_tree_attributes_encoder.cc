@@ -23,6 +23,52 @@
 
 namespace draco {
 
+namespace {
+
+// Encodes |point_vector| using the kd-tree encoder with |level_t|. When
+// |index_depth| is greater than 0, the subtrees at |index_depth| are stored
+// after the top levels of the tree as independent blocks preceded by their
+// sizes (see KdTreeAttributesEncoder). When |out_level_buffers| is not null,
+// the tree is encoded level by level and the data of each level is stored in
+// |out_level_buffers| instead of |out_buffer|.
+template <int level_t>
+bool EncodeKdTreePoints(int num_components, int num_bits, int index_depth,
+                        PointDVector<uint32_t> *point_vector,
+                        EncoderBuffer *out_buffer,
+                        std::vector<EncoderBuffer> *out_level_buffers) {
+  DynamicIntegerPointsKdTreeEncoder<level_t> points_encoder(num_components);
+  if (out_level_buffers != nullptr) {
+    if (!points_encoder.EncodePointsByLevels(point_vector->begin(),
+                                             point_vector->end(), num_bits,
+                                             out_buffer, out_level_buffers)) {
+      return false;
+    }
+    EncodeVarint(static_cast<uint32_t>(out_level_buffers->size()), out_buffer);
+    return true;
+  }
+  if (index_depth == 0) {
+    return points_encoder.EncodePoints(point_vector->begin(),
+                                       point_vector->end(), num_bits,
+                                       out_buffer);
+  }
+  std::vector<EncoderBuffer> subtree_buffers;
+  if (!points_encoder.EncodePointsWithIndex(
+          point_vector->begin(), point_vector->end(), num_bits, index_depth,
+          out_buffer, &subtree_buffers)) {
+    return false;
+  }
+  EncodeVarint(static_cast<uint32_t>(subtree_buffers.size()), out_buffer);
+  for (const EncoderBuffer &subtree_buffer : subtree_buffers) {
+    EncodeVarint(static_cast<uint64_t>(subtree_buffer.size()), out_buffer);
+  }
+  for (const EncoderBuffer &subtree_buffer : subtree_buffers) {
+    out_buffer->Encode(subtree_buffer.data(), subtree_buffer.size());
+  }
+  return true;
+}
+
+}  // namespace
+
 KdTreeAttributesEncoder::KdTreeAttributesEncoder() : num_components_(0) {}
 
 KdTreeAttributesEncoder::KdTreeAttributesEncoder(int att_id)
@@ -122,6 +168,14 @@ bool KdTreeAttributesEncoder::EncodeDataNeededByPortableTransforms(
   for (int i = 0; i < min_signed_values_.size(); ++i) {
     EncodeVarint<int32_t>(min_signed_values_[i], out_buffer);
   }
+
+  // Levels of the progressive layout are stored last so that all data needed
+  // to decode them is available before the first level.
+  for (const EncoderBuffer &level_buffer : level_buffers_) {
+    EncodeVarint(static_cast<uint64_t>(level_buffer.size()), out_buffer);
+    out_buffer->Encode(level_buffer.data(), level_buffer.size());
+  }
+  level_buffers_.clear();
   return true;
 }
 
@@ -145,6 +199,33 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
 
   out_buffer->Encode(compression_level);
 
+  const int index_depth =
+      encoder()->options()->GetGlobalInt("kd_tree_index_depth", 0);
+  if (index_depth < 0 || index_depth > 255) {
+    return false;
+  }
+  const bool progressive =
+      encoder()->options()->GetGlobalBool("kd_tree_progressive", false);
+  if (progressive && index_depth > 0) {
+    // The subtree index and the progressive layout are mutually exclusive.
+    return false;
+  }
+  // The layout is encoded only in bitstream version 2.5 and newer, which is
+  // used only when a non-default layout is requested. Older versions always
+  // use the depth-first layout.
+  if (encoder()->GetBitstreamVersion() >= DRACO_BITSTREAM_VERSION(2, 5)) {
+    if (index_depth > 0) {
+      out_buffer->Encode(static_cast<uint8_t>(kKdTreeSubtreeIndexLayout));
+      out_buffer->Encode(static_cast<uint8_t>(index_depth));
+    } else if (progressive) {
+      out_buffer->Encode(static_cast<uint8_t>(kKdTreeProgressiveLayout));
+    } else {
+      out_buffer->Encode(static_cast<uint8_t>(kKdTreeDepthFirstLayout));
+    }
+  } else if (index_depth > 0 || progressive) {
+    return false;
+  }
+
   // Init PointDVector. The number of dimensions is equal to the total number
   // of dimensions across all attributes.
   const int num_points = encoder()->point_cloud()->num_points();
@@ -238,68 +319,55 @@ bool KdTreeAttributesEncoder::EncodePortableAttributes(
     }
   }
 
-  switch (compression_level) {
-    case 6: {
-      DynamicIntegerPointsKdTreeEncoder<6> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
-        return false;
-      }
-      break;
-    }
-    case 5: {
-      DynamicIntegerPointsKdTreeEncoder<5> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
-        return false;
-      }
-      break;
-    }
-    case 4: {
-      DynamicIntegerPointsKdTreeEncoder<4> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
-        return false;
-      }
-      break;
-    }
-    case 3: {
-      DynamicIntegerPointsKdTreeEncoder<3> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
-        return false;
-      }
-      break;
-    }
-    case 2: {
-      DynamicIntegerPointsKdTreeEncoder<2> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
-        return false;
-      }
-      break;
+  std::vector<EncoderBuffer> *level_buffers = nullptr;
+  if (progressive) {
+    // Store the maximum value of each component. The decoder uses them to
+    // keep the points representing partially decoded nodes within the range
+    // of the original values.
+    std::vector<uint32_t> max_values(num_components_, 0);
+    for (int i = 0; i < num_points * num_components_; ++i) {
+      max_values[i % num_components_] =
+          std::max(max_values[i % num_components_], data[i]);
     }
-    case 1: {
-      DynamicIntegerPointsKdTreeEncoder<1> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
-        return false;
-      }
-      break;
-    }
-    case 0: {
-      DynamicIntegerPointsKdTreeEncoder<0> points_encoder(num_components_);
-      if (!points_encoder.EncodePoints(point_vector.begin(), point_vector.end(),
-                                       num_bits, out_buffer)) {
-        return false;
-      }
-      break;
+    for (int c = 0; c < num_components_; ++c) {
+      EncodeVarint(max_values[c], out_buffer);
     }
+    level_buffers = &level_buffers_;
+  }
+
+  switch (compression_level) {
+    case 6:
+      return EncodeKdTreePoints<6>(num_components_, num_bits, index_depth,
+                                   &point_vector, out_buffer,
+                                   level_buffers);
+    case 5:
+      return EncodeKdTreePoints<5>(num_components_, num_bits, index_depth,
+                                   &point_vector, out_buffer,
+                                   level_buffers);
+    case 4:
+      return EncodeKdTreePoints<4>(num_components_, num_bits, index_depth,
+                                   &point_vector, out_buffer,
+                                   level_buffers);
+    case 3:
+      return EncodeKdTreePoints<3>(num_components_, num_bits, index_depth,
+                                   &point_vector, out_buffer,
+                                   level_buffers);
+    case 2:
+      return EncodeKdTreePoints<2>(num_components_, num_bits, index_depth,
+                                   &point_vector, out_buffer,
+                                   level_buffers);
+    case 1:
+      return EncodeKdTreePoints<1>(num_components_, num_bits, index_depth,
+                                   &point_vector, out_buffer,
+                                   level_buffers);
+    case 0:
+      return EncodeKdTreePoints<0>(num_components_, num_bits, index_depth,
+                                   &point_vector, out_buffer,
+                                   level_buffers);
     // Compression level and/or encoding speed seem wrong.
     default:
       return false;
   }
-  return true;
 }
 
 }  // namespace draco
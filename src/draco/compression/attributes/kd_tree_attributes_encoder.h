@@ -24,6 +24,18 @@ namespace draco {
 // Encodes all attributes of a given PointCloud using one of the available
 // Kd-tree compression methods.
 // See compression/point_cloud/point_cloud_kd_tree_encoder.h for more details.
+//
+// When the global option "kd_tree_index_depth" is greater than 0, only the top
+// levels of the kd-tree are encoded as a single stream. Every subtree rooted
+// at the index depth is encoded as a separate block and the sizes of all
+// blocks are stored before their data. This allows KdTreeAttributesDecoder to
+// skip subtrees that are not needed.
+//
+// When the global option "kd_tree_progressive" is set, the kd-tree is encoded
+// level by level in the breadth-first order. The data of each level is stored
+// as a separate block preceded by its size at the very end of the encoded
+// attributes so that a coarse point cloud can be decoded from the first levels
+// before the rest of the data is available.
 class KdTreeAttributesEncoder : public AttributesEncoder {
  public:
   KdTreeAttributesEncoder();
@@ -44,6 +56,8 @@ class KdTreeAttributesEncoder : public AttributesEncoder {
   std::vector<int32_t> min_signed_values_;
   std::vector<std::unique_ptr<PointAttribute>> quantized_portable_attributes_;
   int num_components_;
+  // Encoded levels of the kd-tree when the progressive layout is used.
+  std::vector<EncoderBuffer> level_buffers_;
 };
 
 }  // namespace draco
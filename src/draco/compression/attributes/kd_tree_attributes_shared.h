@@ -23,6 +23,18 @@ enum KdTreeAttributesEncodingMethod {
   kKdTreeIntegerEncoding
 };
 
+// Defines how the nodes of the kD-tree are stored in the bitstream (since
+// bitstream version 2.5).
+enum KdTreeLayout {
+  // All nodes are encoded in a single depth-first traversal of the tree.
+  kKdTreeDepthFirstLayout = 0,
+  // Subtrees rooted at a given depth are encoded as independent blocks.
+  kKdTreeSubtreeIndexLayout,
+  // Each level of the tree is encoded as a separate block in the
+  // breadth-first order.
+  kKdTreeProgressiveLayout,
+};
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ATTRIBUTES_KD_TREE_ATTRIBUTES_SHARED_H_
@@ -292,6 +292,7 @@ class OctahedronToolBox {
   int32_t max_quantized_value() const { return max_quantized_value_; }
   int32_t max_value() const { return max_value_; }
   int32_t center_value() const { return center_value_; }
+  float dequantization_scale() const { return dequantization_scale_; }
 
  private:
   inline void OctahedralCoordsToUnitVector(float in_s_scaled, float in_t_scaled,
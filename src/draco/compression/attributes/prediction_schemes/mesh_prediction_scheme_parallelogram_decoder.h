@@ -15,6 +15,9 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_PARALLELOGRAM_DECODER_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_MESH_PREDICTION_SCHEME_PARALLELOGRAM_DECODER_H_
 
+#include <algorithm>
+#include <vector>
+
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_decoder.h"
 #include "draco/compression/attributes/prediction_schemes/mesh_prediction_scheme_parallelogram_shared.h"
 
@@ -50,6 +53,19 @@ class MeshPredictionSchemeParallelogramDecoder
   bool IsInitialized() const override {
     return this->mesh_data().IsInitialized();
   }
+
+ private:
+  // Restores values of all entries starting from the second one using data
+  // entries resolved in advance. Each value is predicted from three entries
+  // |prediction_entries| starting at 3 * entry id, or from the previous value
+  // when the first of the entries is -1. |num_components_t| is the number of
+  // components known at compile time, or 0 when |num_components| should be
+  // used instead.
+  template <int num_components_t>
+  void ComputeOriginalValuesFromEntries(
+      const std::vector<int> &prediction_entries, const CorrType *in_corr,
+      DataTypeT *out_data, int num_entries, int num_components,
+      DataTypeT *pred_vals);
 };
 
 template <typename DataTypeT, class TransformT, class MeshDataT>
@@ -72,25 +88,66 @@ bool MeshPredictionSchemeParallelogramDecoder<DataTypeT, TransformT,
 
   const int corner_map_size =
       static_cast<int>(this->mesh_data().data_to_corner_map()->size());
+
+  // Resolve the entries used by the predictions of all values in a single pass
+  // over the connectivity so that the second pass that restores the values
+  // does not need to traverse the corner table.
+  std::vector<int> prediction_entries(3 * std::max(corner_map_size, 1));
   for (int p = 1; p < corner_map_size; ++p) {
     const CornerIndex corner_id = this->mesh_data().data_to_corner_map()->at(p);
-    const int dst_offset = p * num_components;
-    if (!ComputeParallelogramPrediction(p, corner_id, table,
-                                        *vertex_to_data_map, out_data,
-                                        num_components, pred_vals.get())) {
+    int *const entries = &prediction_entries[3 * p];
+    if (!GetParallelogramPredictionEntries(p, corner_id, table,
+                                           *vertex_to_data_map, &entries[0],
+                                           &entries[1], &entries[2])) {
       // Parallelogram could not be computed, Possible because some of the
       // vertices are not valid (not encoded yet).
+      entries[0] = -1;
+    }
+  }
+
+  if (num_components == 3) {
+    ComputeOriginalValuesFromEntries<3>(prediction_entries, in_corr, out_data,
+                                        corner_map_size, num_components,
+                                        pred_vals.get());
+  } else {
+    ComputeOriginalValuesFromEntries<0>(prediction_entries, in_corr, out_data,
+                                        corner_map_size, num_components,
+                                        pred_vals.get());
+  }
+  return true;
+}
+
+template <typename DataTypeT, class TransformT, class MeshDataT>
+template <int num_components_t>
+void MeshPredictionSchemeParallelogramDecoder<DataTypeT, TransformT,
+                                              MeshDataT>::
+    ComputeOriginalValuesFromEntries(const std::vector<int> &prediction_entries,
+                                     const CorrType *in_corr,
+                                     DataTypeT *out_data, int num_entries,
+                                     int num_components, DataTypeT *pred_vals) {
+  const int nc = num_components_t > 0 ? num_components_t : num_components;
+  for (int p = 1; p < num_entries; ++p) {
+    const int *const entries = &prediction_entries[3 * p];
+    const int dst_offset = p * nc;
+    if (entries[0] < 0) {
       // We use the last encoded point as a reference (delta coding).
-      const int src_offset = (p - 1) * num_components;
+      const int src_offset = (p - 1) * nc;
       this->transform().ComputeOriginalValue(
           out_data + src_offset, in_corr + dst_offset, out_data + dst_offset);
-    } else {
-      // Apply the parallelogram prediction.
-      this->transform().ComputeOriginalValue(
-          pred_vals.get(), in_corr + dst_offset, out_data + dst_offset);
+      continue;
+    }
+    // Apply the parallelogram prediction.
+    const DataTypeT *const opp_vals = out_data + entries[0] * nc;
+    const DataTypeT *const next_vals = out_data + entries[1] * nc;
+    const DataTypeT *const prev_vals = out_data + entries[2] * nc;
+    for (int c = 0; c < nc; ++c) {
+      const int64_t result =
+          (static_cast<int64_t>(next_vals[c]) + prev_vals[c]) - opp_vals[c];
+      pred_vals[c] = static_cast<DataTypeT>(result);
     }
+    this->transform().ComputeOriginalValue(pred_vals, in_corr + dst_offset,
+                                           out_data + dst_offset);
   }
-  return true;
 }
 
 }  // namespace draco
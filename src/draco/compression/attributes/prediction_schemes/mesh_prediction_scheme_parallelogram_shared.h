@@ -37,6 +37,26 @@ inline void GetParallelogramEntries(
   *prev_entry = vertex_to_data_map[table->Vertex(table->Previous(ci)).value()];
 }
 
+// Finds data entries used by the parallelogram prediction of a given corner
+// and data entry id. Function returns false when the prediction couldn't be
+// computed, e.g. because not all entry points were available. The entries do
+// not depend on the attribute values so they can be resolved before any value
+// is decoded.
+template <class CornerTableT>
+inline bool GetParallelogramPredictionEntries(
+    int data_entry_id, const CornerIndex ci, const CornerTableT *table,
+    const std::vector<int32_t> &vertex_to_data_map, int *opp_entry,
+    int *next_entry, int *prev_entry) {
+  const CornerIndex oci = table->Opposite(ci);
+  if (oci == kInvalidCornerIndex) {
+    return false;
+  }
+  GetParallelogramEntries<CornerTableT>(oci, table, vertex_to_data_map,
+                                        opp_entry, next_entry, prev_entry);
+  return *opp_entry < data_entry_id && *next_entry < data_entry_id &&
+         *prev_entry < data_entry_id;
+}
+
 // Computes parallelogram prediction for a given corner and data entry id.
 // The prediction is stored in |out_prediction|.
 // Function returns false when the prediction couldn't be computed, e.g. because
@@ -46,15 +66,10 @@ inline bool ComputeParallelogramPrediction(
     int data_entry_id, const CornerIndex ci, const CornerTableT *table,
     const std::vector<int32_t> &vertex_to_data_map, const DataTypeT *in_data,
     int num_components, DataTypeT *out_prediction) {
-  const CornerIndex oci = table->Opposite(ci);
-  if (oci == kInvalidCornerIndex) {
-    return false;
-  }
   int vert_opp, vert_next, vert_prev;
-  GetParallelogramEntries<CornerTableT>(oci, table, vertex_to_data_map,
-                                        &vert_opp, &vert_next, &vert_prev);
-  if (vert_opp < data_entry_id && vert_next < data_entry_id &&
-      vert_prev < data_entry_id) {
+  if (GetParallelogramPredictionEntries<CornerTableT>(
+          data_entry_id, ci, table, vertex_to_data_map, &vert_opp, &vert_next,
+          &vert_prev)) {
     // Apply the parallelogram prediction.
     const int v_opp_off = vert_opp * num_components;
     const int v_next_off = vert_next * num_components;
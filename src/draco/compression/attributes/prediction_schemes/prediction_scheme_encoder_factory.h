@@ -101,7 +101,7 @@ CreatePredictionSchemeForEncoder(PredictionSchemeMethod method, int att_id,
     // template nature of the prediction schemes).
     const MeshEncoder *const mesh_encoder =
         static_cast<const MeshEncoder *>(encoder);
-    const uint16_t bitstream_version = kDracoMeshBitstreamVersion;
+    const uint16_t bitstream_version = encoder->GetBitstreamVersion();
     auto ret = CreateMeshPredictionScheme<
         MeshEncoder, PredictionSchemeEncoder<DataTypeT, TransformT>,
         MeshPredictionSchemeEncoderFactory<DataTypeT>>(
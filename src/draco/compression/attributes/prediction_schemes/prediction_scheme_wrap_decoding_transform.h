@@ -15,6 +15,8 @@
 #ifndef DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_WRAP_DECODING_TRANSFORM_H_
 #define DRACO_COMPRESSION_ATTRIBUTES_PREDICTION_SCHEMES_PREDICTION_SCHEME_WRAP_DECODING_TRANSFORM_H_
 
+#include <algorithm>
+
 #include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_transform_base.h"
 #include "draco/core/decoder_buffer.h"
 
@@ -44,6 +46,11 @@ class PredictionSchemeWrapDecodingTransform
     static_assert(std::is_same<DataTypeT, int32_t>::value,
                   "Only int32_t is supported for predicted values.");
 
+    if (this->num_components() == 3) {
+      ComputeOriginalValue3(predicted_vals, corr_vals, out_original_vals);
+      return;
+    }
+
     predicted_vals = this->ClampPredictedValue(predicted_vals);
 
     // Perform the wrapping using unsigned coordinates to avoid potential signed
@@ -63,6 +70,29 @@ class PredictionSchemeWrapDecodingTransform
     }
   }
 
+  // Specialization of ComputeOriginalValue() for the common case of three
+  // components (e.g. positions). The values are clamped and unwrapped using
+  // selects instead of branches and without the temporary storage of the
+  // clamped prediction.
+  inline void ComputeOriginalValue3(const DataTypeT *predicted_vals,
+                                    const CorrTypeT *corr_vals,
+                                    DataTypeT *out_original_vals) const {
+    const DataTypeT min_value = this->min_value();
+    const DataTypeT max_value = this->max_value();
+    const uint32_t max_dif = static_cast<uint32_t>(this->max_dif());
+    for (int i = 0; i < 3; ++i) {
+      const DataTypeT clamped_val =
+          std::min(std::max(predicted_vals[i], min_value), max_value);
+      uint32_t val = static_cast<uint32_t>(clamped_val) +
+                     static_cast<uint32_t>(corr_vals[i]);
+      const DataTypeT signed_val = static_cast<DataTypeT>(val);
+      // At most one of the conditions can be true because min <= max.
+      val -= signed_val > max_value ? max_dif : 0;
+      val += signed_val < min_value ? max_dif : 0;
+      out_original_vals[i] = static_cast<DataTypeT>(val);
+    }
+  }
+
   bool DecodeTransformData(DecoderBuffer *buffer) {
     DataTypeT min_value, max_value;
     if (!buffer->Decode(&min_value)) {
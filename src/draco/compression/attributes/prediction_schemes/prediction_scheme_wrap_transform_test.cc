@@ -0,0 +1,76 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <vector>
+
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_decoding_transform.h"
+#include "draco/compression/attributes/prediction_schemes/prediction_scheme_wrap_encoding_transform.h"
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+class PredictionSchemeWrapTransformTest : public ::testing::Test {
+ protected:
+  typedef draco::PredictionSchemeWrapEncodingTransform<int32_t>
+      EncodingTransform;
+  typedef draco::PredictionSchemeWrapDecodingTransform<int32_t>
+      DecodingTransform;
+
+  // Initializes |transform| with the range of |values| using the encoding
+  // transform.
+  void InitDecodingTransform(const std::vector<int32_t> &values,
+                             int num_components, DecodingTransform *transform) {
+    EncodingTransform encoding_transform;
+    encoding_transform.Init(values.data(), static_cast<int>(values.size()),
+                            num_components);
+    draco::EncoderBuffer buffer;
+    ASSERT_TRUE(encoding_transform.EncodeTransformData(&buffer));
+    draco::DecoderBuffer in_buffer;
+    in_buffer.Init(buffer.data(), buffer.size());
+    ASSERT_TRUE(transform->DecodeTransformData(&in_buffer));
+    transform->Init(num_components);
+  }
+};
+
+TEST_F(PredictionSchemeWrapTransformTest, ThreeComponents) {
+  // Values of three components are restored the same way as values processed
+  // one component at a time, including predictions out of the value range.
+  const std::vector<int32_t> values = {-7, 0, 3, 12, 25, -1, 4, 8, 9};
+  const std::vector<int32_t> predictions = {-40, 0, 3, 13, 100, -8, 4, 30, -9};
+  EncodingTransform encoding_transform;
+  encoding_transform.Init(values.data(), static_cast<int>(values.size()), 3);
+  std::vector<int32_t> corrections(values.size());
+  for (int i = 0; i < values.size(); i += 3) {
+    encoding_transform.ComputeCorrection(&values[i], &predictions[i],
+                                         &corrections[i]);
+  }
+
+  DecodingTransform transform_3;
+  InitDecodingTransform(values, 3, &transform_3);
+  DecodingTransform transform_1;
+  InitDecodingTransform(values, 1, &transform_1);
+  for (int i = 0; i < values.size(); i += 3) {
+    int32_t out_3[3];
+    transform_3.ComputeOriginalValue(&predictions[i], &corrections[i], out_3);
+    for (int c = 0; c < 3; ++c) {
+      int32_t out_1;
+      transform_1.ComputeOriginalValue(&predictions[i + c],
+                                       &corrections[i + c], &out_1);
+      ASSERT_EQ(out_3[c], out_1);
+      ASSERT_EQ(out_3[c], values[i + c]);
+    }
+  }
+}
+
+}  // namespace
@@ -17,7 +17,10 @@
 namespace draco {
 
 SequentialAttributeDecoder::SequentialAttributeDecoder()
-    : decoder_(nullptr), attribute_(nullptr), attribute_id_(-1) {}
+    : decoder_(nullptr),
+      attribute_(nullptr),
+      attribute_id_(-1),
+      deferred_decoding_(false) {}
 
 bool SequentialAttributeDecoder::Init(PointCloudDecoder *decoder,
                                       int attribute_id) {
@@ -72,6 +75,15 @@ const PointAttribute *SequentialAttributeDecoder::GetPortableAttribute() {
   return portable_attribute_.get();
 }
 
+void SequentialAttributeDecoder::MovePortableAttributeToAttribute() {
+  // Make sure the portable attribute has the point mapping of the output
+  // attribute.
+  if (GetPortableAttribute() == nullptr) {
+    return;
+  }
+  attribute_->MoveFrom(portable_attribute_.get());
+}
+
 bool SequentialAttributeDecoder::InitPredictionScheme(
     PredictionSchemeInterface *ps) {
   for (int i = 0; i < ps->GetNumParentAttributes(); ++i) {
@@ -80,6 +92,7 @@ bool SequentialAttributeDecoder::InitPredictionScheme(
     if (att_id == -1) {
       return false;  // Requested attribute does not exist.
     }
+    parent_attribute_ids_.push_back(att_id);
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
     if (decoder_->bitstream_version() < DRACO_BITSTREAM_VERSION(2, 0)) {
       if (!ps->SetParentAttribute(decoder_->point_cloud()->attribute(att_id))) {
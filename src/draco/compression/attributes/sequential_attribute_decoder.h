@@ -43,13 +43,40 @@ class SequentialAttributeDecoder {
   virtual bool DecodeDataNeededByPortableTransform(
       const std::vector<PointIndex> &point_ids, DecoderBuffer *in_buffer);
 
+  // Completes the decoding of the portable attribute data when the decoder
+  // works in the deferred mode (see set_deferred_decoding()). Portable data of
+  // all parent attributes must be fully decoded before this method is called.
+  virtual bool FinishDecodingPortableAttribute(
+      const std::vector<PointIndex> &point_ids) {
+    return true;
+  }
+
   // Reverts transformation performed by encoder in
   // SequentialAttributeEncoder::TransformAttributeToPortableFormat() method.
   virtual bool TransformAttributeToOriginalFormat(
       const std::vector<PointIndex> &point_ids);
 
+  // When enabled, DecodePortableAttribute() only parses the input buffer and
+  // any work that does not need to access the buffer (such as reverting of
+  // the prediction scheme) is postponed until FinishDecodingPortableAttribute()
+  // is called. This allows the caller to finish decoding of independent
+  // attributes concurrently.
+  void set_deferred_decoding(bool deferred) { deferred_decoding_ = deferred; }
+  bool deferred_decoding() const { return deferred_decoding_; }
+
+  // Returns ids of all attributes whose portable data is used by the
+  // prediction scheme of this attribute.
+  const std::vector<int32_t> &parent_attribute_ids() const {
+    return parent_attribute_ids_;
+  }
+
   const PointAttribute *GetPortableAttribute();
 
+  // Replaces the output attribute with the portable attribute. The data of the
+  // portable attribute is moved so the portable attribute can't be used
+  // afterwards.
+  void MovePortableAttributeToAttribute();
+
   const PointAttribute *attribute() const { return attribute_; }
   PointAttribute *attribute() { return attribute_; }
   int attribute_id() const { return attribute_id_; }
@@ -76,6 +103,8 @@ class SequentialAttributeDecoder {
   PointCloudDecoder *decoder_;
   PointAttribute *attribute_;
   int attribute_id_;
+  bool deferred_decoding_;
+  std::vector<int32_t> parent_attribute_ids_;
 
   // Storage for decoded portable attribute (after lossless decoding).
   std::unique_ptr<PointAttribute> portable_attribute_;
@@ -52,6 +52,34 @@ bool SequentialAttributeDecodersController::DecodeAttributesDecoderData(
 
 bool SequentialAttributeDecodersController::DecodeAttributes(
     DecoderBuffer *buffer) {
+  if (!InitializePointSequence()) {
+    return false;
+  }
+  return AttributesDecoder::DecodeAttributes(buffer);
+}
+
+bool SequentialAttributeDecodersController::DecodeAttributesDeferred(
+    DecoderBuffer *buffer) {
+  if (!InitializePointSequence()) {
+    return false;
+  }
+  for (auto &sequential_decoder : sequential_decoders_) {
+    sequential_decoder->set_deferred_decoding(true);
+  }
+  if (!DecodePortableAttributes(buffer)) {
+    return false;
+  }
+  return DecodeDataNeededByPortableTransforms(buffer);
+}
+
+bool SequentialAttributeDecodersController::FinalizeAttribute(int i) {
+  if (!sequential_decoders_[i]->FinishDecodingPortableAttribute(point_ids_)) {
+    return false;
+  }
+  return TransformAttributeToOriginalFormat(i);
+}
+
+bool SequentialAttributeDecodersController::InitializePointSequence() {
   if (!sequencer_ || !sequencer_->GenerateSequence(&point_ids_)) {
     return false;
   }
@@ -64,7 +92,7 @@ bool SequentialAttributeDecodersController::DecodeAttributes(
       return false;
     }
   }
-  return AttributesDecoder::DecodeAttributes(buffer);
+  return true;
 }
 
 bool SequentialAttributeDecodersController::DecodePortableAttributes(
@@ -95,32 +123,48 @@ bool SequentialAttributeDecodersController::
     TransformAttributesToOriginalFormat() {
   const int32_t num_attributes = GetNumAttributes();
   for (int i = 0; i < num_attributes; ++i) {
-    // Check whether the attribute transform should be skipped.
-    if (GetDecoder()->options()) {
-      const PointAttribute *const attribute =
-          sequential_decoders_[i]->attribute();
-      const PointAttribute *const portable_attribute =
-          sequential_decoders_[i]->GetPortableAttribute();
-      if (portable_attribute &&
-          GetDecoder()->options()->GetAttributeBool(
-              attribute->attribute_type(), "skip_attribute_transform", false)) {
-        // Attribute transform should not be performed. In this case, we replace
-        // the output geometry attribute with the portable attribute.
-        // TODO(ostava): We can potentially avoid this copy by introducing a new
-        // mechanism that would allow to use the final attributes as portable
-        // attributes for predictors that may need them.
-        sequential_decoders_[i]->attribute()->CopyFrom(*portable_attribute);
-        continue;
-      }
-    }
-    if (!sequential_decoders_[i]->TransformAttributeToOriginalFormat(
-            point_ids_)) {
+    if (!TransformAttributeToOriginalFormat(i)) {
       return false;
     }
   }
   return true;
 }
 
+bool SequentialAttributeDecodersController::TransformAttributeToOriginalFormat(
+    int i) {
+  if (SkipAttributeTransform(i)) {
+    // The portable attribute is moved to the output geometry attribute in
+    // OnAllAttributesDecoded() once it is no longer needed by predictors of
+    // other attributes.
+    return true;
+  }
+  return sequential_decoders_[i]->TransformAttributeToOriginalFormat(
+      point_ids_);
+}
+
+bool SequentialAttributeDecodersController::OnAllAttributesDecoded() {
+  const int32_t num_attributes = GetNumAttributes();
+  for (int i = 0; i < num_attributes; ++i) {
+    if (!SkipAttributeTransform(i)) {
+      continue;
+    }
+    // Attribute transform should not be performed. In this case, we replace
+    // the output geometry attribute with the portable attribute.
+    sequential_decoders_[i]->MovePortableAttributeToAttribute();
+  }
+  return true;
+}
+
+bool SequentialAttributeDecodersController::SkipAttributeTransform(int i) {
+  if (!GetDecoder()->options()) {
+    return false;
+  }
+  const PointAttribute *const attribute = sequential_decoders_[i]->attribute();
+  return sequential_decoders_[i]->GetPortableAttribute() != nullptr &&
+         GetDecoder()->options()->GetAttributeBool(
+             attribute->attribute_type(), "skip_attribute_transform", false);
+}
+
 std::unique_ptr<SequentialAttributeDecoder>
 SequentialAttributeDecodersController::CreateSequentialDecoder(
     uint8_t decoder_type) {
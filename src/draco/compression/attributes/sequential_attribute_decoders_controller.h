@@ -34,6 +34,12 @@ class SequentialAttributeDecodersController : public AttributesDecoder {
 
   bool DecodeAttributesDecoderData(DecoderBuffer *buffer) override;
   bool DecodeAttributes(DecoderBuffer *buffer) override;
+  bool DecodeAttributesDeferred(DecoderBuffer *buffer) override;
+  bool FinalizeAttribute(int i) override;
+  bool OnAllAttributesDecoded() override;
+  std::vector<int32_t> GetParentAttributeIds(int i) const override {
+    return sequential_decoders_[i]->parent_attribute_ids();
+  }
   const PointAttribute *GetPortableAttribute(
       int32_t point_attribute_id) override {
     const int32_t loc_id = GetLocalIdForPointAttribute(point_attribute_id);
@@ -51,6 +57,18 @@ class SequentialAttributeDecodersController : public AttributesDecoder {
       uint8_t decoder_type);
 
  private:
+  // Generates the sequence of decoded points and initializes point to
+  // attribute value mapping of all decoded attributes.
+  bool InitializePointSequence();
+
+  // Reverts the portable transform of the i-th attribute (unless it should be
+  // skipped according to the decoder options).
+  bool TransformAttributeToOriginalFormat(int i);
+
+  // Returns true when the output of the i-th attribute should contain the
+  // portable attribute data according to the decoder options.
+  bool SkipAttributeTransform(int i);
+
   std::vector<std::unique_ptr<SequentialAttributeDecoder>> sequential_decoders_;
   std::vector<PointIndex> point_ids_;
   std::unique_ptr<PointsSequencer> sequencer_;
@@ -13,11 +13,15 @@
 // limitations under the License.
 //
 #include "draco/compression/attributes/sequential_attribute_encoders_controller.h"
+
+#include <algorithm>
+
 #ifdef DRACO_NORMAL_ENCODING_SUPPORTED
 #include "draco/compression/attributes/sequential_normal_attribute_encoder.h"
 #endif
 #include "draco/compression/attributes/sequential_quantization_attribute_encoder.h"
 #include "draco/compression/point_cloud/point_cloud_encoder.h"
+#include "draco/core/thread_pool.h"
 
 namespace draco {
 
@@ -69,6 +73,22 @@ bool SequentialAttributeEncodersController::EncodeAttributes(
 
 bool SequentialAttributeEncodersController::
     TransformAttributesToPortableFormat() {
+  // Transforms of individual attributes are independent of each other.
+  const int num_threads = GetNumEncodingThreads();
+  if (num_threads > 1) {
+    std::vector<uint8_t> transformed(sequential_encoders_.size(), 0);
+    ThreadPool thread_pool(num_threads);
+    for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
+      SequentialAttributeEncoder *const seq_enc = sequential_encoders_[i].get();
+      thread_pool.Schedule([this, seq_enc, &transformed, i]() {
+        transformed[i] =
+            seq_enc->TransformAttributeToPortableFormat(point_ids_);
+      });
+    }
+    thread_pool.Wait();
+    return std::find(transformed.begin(), transformed.end(), 0) ==
+           transformed.end();
+  }
   for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
     if (!sequential_encoders_[i]->TransformAttributeToPortableFormat(
             point_ids_)) {
@@ -80,6 +100,33 @@ bool SequentialAttributeEncodersController::
 
 bool SequentialAttributeEncodersController::EncodePortableAttributes(
     EncoderBuffer *out_buffer) {
+  // All portable attributes are available at this point so the attributes can
+  // be encoded in any order, including the attributes predicted from their
+  // parents. Each attribute is encoded into a separate buffer and the buffers
+  // are then concatenated in the original order.
+  const int num_threads = GetNumEncodingThreads();
+  if (num_threads > 1) {
+    std::vector<EncoderBuffer> buffers(sequential_encoders_.size());
+    std::vector<uint8_t> encoded(sequential_encoders_.size(), 0);
+    ThreadPool thread_pool(num_threads);
+    for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
+      SequentialAttributeEncoder *const seq_enc = sequential_encoders_[i].get();
+      EncoderBuffer *const buffer = &buffers[i];
+      thread_pool.Schedule([this, seq_enc, buffer, &encoded, i]() {
+        encoded[i] = seq_enc->EncodePortableAttribute(point_ids_, buffer);
+      });
+    }
+    thread_pool.Wait();
+    for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
+      if (!encoded[i]) {
+        return false;
+      }
+      if (!out_buffer->Encode(buffers[i].data(), buffers[i].size())) {
+        return false;
+      }
+    }
+    return true;
+  }
   for (uint32_t i = 0; i < sequential_encoders_.size(); ++i) {
     if (!sequential_encoders_[i]->EncodePortableAttribute(point_ids_,
                                                           out_buffer)) {
@@ -100,6 +147,15 @@ bool SequentialAttributeEncodersController::
   return true;
 }
 
+int SequentialAttributeEncodersController::GetNumEncodingThreads() const {
+  if (encoder() == nullptr || sequential_encoders_.size() < 2) {
+    return 1;
+  }
+  const int num_threads =
+      encoder()->options()->GetGlobalInt("num_encoding_threads", 1);
+  return std::min(num_threads, static_cast<int>(sequential_encoders_.size()));
+}
+
 bool SequentialAttributeEncodersController::CreateSequentialEncoders() {
   sequential_encoders_.resize(num_attributes());
   for (uint32_t i = 0; i < num_attributes(); ++i) {
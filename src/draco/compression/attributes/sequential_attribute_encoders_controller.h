@@ -101,6 +101,10 @@ class SequentialAttributeEncodersController : public AttributesEncoder {
       int i);
 
  private:
+  // Returns the number of threads that should be used to process the
+  // sequential encoders.
+  int GetNumEncodingThreads() const;
+
   std::vector<std::unique_ptr<SequentialAttributeEncoder>> sequential_encoders_;
 
   // Flag for each sequential attribute encoder indicating whether it was marked
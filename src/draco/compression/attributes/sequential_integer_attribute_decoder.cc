@@ -122,8 +122,10 @@ bool SequentialIntegerAttributeDecoder::DecodeIntegerValues(
   }
   if (compressed > 0) {
     // Decode compressed values.
+    const bool allow_interleaved =
+        decoder() && decoder()->IsInterleavedSymbolCodingSupported();
     if (!DecodeSymbols(static_cast<uint32_t>(num_values), num_components,
-                       in_buffer,
+                       allow_interleaved, in_buffer,
                        reinterpret_cast<uint32_t *>(portable_attribute_data))) {
       return false;
     }
@@ -160,8 +162,33 @@ bool SequentialIntegerAttributeDecoder::DecodeIntegerValues(
     }
   }
 
-  if (num_values > 0 && (prediction_scheme_ == nullptr ||
-                         !prediction_scheme_->AreCorrectionsPositive())) {
+  // Prediction data is decoded before the values are converted back to their
+  // original format so that all reads from |in_buffer| are done before the
+  // (possibly deferred) computation of the portable values.
+  if (prediction_scheme_) {
+    if (!prediction_scheme_->DecodePredictionData(in_buffer)) {
+      return false;
+    }
+  }
+  if (deferred_decoding()) {
+    return true;
+  }
+  return FinishDecodingPortableAttribute(point_ids);
+}
+
+bool SequentialIntegerAttributeDecoder::FinishDecodingPortableAttribute(
+    const std::vector<PointIndex> &point_ids) {
+  const int num_components = GetNumValueComponents();
+  const size_t num_values = point_ids.size() * num_components;
+  if (num_values == 0) {
+    return true;
+  }
+  int32_t *const portable_attribute_data = GetPortableAttributeData();
+  if (portable_attribute_data == nullptr) {
+    return false;
+  }
+  if (prediction_scheme_ == nullptr ||
+      !prediction_scheme_->AreCorrectionsPositive()) {
     // Convert the values back to the original signed format.
     ConvertSymbolsToSignedInts(
         reinterpret_cast<const uint32_t *>(portable_attribute_data),
@@ -170,17 +197,11 @@ bool SequentialIntegerAttributeDecoder::DecodeIntegerValues(
 
   // If the data was encoded with a prediction scheme, we must revert it.
   if (prediction_scheme_) {
-    if (!prediction_scheme_->DecodePredictionData(in_buffer)) {
+    if (!prediction_scheme_->ComputeOriginalValues(
+            portable_attribute_data, portable_attribute_data,
+            static_cast<int>(num_values), num_components, point_ids.data())) {
       return false;
     }
-
-    if (num_values > 0) {
-      if (!prediction_scheme_->ComputeOriginalValues(
-              portable_attribute_data, portable_attribute_data,
-              static_cast<int>(num_values), num_components, point_ids.data())) {
-        return false;
-      }
-    }
   }
   return true;
 }
@@ -27,6 +27,8 @@ class SequentialIntegerAttributeDecoder : public SequentialAttributeDecoder {
   SequentialIntegerAttributeDecoder();
   bool Init(PointCloudDecoder *decoder, int attribute_id) override;
 
+  bool FinishDecodingPortableAttribute(
+      const std::vector<PointIndex> &point_ids) override;
   bool TransformAttributeToOriginalFormat(
       const std::vector<PointIndex> &point_ids) override;
 
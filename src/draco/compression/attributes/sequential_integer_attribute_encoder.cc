@@ -160,6 +160,10 @@ bool SequentialIntegerAttributeEncoder::EncodeValues(
     if (encoder() != nullptr) {
       SetSymbolEncodingCompressionLevel(&symbol_encoding_options,
                                         10 - encoder()->options()->GetSpeed());
+      SetSymbolEncodingInterleaving(
+          &symbol_encoding_options,
+          encoder()->options()->GetGlobalBool("interleaved_symbol_coding",
+                                              false));
     }
     if (!EncodeSymbols(reinterpret_cast<uint32_t *>(encoded_data.data()),
                        static_cast<int>(point_ids.size()) * num_components,
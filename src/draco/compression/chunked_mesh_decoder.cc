@@ -0,0 +1,151 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/chunked_mesh_decoder.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/decode.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_decoding.h"
+
+namespace draco {
+
+ChunkedMeshDecoder::ChunkedMeshDecoder() : num_threads_(1) {}
+
+bool ChunkedMeshDecoder::IsChunkedMesh(const DecoderBuffer &in_buffer) {
+  return in_buffer.remaining_size() >= kChunkedMeshMagicLength &&
+         memcmp(in_buffer.data_head(), kChunkedMeshMagic,
+                kChunkedMeshMagicLength) == 0;
+}
+
+Status ChunkedMeshDecoder::DecodeChunkIndex(DecoderBuffer *in_buffer) {
+  chunks_.clear();
+  if (!IsChunkedMesh(*in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Not a chunked Draco mesh.");
+  }
+  in_buffer->Advance(kChunkedMeshMagicLength);
+  uint8_t version_major, version_minor;
+  if (!in_buffer->Decode(&version_major) ||
+      !in_buffer->Decode(&version_minor)) {
+    return Status(Status::IO_ERROR, "Failed to parse chunked mesh header.");
+  }
+  if (version_major != kChunkedMeshVersionMajor) {
+    return Status(Status::UNKNOWN_VERSION,
+                  "Unknown chunked mesh major version.");
+  }
+  uint32_t num_chunks;
+  if (!DecodeVarint(&num_chunks, in_buffer)) {
+    return Status(Status::IO_ERROR, "Failed to decode the number of chunks.");
+  }
+  // Each chunk entry takes at least 26 bytes of the index.
+  if (num_chunks > in_buffer->remaining_size() / 26) {
+    return Status(Status::DRACO_ERROR, "Invalid number of chunks.");
+  }
+  std::vector<ChunkInfo> chunks(num_chunks);
+  for (ChunkInfo &chunk : chunks) {
+    Vector3f min_point, max_point;
+    uint32_t num_faces;
+    uint64_t size;
+    if (!in_buffer->Decode(&min_point[0], 3 * sizeof(float)) ||
+        !in_buffer->Decode(&max_point[0], 3 * sizeof(float)) ||
+        !DecodeVarint(&num_faces, in_buffer) ||
+        !DecodeVarint(&size, in_buffer)) {
+      return Status(Status::IO_ERROR, "Failed to decode the chunk index.");
+    }
+    chunk.bounding_box = BoundingBox(min_point, max_point);
+    chunk.num_faces = static_cast<int>(num_faces);
+    chunk.size = static_cast<size_t>(size);
+  }
+  for (ChunkInfo &chunk : chunks) {
+    if (chunk.size > static_cast<uint64_t>(in_buffer->remaining_size())) {
+      return Status(Status::IO_ERROR, "Chunk data out of bounds.");
+    }
+    chunk.data = in_buffer->data_head();
+    in_buffer->Advance(chunk.size);
+  }
+  chunks_ = std::move(chunks);
+  return OkStatus();
+}
+
+std::vector<int> ChunkedMeshDecoder::FindChunksIntersecting(
+    const BoundingBox &bounding_box) const {
+  std::vector<int> chunk_ids;
+  for (int i = 0; i < num_chunks(); ++i) {
+    if (chunks_[i].bounding_box.Intersects(bounding_box)) {
+      chunk_ids.push_back(i);
+    }
+  }
+  return chunk_ids;
+}
+
+StatusOr<std::unique_ptr<Mesh>> ChunkedMeshDecoder::DecodeChunk(
+    int chunk_id) const {
+  if (chunk_id < 0 || chunk_id >= num_chunks()) {
+    return Status(Status::DRACO_ERROR, "Invalid chunk id.");
+  }
+  DecoderBuffer buffer;
+  buffer.Init(chunks_[chunk_id].data, chunks_[chunk_id].size);
+  Decoder decoder;
+  *decoder.options() = options_;
+  return decoder.DecodeMeshFromBuffer(&buffer);
+}
+
+StatusOr<ChunkedMeshDecoder::MeshVector> ChunkedMeshDecoder::DecodeChunks(
+    const std::vector<int> &chunk_ids) const {
+  const int num_decoded_chunks = static_cast<int>(chunk_ids.size());
+  MeshVector meshes(num_decoded_chunks);
+  std::vector<Status> statuses(num_decoded_chunks);
+  {
+    ThreadPool thread_pool(
+        std::min(num_threads_, std::max(num_decoded_chunks, 1)));
+    for (int i = 0; i < num_decoded_chunks; ++i) {
+      const int chunk_id = chunk_ids[i];
+      std::unique_ptr<Mesh> *const mesh = &meshes[i];
+      Status *const status = &statuses[i];
+      thread_pool.Schedule([this, chunk_id, mesh, status]() {
+        StatusOr<std::unique_ptr<Mesh>> statusor = DecodeChunk(chunk_id);
+        if (!statusor.ok()) {
+          *status = statusor.status();
+          return;
+        }
+        *mesh = std::move(statusor).value();
+      });
+    }
+  }
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+  return std::move(meshes);
+}
+
+StatusOr<ChunkedMeshDecoder::MeshVector> ChunkedMeshDecoder::DecodeAllChunks()
+    const {
+  std::vector<int> chunk_ids(num_chunks());
+  for (int i = 0; i < num_chunks(); ++i) {
+    chunk_ids[i] = i;
+  }
+  return DecodeChunks(chunk_ids);
+}
+
+StatusOr<ChunkedMeshDecoder::MeshVector>
+ChunkedMeshDecoder::DecodeChunksIntersecting(
+    const BoundingBox &bounding_box) const {
+  return DecodeChunks(FindChunksIntersecting(bounding_box));
+}
+
+}  // namespace draco
@@ -0,0 +1,100 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_CHUNKED_MESH_DECODER_H_
+#define DRACO_COMPRESSION_CHUNKED_MESH_DECODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/compression/config/decoder_options.h"
+#include "draco/core/bounding_box.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Class for decoding meshes encoded by ChunkedMeshEncoder. After the chunk
+// index is decoded, any subset of the chunks can be decoded independently of
+// the other chunks, optionally on multiple threads.
+class ChunkedMeshDecoder {
+ public:
+  typedef std::vector<std::unique_ptr<Mesh>> MeshVector;
+
+  ChunkedMeshDecoder();
+
+  // Returns true when |in_buffer| contains data encoded by ChunkedMeshEncoder.
+  // The position of |in_buffer| is not changed.
+  static bool IsChunkedMesh(const DecoderBuffer &in_buffer);
+
+  // Decodes the chunk index from |in_buffer|. The encoded chunks are not
+  // copied, so the data of |in_buffer| must outlive all subsequent calls to
+  // the chunk decoding methods.
+  Status DecodeChunkIndex(DecoderBuffer *in_buffer);
+
+  // Sets the number of threads used by DecodeChunks() and DecodeAllChunks().
+  // Default = 1.
+  void SetNumDecodingThreads(int num_threads) { num_threads_ = num_threads; }
+
+  int num_chunks() const { return static_cast<int>(chunks_.size()); }
+
+  // Returns the bounding box of positions of the |chunk_id|-th chunk.
+  const BoundingBox &GetChunkBoundingBox(int chunk_id) const {
+    return chunks_[chunk_id].bounding_box;
+  }
+
+  // Returns the number of faces of the |chunk_id|-th chunk.
+  int GetChunkNumFaces(int chunk_id) const {
+    return chunks_[chunk_id].num_faces;
+  }
+
+  // Returns ids of all chunks whose bounding box intersects |bounding_box|.
+  std::vector<int> FindChunksIntersecting(
+      const BoundingBox &bounding_box) const;
+
+  // Decodes the |chunk_id|-th chunk.
+  StatusOr<std::unique_ptr<Mesh>> DecodeChunk(int chunk_id) const;
+
+  // Decodes the chunks listed in |chunk_ids|. The decoded meshes are returned
+  // in the same order as the chunk ids.
+  StatusOr<MeshVector> DecodeChunks(const std::vector<int> &chunk_ids) const;
+
+  // Decodes all chunks.
+  StatusOr<MeshVector> DecodeAllChunks() const;
+
+  // Decodes all chunks whose bounding box intersects |bounding_box|.
+  StatusOr<MeshVector> DecodeChunksIntersecting(
+      const BoundingBox &bounding_box) const;
+
+  // Returns the options used to decode each chunk.
+  DecoderOptions *options() { return &options_; }
+
+ private:
+  struct ChunkInfo {
+    BoundingBox bounding_box;
+    int num_faces = 0;
+    const char *data = nullptr;
+    size_t size = 0;
+  };
+
+  std::vector<ChunkInfo> chunks_;
+  DecoderOptions options_;
+  int num_threads_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_CHUNKED_MESH_DECODER_H_
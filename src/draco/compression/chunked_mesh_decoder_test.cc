@@ -0,0 +1,200 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/chunked_mesh_decoder.h"
+
+#include <array>
+#include <map>
+#include <memory>
+#include <set>
+#include <vector>
+
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/chunked_mesh_encoder.h"
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+
+namespace {
+
+class ChunkedMeshDecoderTest : public ::testing::Test {
+ protected:
+  void EncodeTestMesh(const std::string &file_name, int max_faces_per_chunk,
+                      draco::EncoderBuffer *out_buffer) {
+    mesh_ = draco::ReadMeshFromTestFile(file_name);
+    ASSERT_NE(mesh_, nullptr);
+    draco::Encoder encoder;
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
+    draco::ChunkedMeshEncoder chunked_encoder;
+    chunked_encoder.SetMaxFacesPerChunk(max_faces_per_chunk);
+    chunked_encoder.SetNumEncodingThreads(4);
+    DRACO_ASSERT_OK(
+        chunked_encoder.EncodeMeshToBuffer(*mesh_, encoder, out_buffer));
+  }
+
+  std::unique_ptr<draco::Mesh> mesh_;
+};
+
+TEST_F(ChunkedMeshDecoderTest, DecodeAllChunks) {
+  draco::EncoderBuffer buffer;
+  EncodeTestMesh("bun_zipper.ply", 5000, &buffer);
+
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  ASSERT_TRUE(draco::ChunkedMeshDecoder::IsChunkedMesh(in_buffer));
+  draco::ChunkedMeshDecoder decoder;
+  DRACO_ASSERT_OK(decoder.DecodeChunkIndex(&in_buffer));
+  ASSERT_GT(decoder.num_chunks(), 1);
+
+  DRACO_ASSIGN_OR_ASSERT(const draco::ChunkedMeshDecoder::MeshVector meshes,
+                         decoder.DecodeAllChunks());
+  ASSERT_EQ(meshes.size(), decoder.num_chunks());
+  int num_faces = 0;
+  for (int i = 0; i < decoder.num_chunks(); ++i) {
+    ASSERT_NE(meshes[i], nullptr);
+    ASSERT_LE(meshes[i]->num_faces(), 5000);
+    ASSERT_EQ(meshes[i]->num_faces(), decoder.GetChunkNumFaces(i));
+    num_faces += meshes[i]->num_faces();
+  }
+  ASSERT_EQ(num_faces, mesh_->num_faces());
+
+  // Decoding on multiple threads must produce the same chunks.
+  decoder.SetNumDecodingThreads(4);
+  DRACO_ASSIGN_OR_ASSERT(
+      const draco::ChunkedMeshDecoder::MeshVector parallel_meshes,
+      decoder.DecodeAllChunks());
+  ASSERT_EQ(parallel_meshes.size(), meshes.size());
+  for (int i = 0; i < meshes.size(); ++i) {
+    ASSERT_EQ(parallel_meshes[i]->num_faces(), meshes[i]->num_faces());
+    ASSERT_EQ(parallel_meshes[i]->num_points(), meshes[i]->num_points());
+  }
+}
+
+TEST_F(ChunkedMeshDecoderTest, DecodeChunksIntersecting) {
+  draco::EncoderBuffer buffer;
+  EncodeTestMesh("bun_zipper.ply", 2000, &buffer);
+
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  draco::ChunkedMeshDecoder decoder;
+  DRACO_ASSERT_OK(decoder.DecodeChunkIndex(&in_buffer));
+
+  // Query a box around the minimum corner of the mesh.
+  const draco::BoundingBox mesh_bbox = mesh_->ComputeBoundingBox();
+  const draco::BoundingBox query_bbox(
+      mesh_bbox.GetMinPoint(),
+      mesh_bbox.GetMinPoint() + mesh_bbox.Size() * 0.25f);
+  const std::vector<int> chunk_ids = decoder.FindChunksIntersecting(query_bbox);
+  ASSERT_FALSE(chunk_ids.empty());
+  ASSERT_LT(chunk_ids.size(), decoder.num_chunks());
+
+  DRACO_ASSIGN_OR_ASSERT(const draco::ChunkedMeshDecoder::MeshVector meshes,
+                         decoder.DecodeChunksIntersecting(query_bbox));
+  ASSERT_EQ(meshes.size(), chunk_ids.size());
+  for (int i = 0; i < meshes.size(); ++i) {
+    ASSERT_TRUE(meshes[i]->ComputeBoundingBox().Intersects(query_bbox));
+  }
+}
+
+TEST_F(ChunkedMeshDecoderTest, SharedVerticesAreCrackFree) {
+  draco::EncoderBuffer buffer;
+  EncodeTestMesh("bun_zipper.ply", 2000, &buffer);
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  draco::ChunkedMeshDecoder decoder;
+  DRACO_ASSERT_OK(decoder.DecodeChunkIndex(&in_buffer));
+  DRACO_ASSIGN_OR_ASSERT(const draco::ChunkedMeshDecoder::MeshVector meshes,
+                         decoder.DecodeAllChunks());
+
+  // Reference positions of the whole mesh encoded with the same quantization
+  // parameters as the chunks, i.e., parameters of the whole mesh.
+  draco::AttributeQuantizationTransform transform;
+  ASSERT_TRUE(transform.ComputeParameters(
+      *mesh_->GetNamedAttribute(draco::GeometryAttribute::POSITION), 14));
+  draco::Encoder encoder;
+  encoder.SetAttributeExplicitQuantization(
+      draco::GeometryAttribute::POSITION, 14, 3, transform.min_values().data(),
+      transform.range());
+  draco::EncoderBuffer reference_buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh_, &reference_buffer));
+  draco::DecoderBuffer reference_in_buffer;
+  reference_in_buffer.Init(reference_buffer.data(), reference_buffer.size());
+  draco::Decoder reference_decoder;
+  DRACO_ASSIGN_OR_ASSERT(
+      const std::unique_ptr<draco::Mesh> reference_mesh,
+      reference_decoder.DecodeMeshFromBuffer(&reference_in_buffer));
+
+  // Positions are compared bit by bit.
+  typedef std::array<uint32_t, 3> PositionBits;
+  const auto get_positions = [](const draco::Mesh &mesh) {
+    const draco::PointAttribute *const pos_att =
+        mesh.GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    std::set<PositionBits> positions;
+    for (draco::AttributeValueIndex avi(0); avi < pos_att->size(); ++avi) {
+      PositionBits bits;
+      pos_att->GetValue(avi, &bits[0]);
+      positions.insert(bits);
+    }
+    return positions;
+  };
+  const std::set<PositionBits> reference_positions =
+      get_positions(*reference_mesh);
+
+  // A vertex shared by multiple chunks must be decoded to the same position
+  // in all of them, and that position must match the reference. Otherwise
+  // the union of chunk positions would contain extra positions.
+  std::map<PositionBits, int> num_chunks_with_position;
+  for (int i = 0; i < meshes.size(); ++i) {
+    const draco::BoundingBox &chunk_bbox = decoder.GetChunkBoundingBox(i);
+    for (const PositionBits &bits : get_positions(*meshes[i])) {
+      ++num_chunks_with_position[bits];
+      ASSERT_EQ(reference_positions.count(bits), 1);
+    }
+
+    // The stored bounding box contains the decoded positions.
+    const draco::BoundingBox bbox = meshes[i]->ComputeBoundingBox();
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_GE(bbox.GetMinPoint()[c], chunk_bbox.GetMinPoint()[c]);
+      ASSERT_LE(bbox.GetMaxPoint()[c], chunk_bbox.GetMaxPoint()[c]);
+    }
+  }
+  ASSERT_EQ(num_chunks_with_position.size(), reference_positions.size());
+  int num_shared_positions = 0;
+  for (const auto &entry : num_chunks_with_position) {
+    if (entry.second > 1) {
+      ++num_shared_positions;
+    }
+  }
+  ASSERT_GT(num_shared_positions, 0);
+}
+
+TEST_F(ChunkedMeshDecoderTest, InvalidInput) {
+  // Regular Draco meshes are not accepted by the chunked decoder.
+  const std::unique_ptr<draco::Mesh> mesh =
+      draco::ReadMeshFromTestFile("test_nm.obj");
+  ASSERT_NE(mesh, nullptr);
+  draco::Encoder encoder;
+  draco::EncoderBuffer buffer;
+  DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+
+  draco::DecoderBuffer in_buffer;
+  in_buffer.Init(buffer.data(), buffer.size());
+  ASSERT_FALSE(draco::ChunkedMeshDecoder::IsChunkedMesh(in_buffer));
+  draco::ChunkedMeshDecoder decoder;
+  ASSERT_FALSE(decoder.DecodeChunkIndex(&in_buffer).ok());
+  ASSERT_FALSE(decoder.DecodeChunk(0).ok());
+}
+
+}  // namespace
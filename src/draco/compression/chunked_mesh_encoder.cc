@@ -0,0 +1,311 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/chunked_mesh_encoder.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/expert_encode.h"
+#include "draco/core/bounding_box.h"
+#include "draco/core/thread_pool.h"
+#include "draco/core/varint_encoding.h"
+
+namespace draco {
+
+namespace {
+
+// Recursively splits |faces| into clusters of at most |max_faces| faces.
+// Each cluster is split at the median face centroid along the longest axis of
+// the bounding box of the centroids. Ranges of the generated clusters are
+// appended to |out_clusters|.
+void SplitFaces(const IndexTypeVector<FaceIndex, Vector3f> &centroids,
+                int max_faces, FaceIndex *faces, int num_faces,
+                std::vector<std::pair<FaceIndex *, int>> *out_clusters) {
+  if (num_faces <= max_faces) {
+    out_clusters->push_back(std::make_pair(faces, num_faces));
+    return;
+  }
+  BoundingBox bbox;
+  for (int i = 0; i < num_faces; ++i) {
+    bbox.Update(centroids[faces[i]]);
+  }
+  const Vector3f size = bbox.Size();
+  int axis = 0;
+  if (size[1] > size[axis]) {
+    axis = 1;
+  }
+  if (size[2] > size[axis]) {
+    axis = 2;
+  }
+  const int num_left_faces = num_faces / 2;
+  std::nth_element(faces, faces + num_left_faces, faces + num_faces,
+                   [&centroids, axis](FaceIndex a, FaceIndex b) {
+                     return centroids[a][axis] < centroids[b][axis];
+                   });
+  SplitFaces(centroids, max_faces, faces, num_left_faces, out_clusters);
+  SplitFaces(centroids, max_faces, faces + num_left_faces,
+             num_faces - num_left_faces, out_clusters);
+}
+
+// Creates a mesh containing |num_faces| faces of the source |mesh|. Only the
+// points and attribute values used by the faces are copied to the new mesh.
+std::unique_ptr<Mesh> CreateChunkMesh(const Mesh &mesh, const FaceIndex *faces,
+                                      int num_faces) {
+  std::unique_ptr<Mesh> chunk(new Mesh());
+  IndexTypeVector<PointIndex, PointIndex> point_map(mesh.num_points(),
+                                                    kInvalidPointIndex);
+  std::vector<PointIndex> chunk_points;
+  chunk->SetNumFaces(num_faces);
+  for (int i = 0; i < num_faces; ++i) {
+    const Mesh::Face &src_face = mesh.face(faces[i]);
+    Mesh::Face face;
+    for (int c = 0; c < 3; ++c) {
+      if (point_map[src_face[c]] == kInvalidPointIndex) {
+        point_map[src_face[c]] = PointIndex(chunk_points.size());
+        chunk_points.push_back(src_face[c]);
+      }
+      face[c] = point_map[src_face[c]];
+    }
+    chunk->SetFace(FaceIndex(i), face);
+  }
+  chunk->set_num_points(
+      static_cast<PointIndex::ValueType>(chunk_points.size()));
+
+  for (int att_id = 0; att_id < mesh.num_attributes(); ++att_id) {
+    const PointAttribute *const src_att = mesh.attribute(att_id);
+    // Map the used attribute values to new indices while preserving values
+    // that are shared between multiple points.
+    IndexTypeVector<AttributeValueIndex, AttributeValueIndex> value_map(
+        src_att->size(), kInvalidAttributeValueIndex);
+    std::vector<AttributeValueIndex> chunk_values;
+    for (const PointIndex src_point : chunk_points) {
+      const AttributeValueIndex src_value = src_att->mapped_index(src_point);
+      if (value_map[src_value] == kInvalidAttributeValueIndex) {
+        value_map[src_value] = AttributeValueIndex(chunk_values.size());
+        chunk_values.push_back(src_value);
+      }
+    }
+    std::unique_ptr<PointAttribute> att(new PointAttribute());
+    att->Init(src_att->attribute_type(), src_att->num_components(),
+              src_att->data_type(), src_att->normalized(), chunk_values.size());
+    att->set_unique_id(src_att->unique_id());
+    for (AttributeValueIndex i(0); i < chunk_values.size(); ++i) {
+      att->SetAttributeValue(i, src_att->GetAddress(chunk_values[i.value()]));
+    }
+    att->SetExplicitMapping(chunk_points.size());
+    for (PointIndex i(0); i < chunk_points.size(); ++i) {
+      att->SetPointMapEntry(
+          i, value_map[src_att->mapped_index(chunk_points[i.value()])]);
+    }
+    chunk->AddAttribute(std::move(att));
+    chunk->SetAttributeElementType(att_id,
+                                   mesh.GetAttributeElementType(att_id));
+  }
+  return chunk;
+}
+
+// Computes the bounding box of the positions of a chunk as they are going to
+// be decoded, i.e., including the error of the quantization given by
+// |options|. Otherwise the decoded positions of vertices on the boundary of
+// the chunk could lie outside of the stored bounding box.
+StatusOr<BoundingBox> ComputeDecodedBoundingBox(const PointAttribute &pos_att,
+                                                int pos_att_id,
+                                                const EncoderOptions &options) {
+  PointAttribute positions;
+  positions.Init(GeometryAttribute::POSITION, 3, DT_FLOAT32, false,
+                 pos_att.size());
+  for (AttributeValueIndex avi(0); avi < pos_att.size(); ++avi) {
+    Vector3f pos;
+    if (!pos_att.ConvertValue<float>(avi, 3, &pos[0])) {
+      return Status(Status::DRACO_ERROR, "Invalid position attribute.");
+    }
+    positions.SetAttributeValue(avi, &pos[0]);
+  }
+  const int quantization_bits =
+      options.GetAttributeInt(pos_att_id, "quantization_bits", -1);
+  if (quantization_bits >= 1 && pos_att.data_type() == DT_FLOAT32) {
+    // Quantize the positions and revert the quantization in the same way as
+    // the encoder and the decoder.
+    AttributeQuantizationTransform transform;
+    if (options.IsAttributeOptionSet(pos_att_id, "quantization_origin") &&
+        options.IsAttributeOptionSet(pos_att_id, "quantization_range")) {
+      float origin[3];
+      options.GetAttributeVector(pos_att_id, "quantization_origin", 3, origin);
+      const float range =
+          options.GetAttributeFloat(pos_att_id, "quantization_range", 1.f);
+      if (!transform.SetParameters(quantization_bits, origin, 3, range)) {
+        return Status(Status::DRACO_ERROR, "Invalid quantization parameters.");
+      }
+    } else if (!transform.ComputeParameters(positions, quantization_bits)) {
+      return Status(Status::DRACO_ERROR, "Invalid quantization parameters.");
+    }
+    std::unique_ptr<PointAttribute> quantized =
+        transform.InitTransformedAttribute(positions,
+                                           static_cast<int>(positions.size()));
+    if (!transform.TransformAttribute(positions, {}, quantized.get()) ||
+        !transform.InverseTransformAttribute(*quantized, &positions)) {
+      return Status(Status::DRACO_ERROR, "Failed to quantize positions.");
+    }
+  }
+  BoundingBox bbox;
+  for (AttributeValueIndex avi(0); avi < positions.size(); ++avi) {
+    Vector3f pos;
+    positions.GetValue(avi, &pos[0]);
+    bbox.Update(pos);
+  }
+  return bbox;
+}
+
+}  // namespace
+
+ChunkedMeshEncoder::ChunkedMeshEncoder()
+    : max_faces_per_chunk_(65536), num_threads_(1) {}
+
+StatusOr<ChunkedMeshEncoder::MeshVector> ChunkedMeshEncoder::SplitMesh(
+    const Mesh &mesh) const {
+  if (max_faces_per_chunk_ < 1) {
+    return Status(Status::DRACO_ERROR, "Invalid maximum number of faces.");
+  }
+  const PointAttribute *const pos_att =
+      mesh.GetNamedAttribute(GeometryAttribute::POSITION);
+  if (pos_att == nullptr || pos_att->num_components() != 3) {
+    return Status(Status::DRACO_ERROR, "Mesh has no 3D position attribute.");
+  }
+
+  // Compute centroids of all faces.
+  IndexTypeVector<FaceIndex, Vector3f> centroids(mesh.num_faces());
+  std::vector<FaceIndex> faces(mesh.num_faces());
+  for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+    Vector3f centroid(0.f, 0.f, 0.f);
+    for (int c = 0; c < 3; ++c) {
+      Vector3f pos;
+      if (!pos_att->ConvertValue<float>(pos_att->mapped_index(mesh.face(fi)[c]),
+                                        3, &pos[0])) {
+        return Status(Status::DRACO_ERROR, "Invalid position attribute.");
+      }
+      centroid += pos;
+    }
+    centroids[fi] = centroid / 3.f;
+    faces[fi.value()] = fi;
+  }
+
+  std::vector<std::pair<FaceIndex *, int>> clusters;
+  if (!faces.empty()) {
+    SplitFaces(centroids, max_faces_per_chunk_, faces.data(),
+               static_cast<int>(faces.size()), &clusters);
+  }
+  MeshVector chunks;
+  chunks.reserve(clusters.size());
+  for (const auto &cluster : clusters) {
+    chunks.push_back(CreateChunkMesh(mesh, cluster.first, cluster.second));
+  }
+  return std::move(chunks);
+}
+
+Status ChunkedMeshEncoder::EncodeMeshToBuffer(const Mesh &mesh,
+                                              const Encoder &encoder,
+                                              EncoderBuffer *out_buffer) {
+  return EncodeMeshToBuffer(mesh, encoder.CreateExpertEncoderOptions(mesh),
+                            out_buffer);
+}
+
+Status ChunkedMeshEncoder::EncodeMeshToBuffer(const Mesh &mesh,
+                                              const EncoderOptions &options,
+                                              EncoderBuffer *out_buffer) {
+  DRACO_ASSIGN_OR_RETURN(const MeshVector chunks, SplitMesh(mesh));
+
+  EncoderOptions chunk_options = options;
+  if (!chunk_options.IsGlobalOptionSet("encoding_method")) {
+    chunk_options.SetGlobalInt("encoding_method", MESH_EDGEBREAKER_ENCODING);
+  }
+  // Quantization parameters would be otherwise computed from the values of
+  // each chunk. Use parameters of the whole mesh to avoid cracks between the
+  // decoded chunks.
+  for (int att_id = 0; att_id < mesh.num_attributes(); ++att_id) {
+    const PointAttribute *const att = mesh.attribute(att_id);
+    const int quantization_bits =
+        chunk_options.GetAttributeInt(att_id, "quantization_bits", -1);
+    if (quantization_bits < 1 || att->data_type() != DT_FLOAT32 ||
+        (chunk_options.IsAttributeOptionSet(att_id, "quantization_origin") &&
+         chunk_options.IsAttributeOptionSet(att_id, "quantization_range"))) {
+      continue;
+    }
+    AttributeQuantizationTransform transform;
+    if (!transform.ComputeParameters(*att, quantization_bits)) {
+      return Status(Status::DRACO_ERROR,
+                    "Failed to compute quantization parameters.");
+    }
+    chunk_options.SetAttributeVector(att_id, "quantization_origin",
+                                     att->num_components(),
+                                     transform.min_values().data());
+    chunk_options.SetAttributeFloat(att_id, "quantization_range",
+                                    transform.range());
+  }
+
+  // Encode all chunks into separate buffers.
+  const int num_chunks = static_cast<int>(chunks.size());
+  std::vector<EncoderBuffer> chunk_buffers(num_chunks);
+  std::vector<Status> statuses(num_chunks);
+  {
+    ThreadPool thread_pool(std::min(num_threads_, std::max(num_chunks, 1)));
+    for (int i = 0; i < num_chunks; ++i) {
+      const Mesh *const chunk = chunks[i].get();
+      EncoderBuffer *const chunk_buffer = &chunk_buffers[i];
+      Status *const status = &statuses[i];
+      thread_pool.Schedule([chunk, chunk_buffer, status, &chunk_options]() {
+        ExpertEncoder encoder(*chunk);
+        encoder.Reset(chunk_options);
+        *status = encoder.EncodeToBuffer(chunk_buffer);
+      });
+    }
+  }
+  for (const Status &status : statuses) {
+    DRACO_RETURN_IF_ERROR(status);
+  }
+
+  // Encode the chunk index followed by the chunk data.
+  out_buffer->Encode(kChunkedMeshMagic, kChunkedMeshMagicLength);
+  out_buffer->Encode(kChunkedMeshVersionMajor);
+  out_buffer->Encode(kChunkedMeshVersionMinor);
+  EncodeVarint(static_cast<uint32_t>(num_chunks), out_buffer);
+  const int pos_att_id = mesh.GetNamedAttributeId(GeometryAttribute::POSITION);
+  for (int i = 0; i < num_chunks; ++i) {
+    const Mesh &chunk = *chunks[i];
+    DRACO_ASSIGN_OR_RETURN(
+        const BoundingBox bbox,
+        ComputeDecodedBoundingBox(*chunk.attribute(pos_att_id), pos_att_id,
+                                  chunk_options));
+    out_buffer->Encode(&bbox.GetMinPoint()[0], 3 * sizeof(float));
+    out_buffer->Encode(&bbox.GetMaxPoint()[0], 3 * sizeof(float));
+    EncodeVarint(static_cast<uint32_t>(chunk.num_faces()), out_buffer);
+    EncodeVarint(static_cast<uint64_t>(chunk_buffers[i].size()), out_buffer);
+  }
+  if (!out_buffer->Flush()) {
+    return Status(Status::IO_ERROR, "Failed to write the encoded data.");
+  }
+  for (int i = 0; i < num_chunks; ++i) {
+    out_buffer->Encode(chunk_buffers[i].data(), chunk_buffers[i].size());
+    if (!out_buffer->Flush()) {
+      return Status(Status::IO_ERROR, "Failed to write the encoded data.");
+    }
+    // Release the memory of the encoded chunk.
+    chunk_buffers[i] = EncoderBuffer();
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,90 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_CHUNKED_MESH_ENCODER_H_
+#define DRACO_COMPRESSION_CHUNKED_MESH_ENCODER_H_
+
+#include <memory>
+#include <vector>
+
+#include "draco/compression/config/encoder_options.h"
+#include "draco/compression/encode.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/core/status_or.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Class for encoding large meshes into a set of spatially coherent chunks that
+// can be decoded independently of each other using ChunkedMeshDecoder.
+//
+// The faces of the input mesh are recursively split at the median of their
+// centroids along the longest axis until each cluster contains at most
+// |max_faces_per_chunk| faces. Every cluster is then encoded as a regular
+// Draco mesh. Quantized attributes of all chunks share the same quantization
+// grid so that vertices on the chunk boundaries are decoded to the same
+// values in all chunks.
+//
+// The encoded data consists of a chunk index followed by the encoded chunks:
+//   char[8]  "DRCHUNKS"
+//   uint8    version major
+//   uint8    version minor
+//   varint   number of chunks
+//   For each chunk:
+//     float[3] minimum point of the chunk bounding box
+//     float[3] maximum point of the chunk bounding box
+//     varint   number of faces
+//     varint   size of the encoded chunk in bytes
+//   Encoded chunks in the same order as in the index.
+//
+// Geometry metadata of the input mesh is not stored in the chunks.
+class ChunkedMeshEncoder {
+ public:
+  typedef std::vector<std::unique_ptr<Mesh>> MeshVector;
+
+  ChunkedMeshEncoder();
+
+  // Sets the maximum number of faces stored in a single chunk.
+  // Default = 65536.
+  void SetMaxFacesPerChunk(int max_faces_per_chunk) {
+    max_faces_per_chunk_ = max_faces_per_chunk;
+  }
+
+  // Sets the number of threads used to encode the chunks. Default = 1.
+  void SetNumEncodingThreads(int num_threads) { num_threads_ = num_threads; }
+
+  // Encodes |mesh| into |out_buffer|. Each chunk is encoded with an
+  // ExpertEncoder using |options| where the attribute ids correspond to the
+  // attributes of |mesh|. Chunks are encoded with the edgebreaker method unless
+  // a different encoding method is set in |options|.
+  Status EncodeMeshToBuffer(const Mesh &mesh, const EncoderOptions &options,
+                            EncoderBuffer *out_buffer);
+
+  // Same as above but the chunks are encoded with options of |encoder|.
+  Status EncodeMeshToBuffer(const Mesh &mesh, const Encoder &encoder,
+                            EncoderBuffer *out_buffer);
+
+  // Splits |mesh| into chunks without encoding them. The attribute ids of the
+  // chunks are the same as the attribute ids of |mesh|.
+  StatusOr<MeshVector> SplitMesh(const Mesh &mesh) const;
+
+ private:
+  int max_faces_per_chunk_;
+  int num_threads_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_CHUNKED_MESH_ENCODER_H_
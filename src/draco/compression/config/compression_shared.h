@@ -22,11 +22,13 @@
 
 namespace draco {
 
-// Latest Draco bit-stream version.
+// Latest Draco bit-stream version supported by the decoder. Encoders write the
+// oldest version that supports the requested features, see
+// PointCloudEncoder::GetBitstreamVersion().
 static constexpr uint8_t kDracoPointCloudBitstreamVersionMajor = 2;
-static constexpr uint8_t kDracoPointCloudBitstreamVersionMinor = 3;
+static constexpr uint8_t kDracoPointCloudBitstreamVersionMinor = 5;
 static constexpr uint8_t kDracoMeshBitstreamVersionMajor = 2;
-static constexpr uint8_t kDracoMeshBitstreamVersionMinor = 2;
+static constexpr uint8_t kDracoMeshBitstreamVersionMinor = 3;
 
 // Concatenated latest bit-stream version.
 static constexpr uint16_t kDracoPointCloudBitstreamVersion =
@@ -144,12 +146,23 @@ enum NormalPredictionMode {
 enum SymbolCodingMethod {
   SYMBOL_CODING_TAGGED = 0,
   SYMBOL_CODING_RAW = 1,
+  // Same as SYMBOL_CODING_RAW but the symbols are coded with multiple
+  // interleaved rANS states that can be decoded faster. Supported since mesh
+  // bitstream version 2.3 and point cloud bitstream version 2.4.
+  SYMBOL_CODING_RAW_INTERLEAVED = 2,
   NUM_SYMBOL_CODING_METHODS,
 };
 
 // Mask for setting and getting the bit for metadata in |flags| of header.
 #define METADATA_FLAG_MASK 0x8000
 
+// Magic string and version of the container storing independently decodable
+// mesh chunks (see chunked_mesh_encoder.h).
+static constexpr char kChunkedMeshMagic[] = "DRCHUNKS";
+static constexpr int kChunkedMeshMagicLength = 8;
+static constexpr uint8_t kChunkedMeshVersionMajor = 1;
+static constexpr uint8_t kChunkedMeshVersionMinor = 0;
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_CONFIG_COMPRESSION_SHARED_H_
@@ -15,6 +15,7 @@
 #include "draco/compression/decode.h"
 
 #include "draco/compression/config/compression_shared.h"
+#include "draco/compression/mesh/mesh_decoder.h"
 
 #ifdef DRACO_MESH_COMPRESSION_SUPPORTED
 #include "draco/compression/mesh/mesh_edgebreaker_decoder.h"
@@ -102,6 +103,7 @@ Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<PointCloudDecoder> decoder,
                          CreatePointCloudDecoder(header.encoder_method))
 
+  decoder->SetResourcePool(resource_pool_);
   DRACO_RETURN_IF_ERROR(decoder->Decode(options_, in_buffer, out_geometry))
   return OkStatus();
 #else
@@ -121,6 +123,7 @@ Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
   DRACO_ASSIGN_OR_RETURN(std::unique_ptr<MeshDecoder> decoder,
                          CreateMeshDecoder(header.encoder_method))
 
+  decoder->SetResourcePool(resource_pool_);
   DRACO_RETURN_IF_ERROR(decoder->Decode(options_, in_buffer, out_geometry))
   return OkStatus();
 #else
@@ -128,8 +131,109 @@ Status Decoder::DecodeBufferToGeometry(DecoderBuffer *in_buffer,
 #endif
 }
 
+Status Decoder::DecodeMeshToVertexBuffer(
+    DecoderBuffer *in_buffer, const VertexBufferLayout &layout,
+    const VertexBufferAllocator &allocator) {
+  // Skip the attribute transforms so that the transformed values can be
+  // reverted directly into the vertex buffer.
+  const DecoderOptions options = options_;
+  for (int i = 0; i < GeometryAttribute::NAMED_ATTRIBUTES_COUNT; ++i) {
+    SetSkipAttributeTransform(static_cast<GeometryAttribute::Type>(i));
+  }
+  Mesh mesh;
+  const Status status = DecodeBufferToGeometry(in_buffer, &mesh);
+  options_ = options;
+  DRACO_RETURN_IF_ERROR(status)
+  DRACO_RETURN_IF_ERROR(ValidateVertexBufferLayout(mesh, layout))
+
+  uint8_t *vertex_data = nullptr;
+  uint32_t *indices = nullptr;
+  DRACO_RETURN_IF_ERROR(allocator(mesh.num_points(), mesh.num_faces(),
+                                  &vertex_data, &indices))
+  return WriteMeshToVertexBuffer(mesh, layout, vertex_data, indices);
+}
+
 void Decoder::SetSkipAttributeTransform(GeometryAttribute::Type att_type) {
   options_.SetAttributeBool(att_type, "skip_attribute_transform", true);
 }
 
+void Decoder::SetNumDecodingThreads(int num_threads) {
+  options_.SetGlobalInt("num_decoding_threads", num_threads);
+}
+
+void Decoder::SetKdTreeQueryBox(const BoundingBox &bounding_box) {
+  float box[6];
+  for (int i = 0; i < 3; ++i) {
+    box[i] = bounding_box.GetMinPoint()[i];
+    box[3 + i] = bounding_box.GetMaxPoint()[i];
+  }
+  options_.SetGlobalVector("kd_tree_query_box", 6, box);
+}
+
+void Decoder::SetKdTreeMaxDepth(int max_depth) {
+  options_.SetGlobalInt("kd_tree_max_depth", max_depth);
+}
+
+DecoderSession::DecoderSession() = default;
+
+DecoderSession::~DecoderSession() = default;
+
+Status DecoderSession::DecodeMesh(DecoderBuffer *in_buffer, Mesh *out_mesh) {
+#ifdef DRACO_MESH_COMPRESSION_SUPPORTED
+  DecoderBuffer temp_buffer(*in_buffer);
+  DracoHeader header;
+  DRACO_RETURN_IF_ERROR(PointCloudDecoder::DecodeHeader(&temp_buffer, &header))
+  if (header.encoder_type != TRIANGULAR_MESH) {
+    return Status(Status::DRACO_ERROR, "Input is not a mesh.");
+  }
+  if (header.encoder_method >= mesh_decoders_.size()) {
+    mesh_decoders_.resize(header.encoder_method + 1);
+  }
+  if (mesh_decoders_[header.encoder_method] == nullptr) {
+    DRACO_ASSIGN_OR_RETURN(mesh_decoders_[header.encoder_method],
+                           CreateMeshDecoder(header.encoder_method))
+  }
+  MeshDecoder *const decoder = mesh_decoders_[header.encoder_method].get();
+
+  // Move the memory of the existing attributes to the recycled attributes and
+  // remove all previously decoded data from |out_mesh|.
+  recycled_attributes_.clear();
+  for (int i = 0; i < out_mesh->num_attributes(); ++i) {
+    PointAttribute *const att = out_mesh->attribute(i);
+    std::unique_ptr<PointAttribute> recycled_att(
+        new PointAttribute(static_cast<const GeometryAttribute &>(*att)));
+    recycled_att->RecycleStorage(att);
+    recycled_attributes_.push_back(std::move(recycled_att));
+  }
+  while (out_mesh->num_attributes() > 0) {
+    out_mesh->DeleteAttribute(out_mesh->num_attributes() - 1);
+  }
+#ifdef DRACO_TRANSCODER_SUPPORTED
+  // Also resets the name, materials, mesh features, structural metadata and
+  // compression options. The capacity of the face array is kept.
+  out_mesh->Copy(Mesh());
+#else
+  out_mesh->SetNumFaces(0);
+  out_mesh->set_num_points(0);
+  out_mesh->AddMetadata(nullptr);
+#endif
+
+  decoder->SetResourcePool(&resource_pool_);
+  decoder->SetRecycledAttributes(&recycled_attributes_);
+  const Status status = decoder->Decode(options_, in_buffer, out_mesh);
+  decoder->SetRecycledAttributes(nullptr);
+  // Free the memory of attributes that were not reused.
+  recycled_attributes_.clear();
+  return status;
+#else
+  return Status(Status::DRACO_ERROR, "Unsupported geometry type.");
+#endif
+}
+
+void DecoderSession::Reset() {
+  mesh_decoders_.clear();
+  resource_pool_.Reset();
+  recycled_attributes_.clear();
+}
+
 }  // namespace draco
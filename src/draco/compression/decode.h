@@ -15,8 +15,14 @@
 #ifndef DRACO_COMPRESSION_DECODE_H_
 #define DRACO_COMPRESSION_DECODE_H_
 
+#include <memory>
+#include <vector>
+
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/config/decoder_options.h"
+#include "draco/compression/decoder_resource_pool.h"
+#include "draco/compression/vertex_buffer_layout.h"
+#include "draco/core/bounding_box.h"
 #include "draco/core/decoder_buffer.h"
 #include "draco/core/status_or.h"
 #include "draco/draco_features.h"
@@ -58,6 +64,19 @@ class Decoder {
                                 PointCloud *out_geometry);
   Status DecodeBufferToGeometry(DecoderBuffer *in_buffer, Mesh *out_geometry);
 
+  // Decodes a mesh from |in_buffer| directly into an interleaved vertex buffer
+  // and an index buffer provided by the caller, e.g., a GPU staging buffer.
+  // The vertex buffer stores one vertex for each point of the mesh laid out
+  // according to |layout|. When the number of vertices and faces is known,
+  // |allocator| is called to get the memory for the buffers. |layout| is
+  // validated before |allocator| is called. Quantized attributes are
+  // dequantized directly into the vertex buffer, so the decoder does not need
+  // to create the dequantized attributes and the decoded quantized values are
+  // moved to the intermediate mesh without any copies.
+  Status DecodeMeshToVertexBuffer(DecoderBuffer *in_buffer,
+                                  const VertexBufferLayout &layout,
+                                  const VertexBufferAllocator &allocator);
+
   // When set, the decoder is going to skip attribute transform for a given
   // attribute type. For example for quantized attributes, the decoder would
   // skip the dequantization step and the returned geometry would contain an
@@ -67,12 +86,88 @@ class Decoder {
   // transform manually.
   void SetSkipAttributeTransform(GeometryAttribute::Type att_type);
 
+  // Sets the number of threads used for decoding of point attributes. The
+  // input buffer is always parsed on the calling thread, but reverting of
+  // prediction schemes and attribute transforms of attributes that do not
+  // depend on each other can be done concurrently. The decoded geometry is
+  // the same for any number of threads. Default is 1 (no extra threads).
+  void SetNumDecodingThreads(int num_threads);
+
+  // Restricts decoding of point clouds encoded with the kd-tree method and a
+  // subtree index (see EncoderBase::SetKdTreeIndexDepth()) to points whose
+  // positions lie within |bounding_box|. Subtrees of the kd-tree outside of
+  // the box are skipped without being decoded. Has no effect on other data.
+  void SetKdTreeQueryBox(const BoundingBox &bounding_box);
+
+  // Limits the level of detail of point clouds encoded with the kd-tree
+  // method and a subtree index. When |max_depth| is not greater than the
+  // depth of the index, each subtree of the index is represented by a single
+  // decoded point and the rest of its points are skipped. Subtrees cannot be
+  // truncated at a finer level so a larger |max_depth| decodes all points.
+  // Point clouds encoded with the progressive kd-tree layout are decoded up
+  // to |max_depth| and each node at this depth is represented by a single
+  // point.
+  void SetKdTreeMaxDepth(int max_depth);
+
+  // Sets a pool of temporary resources that are reused across decoding calls.
+  // When decoding many small geometries, sharing one pool between all the
+  // calls avoids most of the allocations of temporary data. The pool is not
+  // owned by the decoder and it must outlive all decoding calls that use it.
+  // The decoded geometry does not depend on the pool. Pass nullptr to stop
+  // using the pool.
+  void SetResourcePool(DecoderResourcePool *pool) { resource_pool_ = pool; }
+
   // Returns the options instance used by the decoder that can be used by users
   // to control the decoding process.
   DecoderOptions *options() { return &options_; }
 
  private:
   DecoderOptions options_;
+  DecoderResourcePool *resource_pool_ = nullptr;
+};
+
+class MeshDecoder;
+
+// Decoder for streams of similar meshes. Unlike Decoder, the session keeps
+// the decoders and the memory of previously decoded meshes alive between the
+// decoding calls, which avoids most of the allocations and deallocations when
+// many meshes are decoded one after another.
+//
+// Example:
+//   DecoderSession session;
+//   Mesh mesh;
+//   for (DecoderBuffer *buffer : buffers) {
+//     DRACO_RETURN_IF_ERROR(session.DecodeMesh(buffer, &mesh));
+//     // Process |mesh|.
+//   }
+class DecoderSession {
+ public:
+  DecoderSession();
+  ~DecoderSession();
+
+  // Decodes a mesh from |in_buffer| into |out_mesh|. All existing data of
+  // |out_mesh| is replaced by the decoded data. Memory of the faces and of the
+  // existing attributes of |out_mesh| is reused by the decoded faces and
+  // attributes with the same layout (attribute type, data type, number of
+  // components and normalization). The decoded mesh is the same as the one
+  // returned by Decoder::DecodeMeshFromBuffer().
+  Status DecodeMesh(DecoderBuffer *in_buffer, Mesh *out_mesh);
+
+  // Returns the options used for all decoding calls of the session.
+  DecoderOptions *options() { return &options_; }
+
+  // Frees all memory that is kept by the session for reuse.
+  void Reset();
+
+ private:
+  DecoderOptions options_;
+  DecoderResourcePool resource_pool_;
+
+  // Mesh decoders indexed by the encoding method.
+  std::vector<std::unique_ptr<MeshDecoder>> mesh_decoders_;
+
+  // Attributes whose memory can be reused by the decoded attributes.
+  std::vector<std::unique_ptr<PointAttribute>> recycled_attributes_;
 };
 
 }  // namespace draco
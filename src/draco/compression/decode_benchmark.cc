@@ -0,0 +1,153 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "draco/compression/decode.h"
+#include "draco/core/draco_benchmark_utils.h"
+#include "draco/io/file_utils.h"
+
+namespace draco {
+namespace {
+
+// Decodes a mesh that was encoded with the requested speed and quantization.
+void BM_DecodeMeshFromBuffer(benchmark::State &state) {
+  const Mesh *const mesh = GetBenchmarkMesh(state.range(kBenchmarkMeshArg));
+  if (mesh == nullptr) {
+    state.SkipWithError("Failed to load the input mesh.");
+    return;
+  }
+  EncoderBuffer encoded;
+  if (!EncodeBenchmarkMesh(*mesh, state.range(kBenchmarkSpeedArg),
+                           state.range(kBenchmarkQuantizationArg), &encoded)
+           .ok()) {
+    state.SkipWithError("Failed to encode the input mesh.");
+    return;
+  }
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    Decoder decoder;
+    auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
+    if (!statusor.ok()) {
+      state.SkipWithError(statusor.status().error_msg());
+      return;
+    }
+    benchmark::DoNotOptimize(statusor.value());
+  }
+  SetMeshThroughputCounters(*mesh, encoded.size(), state);
+}
+BENCHMARK(BM_DecodeMeshFromBuffer)->Apply(ApplyMeshSpeedQuantizationArgs);
+
+// Decodes the Draco files stored in testdata/ as they are. Unlike the
+// benchmark above, this tracks the decoding performance of bitstreams produced
+// by older versions of the encoder.
+const std::vector<std::string> &GetDracoFileNames() {
+  static const std::vector<std::string> file_names = {
+      "car.drc", "bunny_gltf.drc", "test_nm.obj.edgebreaker.cl10.2.2.drc"};
+  return file_names;
+}
+
+void BM_DecodeDracoFile(benchmark::State &state) {
+  std::vector<char> data;
+  if (!ReadFileToBuffer(GetBenchmarkFileFullPath(
+                            GetDracoFileNames()[state.range(0)]),
+                        &data)) {
+    state.SkipWithError("Failed to read the input file.");
+    return;
+  }
+  int num_faces = 0;
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    Decoder decoder;
+    decoder.SetNumDecodingThreads(static_cast<int>(state.range(1)));
+    auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
+    if (!statusor.ok()) {
+      state.SkipWithError(statusor.status().error_msg());
+      return;
+    }
+    num_faces = statusor.value()->num_faces();
+    benchmark::DoNotOptimize(statusor.value());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          data.size());
+  state.counters["triangles"] =
+      benchmark::Counter(static_cast<double>(num_faces),
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+// Real time is used because attributes can be decoded on multiple threads.
+BENCHMARK(BM_DecodeDracoFile)
+    ->ArgsProduct({{0, 1, 2}, {1, 4}})
+    ->ArgNames({"file", "threads"})
+    ->UseRealTime();
+
+// Decodes a stream of small meshes one after another, like a server that
+// decodes many small assets. The first argument selects how the meshes are
+// decoded:
+//   0 - A new Decoder for each mesh.
+//   1 - A new Decoder for each mesh sharing one DecoderResourcePool.
+//   2 - One DecoderSession decoding all meshes into the same output mesh.
+void BM_DecodeSmallMeshes(benchmark::State &state) {
+  const std::vector<std::string> file_names = {
+      "cube_att.obj.edgebreaker.cl10.2.2.drc",
+      "cube_att.obj.edgebreaker.cl4.2.2.drc",
+      "test_nm.obj.edgebreaker.cl10.2.2.drc",
+      "test_nm.obj.edgebreaker.cl4.2.2.drc"};
+  std::vector<std::vector<char>> files(file_names.size());
+  for (int i = 0; i < static_cast<int>(file_names.size()); ++i) {
+    if (!ReadFileToBuffer(GetBenchmarkFileFullPath(file_names[i]),
+                          &files[i])) {
+      state.SkipWithError("Failed to read the input file.");
+      return;
+    }
+  }
+  const int mode = static_cast<int>(state.range(0));
+  DecoderResourcePool pool;
+  DecoderSession session;
+  Mesh session_mesh;
+  for (auto _ : state) {
+    for (const std::vector<char> &data : files) {
+      DecoderBuffer buffer;
+      buffer.Init(data.data(), data.size());
+      if (mode == 2) {
+        const Status status = session.DecodeMesh(&buffer, &session_mesh);
+        if (!status.ok()) {
+          state.SkipWithError(status.error_msg());
+          return;
+        }
+        benchmark::DoNotOptimize(session_mesh);
+        continue;
+      }
+      Decoder decoder;
+      if (mode == 1) {
+        decoder.SetResourcePool(&pool);
+      }
+      auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
+      if (!statusor.ok()) {
+        state.SkipWithError(statusor.status().error_msg());
+        return;
+      }
+      benchmark::DoNotOptimize(statusor.value());
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          files.size());
+}
+BENCHMARK(BM_DecodeSmallMeshes)->DenseRange(0, 2)->ArgName("mode");
+
+}  // namespace
+}  // namespace draco
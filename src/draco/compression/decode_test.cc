@@ -14,8 +14,13 @@
 //
 #include "draco/compression/decode.h"
 
+#include <algorithm>
 #include <cinttypes>
+#include <cstring>
+#include <memory>
 #include <sstream>
+#include <string>
+#include <vector>
 
 #include "draco/compression/encode.h"
 #include "draco/core/draco_test_base.h"
@@ -242,4 +247,354 @@ TEST_F(DecodeTest, TestSkipAttributeTransformUniqueId) {
             << std::endl;
 }
 
+void TestParallelAttributeDecoding(const std::string &file_name) {
+  std::vector<char> data;
+  ASSERT_TRUE(
+      draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+  ASSERT_FALSE(data.empty());
+
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Decoder decoder;
+  std::unique_ptr<draco::PointCloud> pc =
+      decoder.DecodePointCloudFromBuffer(&buffer).value();
+  ASSERT_NE(pc, nullptr);
+
+  for (const int num_threads : {2, 4}) {
+    draco::DecoderBuffer parallel_buffer;
+    parallel_buffer.Init(data.data(), data.size());
+    draco::Decoder parallel_decoder;
+    parallel_decoder.SetNumDecodingThreads(num_threads);
+    std::unique_ptr<draco::PointCloud> parallel_pc =
+        parallel_decoder.DecodePointCloudFromBuffer(&parallel_buffer).value();
+    ASSERT_NE(parallel_pc, nullptr);
+
+    // The decoded geometry must be exactly the same as the one decoded
+    // sequentially.
+    ASSERT_EQ(pc->num_points(), parallel_pc->num_points());
+    ASSERT_EQ(pc->num_attributes(), parallel_pc->num_attributes());
+    for (int i = 0; i < pc->num_attributes(); ++i) {
+      const draco::PointAttribute *const att = pc->attribute(i);
+      const draco::PointAttribute *const parallel_att =
+          parallel_pc->attribute(i);
+      ASSERT_EQ(att->attribute_type(), parallel_att->attribute_type());
+      ASSERT_EQ(att->data_type(), parallel_att->data_type());
+      ASSERT_EQ(att->size(), parallel_att->size());
+      for (draco::PointIndex pi(0); pi < pc->num_points(); ++pi) {
+        const draco::AttributeValueIndex avi = att->mapped_index(pi);
+        ASSERT_EQ(avi, parallel_att->mapped_index(pi));
+        ASSERT_EQ(std::memcmp(att->GetAddress(avi),
+                              parallel_att->GetAddress(avi),
+                              att->byte_stride()),
+                  0);
+      }
+    }
+  }
+}
+
+TEST_F(DecodeTest, TestParallelAttributeDecoding) {
+  // Tests that decoding of attributes on multiple threads produces the same
+  // geometry as the sequential decoding. The test files include attributes
+  // predicted from other attributes (normals and texture coordinates predicted
+  // from positions), multiple attributes decoded by one attributes decoder and
+  // kd-tree encoded point clouds.
+  TestParallelAttributeDecoding("car.drc");
+  TestParallelAttributeDecoding("bunny_gltf.drc");
+  TestParallelAttributeDecoding("test_nm.obj.edgebreaker.cl10.2.2.drc");
+  TestParallelAttributeDecoding("cube_att.obj.sequential.cl3.2.2.drc");
+  TestParallelAttributeDecoding("pc_color.drc");
+  TestParallelAttributeDecoding("pc_kd_color.drc");
+#ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
+  // Older bitstreams fall back to the sequential decoding.
+  TestParallelAttributeDecoding("test_nm.obj.edgebreaker.1.0.0.drc");
+#endif
+}
+
+// Checks that |mesh_0| and |mesh_1| have the same faces and attribute values.
+void ExpectMeshesEqual(const draco::Mesh &mesh_0, const draco::Mesh &mesh_1) {
+  ASSERT_EQ(mesh_0.num_faces(), mesh_1.num_faces());
+  for (draco::FaceIndex fi(0); fi < mesh_0.num_faces(); ++fi) {
+    ASSERT_EQ(mesh_0.face(fi), mesh_1.face(fi));
+  }
+  ASSERT_EQ(mesh_0.num_points(), mesh_1.num_points());
+  ASSERT_EQ(mesh_0.num_attributes(), mesh_1.num_attributes());
+  for (int i = 0; i < mesh_0.num_attributes(); ++i) {
+    const draco::PointAttribute *const att_0 = mesh_0.attribute(i);
+    const draco::PointAttribute *const att_1 = mesh_1.attribute(i);
+    ASSERT_EQ(att_0->attribute_type(), att_1->attribute_type());
+    ASSERT_EQ(att_0->data_type(), att_1->data_type());
+    ASSERT_EQ(att_0->unique_id(), att_1->unique_id());
+    ASSERT_EQ(att_0->size(), att_1->size());
+    for (draco::PointIndex pi(0); pi < mesh_0.num_points(); ++pi) {
+      const draco::AttributeValueIndex avi = att_0->mapped_index(pi);
+      ASSERT_EQ(avi, att_1->mapped_index(pi));
+      ASSERT_EQ(std::memcmp(att_0->GetAddress(avi), att_1->GetAddress(avi),
+                            att_0->byte_stride()),
+                0);
+    }
+  }
+}
+
+TEST_F(DecodeTest, TestResourcePool) {
+  // Tests that reusing a resource pool across decoding of different meshes
+  // produces the same meshes as decoding without the pool.
+  const std::vector<std::string> file_names = {
+      "test_nm.obj.edgebreaker.cl10.2.2.drc", "car.drc",
+      "cube_att.obj.edgebreaker.cl4.2.2.drc", "bunny_gltf.drc",
+      "test_nm.obj.edgebreaker.cl4.2.2.drc",
+      "cube_att.obj.sequential.cl3.2.2.drc"};
+  draco::DecoderResourcePool pool;
+  for (int pass = 0; pass < 2; ++pass) {
+    for (const std::string &file_name : file_names) {
+      std::vector<char> data;
+      ASSERT_TRUE(draco::ReadFileToBuffer(
+          draco::GetTestFileFullPath(file_name), &data));
+      draco::DecoderBuffer buffer;
+      buffer.Init(data.data(), data.size());
+      draco::Decoder decoder;
+      std::unique_ptr<draco::Mesh> mesh =
+          decoder.DecodeMeshFromBuffer(&buffer).value();
+      ASSERT_NE(mesh, nullptr);
+
+      draco::DecoderBuffer pooled_buffer;
+      pooled_buffer.Init(data.data(), data.size());
+      draco::Decoder pooled_decoder;
+      pooled_decoder.SetResourcePool(&pool);
+      std::unique_ptr<draco::Mesh> pooled_mesh =
+          pooled_decoder.DecodeMeshFromBuffer(&pooled_buffer).value();
+      ASSERT_NE(pooled_mesh, nullptr);
+
+      ExpectMeshesEqual(*mesh, *pooled_mesh);
+    }
+    // Edgebreaker decoding leaves its temporary resources in the pool.
+    ASSERT_GT(pool.num_pooled_resources(), 0);
+  }
+  pool.Reset();
+  ASSERT_EQ(pool.num_pooled_resources(), 0);
+}
+
+TEST_F(DecodeTest, TestDecoderSession) {
+  // Tests that a decoder session decoding different meshes into one output
+  // mesh produces the same meshes as the standard decoder.
+  const std::vector<std::string> file_names = {
+      "test_nm.obj.edgebreaker.cl10.2.2.drc", "car.drc",
+      "cube_att.obj.sequential.cl3.2.2.drc",
+      "cube_att.obj.edgebreaker.cl4.2.2.drc", "bunny_gltf.drc",
+      "bunny_gltf.drc"};
+  draco::DecoderSession session;
+  draco::Mesh session_mesh;
+  const uint8_t *prev_position_data = nullptr;
+  for (int i = 0; i < static_cast<int>(file_names.size()); ++i) {
+    std::vector<char> data;
+    ASSERT_TRUE(draco::ReadFileToBuffer(
+        draco::GetTestFileFullPath(file_names[i]), &data));
+    draco::DecoderBuffer buffer;
+    buffer.Init(data.data(), data.size());
+    draco::Decoder decoder;
+    std::unique_ptr<draco::Mesh> mesh =
+        decoder.DecodeMeshFromBuffer(&buffer).value();
+    ASSERT_NE(mesh, nullptr);
+
+    draco::DecoderBuffer session_buffer;
+    session_buffer.Init(data.data(), data.size());
+    DRACO_ASSERT_OK(session.DecodeMesh(&session_buffer, &session_mesh));
+    ExpectMeshesEqual(*mesh, session_mesh);
+
+    const draco::PointAttribute *const pos_att =
+        session_mesh.GetNamedAttribute(draco::GeometryAttribute::POSITION);
+    ASSERT_NE(pos_att, nullptr);
+    if (i > 0 && file_names[i] == file_names[i - 1]) {
+      // Decoding of the same mesh must reuse the memory of the positions.
+      ASSERT_EQ(pos_att->buffer()->data(), prev_position_data);
+    }
+    prev_position_data = pos_att->buffer()->data();
+  }
+
+  // Invalid input must not break subsequent decoding.
+  const char invalid_data[] = "DRACO invalid";
+  draco::DecoderBuffer invalid_buffer;
+  invalid_buffer.Init(invalid_data, sizeof(invalid_data));
+  ASSERT_FALSE(session.DecodeMesh(&invalid_buffer, &session_mesh).ok());
+  std::vector<char> data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(
+      draco::GetTestFileFullPath(file_names[0]), &data));
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Decoder decoder;
+  std::unique_ptr<draco::Mesh> mesh =
+      decoder.DecodeMeshFromBuffer(&buffer).value();
+  draco::DecoderBuffer session_buffer;
+  session_buffer.Init(data.data(), data.size());
+  DRACO_ASSERT_OK(session.DecodeMesh(&session_buffer, &session_mesh));
+  ExpectMeshesEqual(*mesh, session_mesh);
+}
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+TEST_F(DecodeTest, TestDecoderSessionResetsMeshData) {
+  // Tests that a decoder session removes all data from a populated output mesh
+  // that is not present in the decoded mesh.
+  draco::Mesh session_mesh;
+  session_mesh.SetName("populated");
+  session_mesh.GetMaterialLibrary().MutableMaterial(0)->SetName("material");
+  session_mesh.GetNonMaterialTextureLibrary().PushTexture(
+      std::unique_ptr<draco::Texture>(new draco::Texture()));
+  session_mesh.AddMeshFeatures(
+      std::unique_ptr<draco::MeshFeatures>(new draco::MeshFeatures()));
+  session_mesh.AddPropertyAttributesIndex(0);
+  session_mesh.SetCompressionEnabled(true);
+
+  std::vector<char> data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(
+      draco::GetTestFileFullPath("cube_att.obj.edgebreaker.cl4.2.2.drc"),
+      &data));
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::DecoderSession session;
+  DRACO_ASSERT_OK(session.DecodeMesh(&buffer, &session_mesh));
+
+  EXPECT_TRUE(session_mesh.GetName().empty());
+  EXPECT_EQ(session_mesh.GetMaterialLibrary().NumMaterials(), 0);
+  EXPECT_EQ(session_mesh.GetNonMaterialTextureLibrary().NumTextures(), 0);
+  EXPECT_EQ(session_mesh.NumMeshFeatures(), 0);
+  EXPECT_EQ(session_mesh.NumPropertyAttributesIndices(), 0);
+  EXPECT_FALSE(session_mesh.IsCompressionEnabled());
+  EXPECT_GT(session_mesh.num_faces(), 0);
+}
+#endif  // DRACO_TRANSCODER_SUPPORTED
+
+void TestDecodeMeshToVertexBuffer(const std::string &file_name) {
+  std::vector<char> data;
+  ASSERT_TRUE(
+      draco::ReadFileToBuffer(draco::GetTestFileFullPath(file_name), &data));
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::Decoder decoder;
+  std::unique_ptr<draco::Mesh> mesh =
+      decoder.DecodeMeshFromBuffer(&buffer).value();
+  ASSERT_NE(mesh, nullptr);
+
+  // Store all attributes as floats followed by an extra copy of normals as
+  // normalized signed bytes.
+  draco::VertexBufferLayout layout;
+  std::vector<const draco::PointAttribute *> element_atts;
+  const draco::PointAttribute *normal_att = nullptr;
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    const draco::PointAttribute *const att = mesh->attribute(i);
+    draco::VertexElement element;
+    element.attribute_type = att->attribute_type();
+    element.attribute_index = 0;
+    while (mesh->GetNamedAttribute(att->attribute_type(),
+                                   element.attribute_index) != att) {
+      ++element.attribute_index;
+    }
+    element.data_type = draco::DT_FLOAT32;
+    element.num_components = std::min<int>(att->num_components(), 4);
+    element.offset = layout.stride;
+    layout.stride += element.num_components * sizeof(float);
+    layout.elements.push_back(element);
+    element_atts.push_back(att);
+    if (att->attribute_type() == draco::GeometryAttribute::NORMAL) {
+      normal_att = att;
+    }
+  }
+  if (normal_att != nullptr) {
+    draco::VertexElement element;
+    element.attribute_type = draco::GeometryAttribute::NORMAL;
+    element.data_type = draco::DT_INT8;
+    element.num_components = 4;
+    element.normalized = true;
+    element.offset = layout.stride;
+    layout.stride += 4;
+    layout.elements.push_back(element);
+  }
+
+  std::vector<uint8_t> vertex_data;
+  std::vector<uint32_t> indices;
+  draco::DecoderBuffer vertex_buffer;
+  vertex_buffer.Init(data.data(), data.size());
+  draco::Decoder vertex_buffer_decoder;
+  DRACO_ASSERT_OK(vertex_buffer_decoder.DecodeMeshToVertexBuffer(
+      &vertex_buffer, layout,
+      [&](int num_vertices, int num_faces, uint8_t **out_vertex_data,
+          uint32_t **out_indices) {
+        vertex_data.resize(num_vertices * layout.stride);
+        indices.resize(3 * num_faces);
+        *out_vertex_data = vertex_data.data();
+        *out_indices = indices.data();
+        return draco::OkStatus();
+      }));
+
+  ASSERT_EQ(indices.size(), 3 * mesh->num_faces());
+  for (draco::FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_EQ(indices[3 * fi.value() + c], mesh->face(fi)[c].value());
+    }
+  }
+  ASSERT_EQ(vertex_data.size(), mesh->num_points() * layout.stride);
+  for (draco::PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+    const uint8_t *const vertex =
+        vertex_data.data() + pi.value() * layout.stride;
+    for (int i = 0; i < static_cast<int>(element_atts.size()); ++i) {
+      const draco::VertexElement &element = layout.elements[i];
+      float expected_value[4];
+      ASSERT_TRUE(element_atts[i]->ConvertValue<float>(
+          element_atts[i]->mapped_index(pi), element.num_components,
+          expected_value));
+      float value[4];
+      std::memcpy(value, vertex + element.offset,
+                  element.num_components * sizeof(float));
+      for (int c = 0; c < element.num_components; ++c) {
+        ASSERT_EQ(value[c], expected_value[c]);
+      }
+    }
+    if (normal_att != nullptr) {
+      float normal[3];
+      normal_att->GetMappedValue(pi, normal);
+      const int8_t *const value = reinterpret_cast<const int8_t *>(
+          vertex + layout.elements.back().offset);
+      for (int c = 0; c < 3; ++c) {
+        ASSERT_NEAR(value[c], normal[c] * 127.f, 0.5f + 1e-3f);
+      }
+      ASSERT_EQ(value[3], 0);
+    }
+  }
+}
+
+TEST_F(DecodeTest, TestDecodeMeshToVertexBuffer) {
+  // Tests that decoding into an interleaved vertex buffer produces the same
+  // values as the standard decoding. The files include quantized positions,
+  // texture coordinates and octahedron encoded normals.
+  TestDecodeMeshToVertexBuffer("test_nm.obj.edgebreaker.cl10.2.2.drc");
+  TestDecodeMeshToVertexBuffer("car.drc");
+  TestDecodeMeshToVertexBuffer("bunny_gltf.drc");
+  TestDecodeMeshToVertexBuffer("cube_att.obj.sequential.cl3.2.2.drc");
+}
+
+TEST_F(DecodeTest, TestDecodeMeshToVertexBufferMissingAttribute) {
+  std::vector<char> data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(
+      draco::GetTestFileFullPath("test_nm.obj.edgebreaker.cl10.2.2.drc"),
+      &data));
+  draco::DecoderBuffer buffer;
+  buffer.Init(data.data(), data.size());
+  draco::VertexBufferLayout layout;
+  draco::VertexElement element;
+  element.attribute_type = draco::GeometryAttribute::COLOR;
+  element.num_components = 4;
+  layout.elements.push_back(element);
+  layout.stride = 16;
+  bool allocator_called = false;
+  draco::Decoder decoder;
+  ASSERT_FALSE(decoder
+                   .DecodeMeshToVertexBuffer(
+                       &buffer, layout,
+                       [&](int, int, uint8_t **, uint32_t **) {
+                         allocator_called = true;
+                         return draco::OkStatus();
+                       })
+                   .ok());
+  // The layout must be rejected before any memory is requested.
+  ASSERT_FALSE(allocator_called);
+}
+
 }  // namespace
@@ -0,0 +1,162 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_DECODER_RESOURCE_POOL_H_
+#define DRACO_COMPRESSION_DECODER_RESOURCE_POOL_H_
+
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace draco {
+
+// Pool of temporary containers and objects that can be reused by the decoders
+// across multiple decoding calls. Decoding of many small geometries otherwise
+// spends a considerable amount of time in allocating and freeing the same
+// temporary buffers over and over again. The decoders acquire the resources
+// from the pool at the start of the decoding and release them back when they
+// are done, so the memory allocated in one decoding call is reused in the
+// next one.
+//
+// The pool is not thread safe. It can be shared by decoders that run one
+// after another, but each thread needs to use its own pool. See also
+// Decoder::SetResourcePool().
+class DecoderResourcePool {
+ public:
+  DecoderResourcePool() = default;
+  DecoderResourcePool(const DecoderResourcePool &) = delete;
+  DecoderResourcePool &operator=(const DecoderResourcePool &) = delete;
+
+  // Moves a container of type |ContainerT| (such as std::vector) from the pool
+  // into |container|. The acquired container is always empty but it may have
+  // memory allocated from its previous use. If the pool does not contain any
+  // container of the requested type, |container| is left unchanged.
+  template <typename ContainerT>
+  void Acquire(ContainerT *container) {
+    std::vector<ContainerT> &entries = GetEntries<ContainerT>();
+    if (entries.empty()) {
+      return;
+    }
+    *container = std::move(entries.back());
+    entries.pop_back();
+  }
+
+  // Clears |container| and moves it into the pool without freeing its memory.
+  // |container| is left empty.
+  template <typename ContainerT>
+  void Release(ContainerT *container) {
+    container->clear();
+    GetEntries<ContainerT>().push_back(std::move(*container));
+    container->clear();
+  }
+
+  // Returns an object of type |T| from the pool or a new default constructed
+  // object if the pool does not contain any. Unlike containers, the acquired
+  // objects are returned in the state in which they were released and they
+  // need to be reinitialized by the caller.
+  template <typename T>
+  std::unique_ptr<T> AcquireObject() {
+    std::vector<std::unique_ptr<T>> &entries =
+        GetEntries<std::unique_ptr<T>>();
+    if (entries.empty()) {
+      return std::unique_ptr<T>(new T());
+    }
+    std::unique_ptr<T> object = std::move(entries.back());
+    entries.pop_back();
+    return object;
+  }
+
+  // Moves |object| into the pool.
+  template <typename T>
+  void ReleaseObject(std::unique_ptr<T> object) {
+    if (object != nullptr) {
+      GetEntries<std::unique_ptr<T>>().push_back(std::move(object));
+    }
+  }
+
+  // Frees all resources stored in the pool.
+  void Reset() { entries_.clear(); }
+
+  // Returns the number of containers and objects stored in the pool.
+  int num_pooled_resources() const {
+    int num_resources = 0;
+    for (const auto &entries : entries_) {
+      num_resources += entries.second->size();
+    }
+    return num_resources;
+  }
+
+ private:
+  // Type erased list of pooled resources of a single type.
+  class EntriesBase {
+   public:
+    virtual ~EntriesBase() = default;
+    virtual int size() const = 0;
+  };
+
+  template <typename T>
+  class Entries : public EntriesBase {
+   public:
+    int size() const override { return static_cast<int>(entries.size()); }
+    std::vector<T> entries;
+  };
+
+  // Returns a key that is unique for each type |T|.
+  template <typename T>
+  static const void *GetTypeKey() {
+    static const char key = 0;
+    return &key;
+  }
+
+  template <typename T>
+  std::vector<T> &GetEntries() {
+    std::unique_ptr<EntriesBase> &entries = entries_[GetTypeKey<T>()];
+    if (entries == nullptr) {
+      entries.reset(new Entries<T>());
+    }
+    return static_cast<Entries<T> *>(entries.get())->entries;
+  }
+
+  std::unordered_map<const void *, std::unique_ptr<EntriesBase>> entries_;
+};
+
+// Helper class that acquires |container| from |pool| when it is created and
+// releases it back to the pool when it goes out of scope. Does nothing when
+// |pool| is nullptr.
+template <typename ContainerT>
+class ScopedPooledContainer {
+ public:
+  ScopedPooledContainer(DecoderResourcePool *pool, ContainerT *container)
+      : pool_(pool), container_(container) {
+    if (pool_ != nullptr) {
+      pool_->Acquire(container_);
+    }
+  }
+  ScopedPooledContainer(const ScopedPooledContainer &) = delete;
+  ScopedPooledContainer &operator=(const ScopedPooledContainer &) = delete;
+  ~ScopedPooledContainer() {
+    if (pool_ != nullptr) {
+      pool_->Release(container_);
+    }
+  }
+
+ private:
+  DecoderResourcePool *const pool_;
+  ContainerT *const container_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_DECODER_RESOURCE_POOL_H_
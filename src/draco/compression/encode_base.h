@@ -43,6 +43,40 @@ class EncoderBase {
   // Note that this can slow down encoding for certain encoders.
   void SetTrackEncodedProperties(bool flag);
 
+  // Sets the number of threads used for encoding of point attributes.
+  // Attributes that do not depend on each other are transformed, predicted
+  // and entropy coded concurrently into separate buffers that are then
+  // concatenated in the same order as in the single-threaded mode, so the
+  // encoded data is the same for any number of threads. The edgebreaker
+  // encoder also uses the threads to construct the corner table of the
+  // encoded mesh. Default is 1 (no extra threads).
+  void SetNumEncodingThreads(int num_threads);
+
+  // Sets the depth of the subtree index of point clouds encoded with the
+  // kd-tree method. When |depth| is greater than 0, each subtree of the
+  // kd-tree rooted at |depth| is encoded independently of the other subtrees
+  // and their sizes are stored in the encoded data. This allows decoders to
+  // decode only the subtrees that intersect a query box (see
+  // Decoder::SetKdTreeQueryBox()) at the cost of a slightly lower compression
+  // rate. Must be in range [0, 255]. Default is 0 (no index).
+  void SetKdTreeIndexDepth(int depth);
+
+  // Enables progressive encoding of point clouds encoded with the kd-tree
+  // method. Each level of the kd-tree is then encoded as a separate block so
+  // that a coarse version of the point cloud can be decoded from a partially
+  // received buffer (see PointCloudKdTreeDecoder::DecodeProgressive()). Cannot
+  // be combined with the subtree index. Default is false.
+  void SetKdTreeProgressiveEncoding(bool flag);
+
+  // Allows the entropy coder to use multiple interleaved rANS states for large
+  // arrays of symbols that are encoded directly (SYMBOL_CODING_RAW_INTERLEAVED),
+  // which speeds up their decoding. Such data can be decoded only by decoders
+  // that support mesh bitstream version 2.3 or point cloud bitstream version
+  // 2.4, so the encoder writes these versions when the flag is set. Default is
+  // false (the data can be decoded by all decoders of mesh bitstream version
+  // 2.2 and point cloud bitstream version 2.3).
+  void SetInterleavedSymbolCoding(bool flag);
+
   // Returns the number of encoded points and faces during the last encoding
   // operation. Returns 0 if SetTrackEncodedProperties() was not set.
   size_t num_encoded_points() const { return num_encoded_points_; }
@@ -126,6 +160,26 @@ void EncoderBase<EncoderOptionsT>::SetTrackEncodedProperties(bool flag) {
   options_.SetGlobalBool("store_number_of_encoded_faces", flag);
 }
 
+template <class EncoderOptionsT>
+void EncoderBase<EncoderOptionsT>::SetNumEncodingThreads(int num_threads) {
+  options_.SetGlobalInt("num_encoding_threads", num_threads);
+}
+
+template <class EncoderOptionsT>
+void EncoderBase<EncoderOptionsT>::SetKdTreeIndexDepth(int depth) {
+  options_.SetGlobalInt("kd_tree_index_depth", depth);
+}
+
+template <class EncoderOptionsT>
+void EncoderBase<EncoderOptionsT>::SetKdTreeProgressiveEncoding(bool flag) {
+  options_.SetGlobalBool("kd_tree_progressive", flag);
+}
+
+template <class EncoderOptionsT>
+void EncoderBase<EncoderOptionsT>::SetInterleavedSymbolCoding(bool flag) {
+  options_.SetGlobalBool("interleaved_symbol_coding", flag);
+}
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ENCODE_BASE_H_
@@ -0,0 +1,48 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark/benchmark.h"
+#include "draco/compression/encode.h"
+#include "draco/core/draco_benchmark_utils.h"
+
+namespace draco {
+namespace {
+
+// Encodes the input meshes with the requested speed and quantization. The
+// throughput is reported with respect to the size of the uncompressed input.
+void BM_EncodeMeshToBuffer(benchmark::State &state) {
+  const Mesh *const mesh = GetBenchmarkMesh(state.range(kBenchmarkMeshArg));
+  if (mesh == nullptr) {
+    state.SkipWithError("Failed to load the input mesh.");
+    return;
+  }
+  const int speed = state.range(kBenchmarkSpeedArg);
+  const int quantization_bits = state.range(kBenchmarkQuantizationArg);
+  EncoderBuffer buffer;
+  for (auto _ : state) {
+    const Status status =
+        EncodeBenchmarkMesh(*mesh, speed, quantization_bits, &buffer);
+    if (!status.ok()) {
+      state.SkipWithError(status.error_msg());
+      return;
+    }
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  SetMeshThroughputCounters(*mesh, GetMeshDataSize(*mesh), state);
+  state.counters["encoded_bytes"] = static_cast<double>(buffer.size());
+}
+BENCHMARK(BM_EncodeMeshToBuffer)->Apply(ApplyMeshSpeedQuantizationArgs);
+
+}  // namespace
+}  // namespace draco
@@ -15,9 +15,11 @@
 
 #include "draco/compression/encode.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 #include "draco/attributes/attribute_quantization_transform.h"
 #include "draco/compression/config/compression_shared.h"
@@ -377,6 +379,96 @@ TEST_F(EncodeTest, TestTrackingOfNumberOfEncodedEntriesNotSet) {
   ASSERT_EQ(encoder.num_encoded_faces(), 0);
 }
 
+TEST_F(EncodeTest, TestStreamingOutput) {
+  // Tests that data streamed through the output function of the encoder
+  // buffer is the same as the data encoded into a regular buffer.
+  std::unique_ptr<draco::Mesh> mesh(
+      draco::ReadMeshFromTestFile("test_nm.obj"));
+  ASSERT_NE(mesh, nullptr);
+
+  for (const int method :
+       {draco::MESH_EDGEBREAKER_ENCODING, draco::MESH_SEQUENTIAL_ENCODING}) {
+    draco::Encoder encoder;
+    encoder.SetEncodingMethod(method);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
+    draco::EncoderBuffer expected_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &expected_buffer));
+
+    std::vector<char> streamed_data;
+    int num_flushes = 0;
+    draco::EncoderBuffer buffer;
+    buffer.SetOutputFunction(
+        [&streamed_data, &num_flushes](const char *data, size_t size) {
+          streamed_data.insert(streamed_data.end(), data, data + size);
+          ++num_flushes;
+          return true;
+        });
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+
+    // All data should have been passed to the output function in multiple
+    // sections.
+    ASSERT_EQ(buffer.size(), 0);
+    ASSERT_GT(num_flushes, 1);
+    ASSERT_EQ(buffer.num_flushed_bytes(), expected_buffer.size());
+    ASSERT_EQ(streamed_data.size(), expected_buffer.size());
+    ASSERT_TRUE(std::equal(streamed_data.begin(), streamed_data.end(),
+                           expected_buffer.data()));
+  }
+}
+
+TEST_F(EncodeTest, TestStreamingOutputFailure) {
+  // Tests that the encoder reports an error when the output function fails.
+  std::unique_ptr<draco::Mesh> mesh(
+      draco::ReadMeshFromTestFile("test_nm.obj"));
+  ASSERT_NE(mesh, nullptr);
+
+  draco::EncoderBuffer buffer;
+  buffer.SetOutputFunction(
+      [](const char * /*data*/, size_t /*size*/) { return false; });
+  draco::Encoder encoder;
+  ASSERT_FALSE(encoder.EncodeMeshToBuffer(*mesh, &buffer).ok());
+}
+
+TEST_F(EncodeTest, TestParallelAttributeEncoding) {
+  // Tests that encoding of attributes on multiple threads produces the same
+  // data as the single-threaded encoding.
+  std::unique_ptr<draco::Mesh> mesh(
+      draco::ReadMeshFromTestFile("cube_att.obj"));
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_GT(mesh->num_attributes(), 2);
+
+  for (const int method :
+       {draco::MESH_EDGEBREAKER_ENCODING, draco::MESH_SEQUENTIAL_ENCODING}) {
+    draco::Encoder encoder;
+    encoder.SetEncodingMethod(method);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::POSITION, 14);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::TEX_COORD, 12);
+    encoder.SetAttributeQuantization(draco::GeometryAttribute::NORMAL, 10);
+    draco::EncoderBuffer expected_buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &expected_buffer));
+
+    encoder.SetNumEncodingThreads(4);
+    draco::EncoderBuffer buffer;
+    DRACO_ASSERT_OK(encoder.EncodeMeshToBuffer(*mesh, &buffer));
+    ASSERT_EQ(buffer.size(), expected_buffer.size());
+    ASSERT_TRUE(std::equal(buffer.data(), buffer.data() + buffer.size(),
+                           expected_buffer.data()));
+
+    // Also test the point cloud encoding of the same data.
+    draco::EncoderBuffer expected_pc_buffer;
+    encoder.SetNumEncodingThreads(1);
+    DRACO_ASSERT_OK(
+        encoder.EncodePointCloudToBuffer(*mesh, &expected_pc_buffer));
+    encoder.SetNumEncodingThreads(4);
+    draco::EncoderBuffer pc_buffer;
+    DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(*mesh, &pc_buffer));
+    ASSERT_EQ(pc_buffer.size(), expected_pc_buffer.size());
+    ASSERT_TRUE(std::equal(pc_buffer.data(),
+                           pc_buffer.data() + pc_buffer.size(),
+                           expected_pc_buffer.data()));
+  }
+}
+
 TEST_F(EncodeTest, TestNoPosQuantizationNormalCoding) {
   // Tests that we can encode and decode a file with quantized normals but
   // non-quantized positions.
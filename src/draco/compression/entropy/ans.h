@@ -360,42 +360,76 @@ class RAnsEncoder {
 
   // Needs to be called after all symbols are encoded.
   inline int write_end() {
-    uint32_t state;
-    DRACO_DCHECK_GE(ans_.state, l_rans_base);
-    DRACO_DCHECK_LT(ans_.state, l_rans_base * DRACO_ANS_IO_BASE);
-    state = ans_.state - l_rans_base;
+    write_state(ans_.state);
+    return ans_.buf_offset;
+  }
+
+  // rANS with normalization.
+  // sym->prob takes the place of l_s from the paper.
+  // rans_precision is m.
+  inline void rans_write(const struct rans_sym *const sym) {
+    rans_write(sym, &ans_.state);
+  }
+
+  // Encodes |num_values| |symbols| using |num_states_t| interleaved rANS
+  // states that share the output buffer. Symbol i is encoded with the state
+  // i % num_states_t so that the decoder can decode consecutive symbols
+  // independently of each other (see RAnsDecoder::rans_read_interleaved()).
+  // |probability_table| maps the symbols to their probabilities. Replaces
+  // calls to rans_write() and write_end(). Returns the number of bytes
+  // written.
+  template <int num_states_t>
+  inline int rans_write_interleaved(const uint32_t *symbols, int num_values,
+                                    const struct rans_sym *probability_table) {
+    uint32_t states[num_states_t];
+    for (int s = 0; s < num_states_t; ++s) {
+      states[s] = l_rans_base;
+    }
+    // The symbols are encoded in the reverse order.
+    for (int i = num_values - 1; i >= 0; --i) {
+      rans_write(&probability_table[symbols[i]], &states[i % num_states_t]);
+    }
+    // The first state must be stored last because the decoder reads the
+    // buffer from the end.
+    for (int s = num_states_t - 1; s >= 0; --s) {
+      write_state(states[s]);
+    }
+    return ans_.buf_offset;
+  }
+
+ private:
+  inline void rans_write(const struct rans_sym *const sym,
+                         uint32_t *const state) {
+    const uint32_t p = sym->prob;
+    while (*state >= l_rans_base / rans_precision * DRACO_ANS_IO_BASE * p) {
+      ans_.buf[ans_.buf_offset++] = *state % DRACO_ANS_IO_BASE;
+      *state /= DRACO_ANS_IO_BASE;
+    }
+    *state = (*state / p) * rans_precision + *state % p + sym->cum_prob;
+  }
+
+  // Stores the |state| at the current position of the output buffer.
+  inline void write_state(uint32_t state) {
+    DRACO_DCHECK_GE(state, l_rans_base);
+    DRACO_DCHECK_LT(state, l_rans_base * DRACO_ANS_IO_BASE);
+    state -= l_rans_base;
     if (state < (1 << 6)) {
       ans_.buf[ans_.buf_offset] = (0x00 << 6) + state;
-      return ans_.buf_offset + 1;
+      ans_.buf_offset += 1;
     } else if (state < (1 << 14)) {
       mem_put_le16(ans_.buf + ans_.buf_offset, (0x01 << 14) + state);
-      return ans_.buf_offset + 2;
+      ans_.buf_offset += 2;
     } else if (state < (1 << 22)) {
       mem_put_le24(ans_.buf + ans_.buf_offset, (0x02 << 22) + state);
-      return ans_.buf_offset + 3;
+      ans_.buf_offset += 3;
     } else if (state < (1 << 30)) {
       mem_put_le32(ans_.buf + ans_.buf_offset, (0x03u << 30u) + state);
-      return ans_.buf_offset + 4;
+      ans_.buf_offset += 4;
     } else {
       DRACO_DCHECK(0 && "State is too large to be serialized");
-      return ans_.buf_offset;
     }
   }
 
-  // rANS with normalization.
-  // sym->prob takes the place of l_s from the paper.
-  // rans_precision is m.
-  inline void rans_write(const struct rans_sym *const sym) {
-    const uint32_t p = sym->prob;
-    while (ans_.state >= l_rans_base / rans_precision * DRACO_ANS_IO_BASE * p) {
-      ans_.buf[ans_.buf_offset++] = ans_.state % DRACO_ANS_IO_BASE;
-      ans_.state /= DRACO_ANS_IO_BASE;
-    }
-    ans_.state =
-        (ans_.state / p) * rans_precision + ans_.state % p + sym->cum_prob;
-  }
-
- private:
   static constexpr int rans_precision = 1 << rans_precision_bits_t;
   static constexpr int l_rans_base = rans_precision * 4;
   AnsCoder ans_;
@@ -419,38 +453,9 @@ class RAnsDecoder {
   // number of bytes encoded by the encoder. A non zero return value is an
   // error.
   inline int read_init(const uint8_t *const buf, int offset) {
-    unsigned x;
-    if (offset < 1) {
-      return 1;
-    }
     ans_.buf = buf;
-    x = buf[offset - 1] >> 6;
-    if (x == 0) {
-      ans_.buf_offset = offset - 1;
-      ans_.state = buf[offset - 1] & 0x3F;
-    } else if (x == 1) {
-      if (offset < 2) {
-        return 1;
-      }
-      ans_.buf_offset = offset - 2;
-      ans_.state = mem_get_le16(buf + offset - 2) & 0x3FFF;
-    } else if (x == 2) {
-      if (offset < 3) {
-        return 1;
-      }
-      ans_.buf_offset = offset - 3;
-      ans_.state = mem_get_le24(buf + offset - 3) & 0x3FFFFF;
-    } else if (x == 3) {
-      ans_.buf_offset = offset - 4;
-      ans_.state = mem_get_le32(buf + offset - 4) & 0x3FFFFFFF;
-    } else {
-      return 1;
-    }
-    ans_.state += l_rans_base;
-    if (ans_.state >= l_rans_base * DRACO_ANS_IO_BASE) {
-      return 1;
-    }
-    return 0;
+    ans_.buf_offset = offset;
+    return read_state(&ans_.state);
   }
 
   inline int read_end() { return ans_.state == l_rans_base; }
@@ -475,6 +480,46 @@ class RAnsDecoder {
     return sym.val;
   }
 
+  // Decodes |num_values| symbols encoded by
+  // RAnsEncoder::rans_write_interleaved() with the same |num_states_t| from
+  // |offset| bytes of |buf|. Returns false on error.
+  template <int num_states_t>
+  inline bool rans_read_interleaved(const uint8_t *const buf, int offset,
+                                    int num_values, uint32_t *out_values) {
+    ans_.buf = buf;
+    ans_.buf_offset = offset;
+    uint32_t states[num_states_t];
+    for (int s = 0; s < num_states_t; ++s) {
+      if (read_state(&states[s]) != 0) {
+        return false;
+      }
+    }
+    // Unlike in rans_read(), the states must be renormalized right after each
+    // symbol is decoded because all of them read from the same buffer. The
+    // states are first advanced independently and renormalized afterwards,
+    // which allows the processor to overlap the lookups of all states.
+    int i = 0;
+    for (; i + num_states_t <= num_values; i += num_states_t) {
+      for (int s = 0; s < num_states_t; ++s) {
+        out_values[i + s] = rans_read_no_renorm(&states[s]);
+      }
+      for (int s = 0; s < num_states_t; ++s) {
+        rans_renorm(&states[s]);
+      }
+    }
+    for (int s = 0; i < num_values; ++i, ++s) {
+      out_values[i] = rans_read_no_renorm(&states[s]);
+      rans_renorm(&states[s]);
+    }
+    // All states must end up in the initial state of the encoder.
+    for (int s = 0; s < num_states_t; ++s) {
+      if (states[s] != l_rans_base) {
+        return false;
+      }
+    }
+    return ans_.buf_offset == 0;
+  }
+
   // Construct a lookup table with |rans_precision| number of entries.
   // Returns false if the table couldn't be built (because of wrong input data).
   inline bool rans_build_look_up_table(const uint32_t token_probs[],
@@ -502,6 +547,51 @@ class RAnsDecoder {
   }
 
  private:
+  // Reads a state stored by RAnsEncoder at the end of the unread part of the
+  // buffer. A non zero return value is an error.
+  inline int read_state(uint32_t *const state) {
+    const int offset = ans_.buf_offset;
+    const uint8_t *const buf = ans_.buf;
+    if (offset < 1) {
+      return 1;
+    }
+    const unsigned x = buf[offset - 1] >> 6;
+    if (offset < static_cast<int>(x) + 1) {
+      return 1;
+    }
+    if (x == 0) {
+      *state = buf[offset - 1] & 0x3F;
+    } else if (x == 1) {
+      *state = mem_get_le16(buf + offset - 2) & 0x3FFF;
+    } else if (x == 2) {
+      *state = mem_get_le24(buf + offset - 3) & 0x3FFFFF;
+    } else {
+      *state = mem_get_le32(buf + offset - 4) & 0x3FFFFFFF;
+    }
+    ans_.buf_offset = offset - 1 - static_cast<int>(x);
+    *state += l_rans_base;
+    if (*state >= l_rans_base * DRACO_ANS_IO_BASE) {
+      return 1;
+    }
+    return 0;
+  }
+
+  // Decodes a symbol from |state| without renormalizing the state.
+  inline uint32_t rans_read_no_renorm(uint32_t *const state) {
+    const uint32_t quo = *state / rans_precision;
+    const uint32_t rem = *state % rans_precision;
+    const uint32_t symbol = lut_table_[rem];
+    const rans_sym &sym = probability_table_[symbol];
+    *state = quo * sym.prob + rem - sym.cum_prob;
+    return symbol;
+  }
+
+  inline void rans_renorm(uint32_t *const state) {
+    while (*state < l_rans_base && ans_.buf_offset > 0) {
+      *state = *state * DRACO_ANS_IO_BASE + ans_.buf[--ans_.buf_offset];
+    }
+  }
+
   inline void fetch_sym(struct rans_dec_sym *out, uint32_t rem) {
     uint32_t symbol = lut_table_[rem];
     out->val = symbol;
@@ -43,7 +43,20 @@ class RAnsSymbolDecoder {
   uint32_t DecodeSymbol() { return ans_.rans_read(); }
   void EndDecoding();
 
+  // Decodes |num_values| symbols encoded by
+  // RAnsSymbolEncoder::EncodeInterleavedSymbols() with the same
+  // |num_states_t|. Replaces the calls to StartDecoding(), DecodeSymbol() and
+  // EndDecoding(). The buffer will be advanced past the encoded data.
+  template <int num_states_t>
+  bool DecodeInterleavedSymbols(uint32_t num_values, DecoderBuffer *buffer,
+                                uint32_t *out_values);
+
  private:
+  // Decodes the size of the encoded rANS data and returns a pointer to the
+  // data. The buffer will be advanced past the encoded data.
+  bool DecodeDataHead(DecoderBuffer *buffer, const uint8_t **out_data_head,
+                      int64_t *out_bytes_encoded);
+
   static constexpr int rans_precision_bits_ =
       ComputeRAnsPrecisionFromUniqueSymbolsBitLength(
           unique_symbols_bit_length_t);
@@ -133,6 +146,35 @@ bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::Create(
 template <int unique_symbols_bit_length_t>
 bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::StartDecoding(
     DecoderBuffer *buffer) {
+  const uint8_t *data_head;
+  int64_t bytes_encoded;
+  if (!DecodeDataHead(buffer, &data_head, &bytes_encoded)) {
+    return false;
+  }
+  if (ans_.read_init(data_head, static_cast<int>(bytes_encoded)) != 0) {
+    return false;
+  }
+  return true;
+}
+
+template <int unique_symbols_bit_length_t>
+template <int num_states_t>
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::DecodeInterleavedSymbols(
+    uint32_t num_values, DecoderBuffer *buffer, uint32_t *out_values) {
+  const uint8_t *data_head;
+  int64_t bytes_encoded;
+  if (!DecodeDataHead(buffer, &data_head, &bytes_encoded)) {
+    return false;
+  }
+  return ans_.template rans_read_interleaved<num_states_t>(
+      data_head, static_cast<int>(bytes_encoded), static_cast<int>(num_values),
+      out_values);
+}
+
+template <int unique_symbols_bit_length_t>
+bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::DecodeDataHead(
+    DecoderBuffer *buffer, const uint8_t **out_data_head,
+    int64_t *out_bytes_encoded) {
   uint64_t bytes_encoded;
   // Decode the number of bytes encoded by the encoder.
 #ifdef DRACO_BACKWARDS_COMPATIBILITY_SUPPORTED
@@ -155,9 +197,8 @@ bool RAnsSymbolDecoder<unique_symbols_bit_length_t>::StartDecoding(
       reinterpret_cast<const uint8_t *>(buffer->data_head());
   // Advance the buffer past the rANS data.
   buffer->Advance(bytes_encoded);
-  if (ans_.read_init(data_head, static_cast<int>(bytes_encoded)) != 0) {
-    return false;
-  }
+  *out_data_head = data_head;
+  *out_bytes_encoded = static_cast<int64_t>(bytes_encoded);
   return true;
 }
 
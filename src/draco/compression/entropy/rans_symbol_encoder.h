@@ -46,6 +46,14 @@ class RAnsSymbolEncoder {
   }
   void EndEncoding(EncoderBuffer *buffer);
 
+  // Encodes all |symbols| using |num_states_t| interleaved rANS states (see
+  // RAnsEncoder::rans_write_interleaved()). The data can be decoded only with
+  // RAnsSymbolDecoder::DecodeInterleavedSymbols(). Replaces the calls to
+  // StartEncoding(), EncodeSymbol() and EndEncoding().
+  template <int num_states_t>
+  void EncodeInterleavedSymbols(const uint32_t *symbols, int num_values,
+                                EncoderBuffer *buffer);
+
   // rANS requires to encode the input symbols in the reverse order.
   static constexpr bool needs_reverse_encoding() { return true; }
 
@@ -67,6 +75,13 @@ class RAnsSymbolEncoder {
   // Encodes the probability table into the output buffer.
   bool EncodeTable(EncoderBuffer *buffer);
 
+  // Allocates space for the encoded data in the |buffer|. |num_states| is the
+  // number of rANS states stored at the end of the data.
+  void ReserveEncodingSpace(int num_states, EncoderBuffer *buffer);
+
+  // Prepends the size of the encoded data to the data and trims the |buffer|.
+  void FinishEncoding(uint64_t bytes_written, EncoderBuffer *buffer);
+
   static constexpr int rans_precision_bits_ =
       ComputeRAnsPrecisionFromUniqueSymbolsBitLength(
           unique_symbols_bit_length_t);
@@ -253,8 +268,32 @@ bool RAnsSymbolEncoder<unique_symbols_bit_length_t>::EncodeTable(
 template <int unique_symbols_bit_length_t>
 void RAnsSymbolEncoder<unique_symbols_bit_length_t>::StartEncoding(
     EncoderBuffer *buffer) {
+  ReserveEncodingSpace(1, buffer);
+}
+
+template <int unique_symbols_bit_length_t>
+void RAnsSymbolEncoder<unique_symbols_bit_length_t>::EndEncoding(
+    EncoderBuffer *buffer) {
+  // TODO(fgalligan): Look into changing this to uint32_t as write_end()
+  // returns an int.
+  FinishEncoding(static_cast<uint64_t>(ans_.write_end()), buffer);
+}
+
+template <int unique_symbols_bit_length_t>
+template <int num_states_t>
+void RAnsSymbolEncoder<unique_symbols_bit_length_t>::EncodeInterleavedSymbols(
+    const uint32_t *symbols, int num_values, EncoderBuffer *buffer) {
+  ReserveEncodingSpace(num_states_t, buffer);
+  const int bytes_written = ans_.template rans_write_interleaved<num_states_t>(
+      symbols, num_values, probability_table_.data());
+  FinishEncoding(static_cast<uint64_t>(bytes_written), buffer);
+}
+
+template <int unique_symbols_bit_length_t>
+void RAnsSymbolEncoder<unique_symbols_bit_length_t>::ReserveEncodingSpace(
+    int num_states, EncoderBuffer *buffer) {
   // Allocate extra storage just in case.
-  const uint64_t required_bits = 2 * num_expected_bits_ + 32;
+  const uint64_t required_bits = 2 * num_expected_bits_ + 32 * num_states;
 
   buffer_offset_ = buffer->size();
   const int64_t required_bytes = (required_bits + 7) / 8;
@@ -265,13 +304,9 @@ void RAnsSymbolEncoder<unique_symbols_bit_length_t>::StartEncoding(
 }
 
 template <int unique_symbols_bit_length_t>
-void RAnsSymbolEncoder<unique_symbols_bit_length_t>::EndEncoding(
-    EncoderBuffer *buffer) {
+void RAnsSymbolEncoder<unique_symbols_bit_length_t>::FinishEncoding(
+    uint64_t bytes_written, EncoderBuffer *buffer) {
   char *const src = const_cast<char *>(buffer->data()) + buffer_offset_;
-
-  // TODO(fgalligan): Look into changing this to uint32_t as write_end()
-  // returns an int.
-  const uint64_t bytes_written = static_cast<uint64_t>(ans_.write_end());
   EncoderBuffer var_size_buffer;
   EncodeVarint(bytes_written, &var_size_buffer);
   const uint32_t size_len = static_cast<uint32_t>(var_size_buffer.size());
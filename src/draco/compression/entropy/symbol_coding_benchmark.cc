@@ -0,0 +1,115 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <random>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "draco/compression/config/compression_shared.h"
+#include "draco/compression/entropy/symbol_decoding.h"
+#include "draco/compression/entropy/symbol_encoding.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+
+namespace draco {
+namespace {
+
+constexpr int kNumBenchmarkSymbols = 1 << 20;
+
+// Generates symbols that resemble prediction residuals: values have up to
+// |max_bit_length| bits, with small values being much more common than large
+// ones. The generator is seeded with a constant so that all runs see the same
+// input.
+std::vector<uint32_t> GenerateSymbols(int max_bit_length) {
+  std::mt19937 rng(0x5eed);
+  std::vector<uint32_t> symbols(kNumBenchmarkSymbols);
+  for (uint32_t &symbol : symbols) {
+    const uint32_t value = rng() & ((1u << max_bit_length) - 1);
+    symbol = value >> (rng() % max_bit_length);
+  }
+  return symbols;
+}
+
+// Registers all symbol coding methods with all compression levels for a few
+// different symbol bit lengths. The compression level does not affect the
+// tagged scheme so only the default level is used for it.
+void ApplySymbolCodingArgs(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"method", "level", "bits"});
+  for (const int bits : {4, 10, 16}) {
+    b->Args({SYMBOL_CODING_TAGGED, 7, bits});
+    for (int level = 0; level <= 10; ++level) {
+      b->Args({SYMBOL_CODING_RAW, level, bits});
+      b->Args({SYMBOL_CODING_RAW_INTERLEAVED, level, bits});
+    }
+  }
+}
+
+bool EncodeBenchmarkSymbols(const std::vector<uint32_t> &symbols,
+                            const benchmark::State &state,
+                            EncoderBuffer *out_buffer) {
+  Options options;
+  SetSymbolEncodingMethod(&options,
+                          static_cast<SymbolCodingMethod>(state.range(0)));
+  SetSymbolEncodingCompressionLevel(&options, state.range(1));
+  out_buffer->Clear();
+  return EncodeSymbols(symbols.data(), static_cast<int>(symbols.size()), 1,
+                       &options, out_buffer);
+}
+
+void BM_EncodeSymbols(benchmark::State &state) {
+  const std::vector<uint32_t> symbols = GenerateSymbols(state.range(2));
+  EncoderBuffer buffer;
+  for (auto _ : state) {
+    if (!EncodeBenchmarkSymbols(symbols, state, &buffer)) {
+      state.SkipWithError("Failed to encode symbols.");
+      return;
+    }
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          symbols.size() * sizeof(uint32_t));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          symbols.size());
+  state.counters["encoded_bytes"] = static_cast<double>(buffer.size());
+}
+BENCHMARK(BM_EncodeSymbols)->Apply(ApplySymbolCodingArgs);
+
+void BM_DecodeSymbols(benchmark::State &state) {
+  const std::vector<uint32_t> symbols = GenerateSymbols(state.range(2));
+  EncoderBuffer encoded;
+  if (!EncodeBenchmarkSymbols(symbols, state, &encoded)) {
+    state.SkipWithError("Failed to encode symbols.");
+    return;
+  }
+  std::vector<uint32_t> decoded(symbols.size());
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    buffer.set_bitstream_version(kDracoMeshBitstreamVersion);
+    if (!DecodeSymbols(static_cast<uint32_t>(decoded.size()), 1, true,
+                       &buffer, decoded.data())) {
+      state.SkipWithError("Failed to decode symbols.");
+      return;
+    }
+    benchmark::DoNotOptimize(decoded.data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          decoded.size() * sizeof(uint32_t));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          decoded.size());
+}
+BENCHMARK(BM_DecodeSymbols)->Apply(ApplySymbolCodingArgs);
+
+}  // namespace
+}  // namespace draco
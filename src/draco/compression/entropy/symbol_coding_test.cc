@@ -83,7 +83,9 @@ TEST_F(SymbolCodingTest, TestManyNumbers) {
     DecoderBuffer db;
     db.Init(eb.data(), eb.size());
     db.set_bitstream_version(bitstream_version_);
-    ASSERT_TRUE(DecodeSymbols(in_values.size(), 1, &db, &out_values[0]));
+    // SYMBOL_CODING_RAW_INTERLEAVED needs to be explicitly allowed.
+    ASSERT_TRUE(
+        DecodeSymbols(in_values.size(), 1, true, &db, &out_values[0]));
     for (uint32_t i = 0; i < in_values.size(); ++i) {
       ASSERT_EQ(in_values[i], out_values[i]);
     }
@@ -158,6 +160,70 @@ TEST_F(SymbolCodingTest, TestLargeNumberCondition) {
   }
 }
 
+TEST_F(SymbolCodingTest, TestInterleavedRawSymbols) {
+  // This test verifies that the interleaved raw scheme correctly encodes
+  // inputs whose size is not a multiple of the number of interleaved rANS
+  // states, including inputs with fewer symbols than states.
+  for (const int num_values : {1, 3, 7, 8, 9, 1001, 5003}) {
+    std::vector<uint32_t> in(num_values);
+    for (int i = 0; i < num_values; ++i) {
+      in[i] = (i * 7919) % 61 >> (i % 5);
+    }
+    for (int compression_level = 0; compression_level <= 10;
+         compression_level += 5) {
+      Options options;
+      SetSymbolEncodingMethod(&options, SYMBOL_CODING_RAW_INTERLEAVED);
+      SetSymbolEncodingCompressionLevel(&options, compression_level);
+      EncoderBuffer eb;
+      ASSERT_TRUE(EncodeSymbols(in.data(), num_values, 1, &options, &eb));
+
+      std::vector<uint32_t> out(num_values);
+      DecoderBuffer db;
+      db.Init(eb.data(), eb.size());
+      db.set_bitstream_version(bitstream_version_);
+      ASSERT_TRUE(DecodeSymbols(num_values, 1, true, &db, &out[0]));
+      ASSERT_EQ(db.remaining_size(), 0);
+      for (int i = 0; i < num_values; ++i) {
+        ASSERT_EQ(in[i], out[i]);
+      }
+
+      // The scheme must be rejected for bitstreams that don't support it.
+      db.Init(eb.data(), eb.size());
+      ASSERT_FALSE(DecodeSymbols(num_values, 1, &db, &out[0]));
+    }
+  }
+}
+
+TEST_F(SymbolCodingTest, TestInterleavedRawSymbolsOptIn) {
+  // This test verifies that the interleaved raw scheme is used for large inputs
+  // only when it is enabled in the options.
+  const int num_values = 5003;
+  std::vector<uint32_t> in(num_values);
+  for (int i = 0; i < num_values; ++i) {
+    in[i] = (i * 7919) % 61;
+  }
+  for (const bool interleaving : {false, true}) {
+    Options options;
+    SetSymbolEncodingInterleaving(&options, interleaving);
+    EncoderBuffer eb;
+    ASSERT_TRUE(EncodeSymbols(in.data(), num_values, 1, &options, &eb));
+    ASSERT_GT(eb.size(), 0);
+    ASSERT_EQ(static_cast<uint8_t>(eb.data()[0]),
+              interleaving ? SYMBOL_CODING_RAW_INTERLEAVED : SYMBOL_CODING_RAW);
+
+    std::vector<uint32_t> out(num_values);
+    DecoderBuffer db;
+    db.Init(eb.data(), eb.size());
+    db.set_bitstream_version(bitstream_version_);
+    ASSERT_TRUE(DecodeSymbols(num_values, 1, interleaving, &db, &out[0]));
+    ASSERT_EQ(in, out);
+  }
+  // No interleaving without options.
+  EncoderBuffer eb;
+  ASSERT_TRUE(EncodeSymbols(in.data(), num_values, 1, nullptr, &eb));
+  ASSERT_EQ(static_cast<uint8_t>(eb.data()[0]), SYMBOL_CODING_RAW);
+}
+
 TEST_F(SymbolCodingTest, TestConversionFullRange) {
   TestConvertToSymbolAndBack(static_cast<int8_t>(-128));
   TestConvertToSymbolAndBack(static_cast<int8_t>(-127));
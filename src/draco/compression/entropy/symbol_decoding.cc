@@ -26,11 +26,18 @@ bool DecodeTaggedSymbols(uint32_t num_values, int num_components,
                          DecoderBuffer *src_buffer, uint32_t *out_values);
 
 template <template <int> class SymbolDecoderT>
-bool DecodeRawSymbols(uint32_t num_values, DecoderBuffer *src_buffer,
-                      uint32_t *out_values);
+bool DecodeRawSymbols(uint32_t num_values, int num_interleaved_states,
+                      DecoderBuffer *src_buffer, uint32_t *out_values);
 
 bool DecodeSymbols(uint32_t num_values, int num_components,
                    DecoderBuffer *src_buffer, uint32_t *out_values) {
+  return DecodeSymbols(num_values, num_components, false, src_buffer,
+                       out_values);
+}
+
+bool DecodeSymbols(uint32_t num_values, int num_components,
+                   bool allow_interleaved, DecoderBuffer *src_buffer,
+                   uint32_t *out_values) {
   if (num_values == 0) {
     return true;
   }
@@ -43,8 +50,15 @@ bool DecodeSymbols(uint32_t num_values, int num_components,
     return DecodeTaggedSymbols<RAnsSymbolDecoder>(num_values, num_components,
                                                   src_buffer, out_values);
   } else if (scheme == SYMBOL_CODING_RAW) {
-    return DecodeRawSymbols<RAnsSymbolDecoder>(num_values, src_buffer,
+    return DecodeRawSymbols<RAnsSymbolDecoder>(num_values, 1, src_buffer,
                                                out_values);
+  } else if (scheme == SYMBOL_CODING_RAW_INTERLEAVED && allow_interleaved) {
+    uint8_t num_interleaved_states;
+    if (!src_buffer->Decode(&num_interleaved_states)) {
+      return false;
+    }
+    return DecodeRawSymbols<RAnsSymbolDecoder>(
+        num_values, num_interleaved_states, src_buffer, out_values);
   }
   return false;
 }
@@ -88,8 +102,8 @@ bool DecodeTaggedSymbols(uint32_t num_values, int num_components,
 }
 
 template <class SymbolDecoderT>
-bool DecodeRawSymbolsInternal(uint32_t num_values, DecoderBuffer *src_buffer,
-                              uint32_t *out_values) {
+bool DecodeRawSymbolsInternal(uint32_t num_values, int num_interleaved_states,
+                              DecoderBuffer *src_buffer, uint32_t *out_values) {
   SymbolDecoderT decoder;
   if (!decoder.Create(src_buffer)) {
     return false;
@@ -99,6 +113,17 @@ bool DecodeRawSymbolsInternal(uint32_t num_values, DecoderBuffer *src_buffer,
     return false;  // Wrong number of symbols.
   }
 
+  if (num_interleaved_states == 4) {
+    return decoder.template DecodeInterleavedSymbols<4>(num_values, src_buffer,
+                                                        out_values);
+  }
+  if (num_interleaved_states == 8) {
+    return decoder.template DecodeInterleavedSymbols<8>(num_values, src_buffer,
+                                                        out_values);
+  }
+  if (num_interleaved_states != 1) {
+    return false;  // Unsupported number of interleaved rANS states.
+  }
   if (!decoder.StartDecoding(src_buffer)) {
     return false;
   }
@@ -112,67 +137,67 @@ bool DecodeRawSymbolsInternal(uint32_t num_values, DecoderBuffer *src_buffer,
 }
 
 template <template <int> class SymbolDecoderT>
-bool DecodeRawSymbols(uint32_t num_values, DecoderBuffer *src_buffer,
-                      uint32_t *out_values) {
+bool DecodeRawSymbols(uint32_t num_values, int num_interleaved_states,
+                      DecoderBuffer *src_buffer, uint32_t *out_values) {
   uint8_t max_bit_length;
   if (!src_buffer->Decode(&max_bit_length)) {
     return false;
   }
   switch (max_bit_length) {
     case 1:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<1>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<1>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 2:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<2>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<2>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 3:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<3>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<3>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 4:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<4>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<4>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 5:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<5>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<5>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 6:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<6>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<6>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 7:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<7>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<7>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 8:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<8>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<8>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 9:
-      return DecodeRawSymbolsInternal<SymbolDecoderT<9>>(num_values, src_buffer,
-                                                         out_values);
+      return DecodeRawSymbolsInternal<SymbolDecoderT<9>>(
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 10:
       return DecodeRawSymbolsInternal<SymbolDecoderT<10>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 11:
       return DecodeRawSymbolsInternal<SymbolDecoderT<11>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 12:
       return DecodeRawSymbolsInternal<SymbolDecoderT<12>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 13:
       return DecodeRawSymbolsInternal<SymbolDecoderT<13>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 14:
       return DecodeRawSymbolsInternal<SymbolDecoderT<14>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 15:
       return DecodeRawSymbolsInternal<SymbolDecoderT<15>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 16:
       return DecodeRawSymbolsInternal<SymbolDecoderT<16>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 17:
       return DecodeRawSymbolsInternal<SymbolDecoderT<17>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     case 18:
       return DecodeRawSymbolsInternal<SymbolDecoderT<18>>(
-          num_values, src_buffer, out_values);
+          num_values, num_interleaved_states, src_buffer, out_values);
     default:
       return false;
   }
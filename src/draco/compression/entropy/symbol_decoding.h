@@ -24,6 +24,14 @@ namespace draco {
 bool DecodeSymbols(uint32_t num_values, int num_components,
                    DecoderBuffer *src_buffer, uint32_t *out_values);
 
+// Same as above but symbols encoded with the SYMBOL_CODING_RAW_INTERLEAVED
+// method are accepted only when |allow_interleaved| is true. Callers should set
+// it only for bitstreams that support the method (see
+// PointCloudDecoder::IsInterleavedSymbolCodingSupported()).
+bool DecodeSymbols(uint32_t num_values, int num_components,
+                   bool allow_interleaved, DecoderBuffer *src_buffer,
+                   uint32_t *out_values);
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ENTROPY_SYMBOL_DECODING_H_
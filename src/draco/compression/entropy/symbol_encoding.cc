@@ -27,6 +27,13 @@ namespace draco {
 constexpr int32_t kMaxTagSymbolBitLength = 32;
 constexpr int kMaxRawEncodingBitLength = 18;
 constexpr int kDefaultSymbolCodingCompressionLevel = 7;
+// Number of rANS states used by the SYMBOL_CODING_RAW_INTERLEAVED scheme.
+constexpr int kNumInterleavedRAnsStates = 8;
+// Minimum number of symbols for which the SYMBOL_CODING_RAW_INTERLEAVED scheme
+// is used instead of SYMBOL_CODING_RAW when the interleaving is enabled. Each
+// extra rANS state costs up to four bytes so the interleaving is not worth it
+// for small inputs.
+constexpr int kMinNumInterleavedRawSymbols = 4096;
 
 typedef uint64_t TaggedBitLengthFrequencies[kMaxTagSymbolBitLength];
 
@@ -43,6 +50,10 @@ bool SetSymbolEncodingCompressionLevel(Options *options,
   return true;
 }
 
+void SetSymbolEncodingInterleaving(Options *options, bool enabled) {
+  options->SetBool("symbol_encoding_interleaving", enabled);
+}
+
 // Computes bit lengths of the input values. If num_components > 1, the values
 // are processed in "num_components" sized chunks and the bit length is always
 // computed for the largest value from the chunk.
@@ -111,7 +122,8 @@ bool EncodeTaggedSymbols(const uint32_t *symbols, int num_values,
 template <template <int> class SymbolEncoderT>
 bool EncodeRawSymbols(const uint32_t *symbols, int num_values,
                       uint32_t max_entry_value, int32_t num_unique_symbols,
-                      const Options *options, EncoderBuffer *target_buffer);
+                      int num_interleaved_states, const Options *options,
+                      EncoderBuffer *target_buffer);
 
 bool EncodeSymbols(const uint32_t *symbols, int num_values, int num_components,
                    const Options *options, EncoderBuffer *target_buffer) {
@@ -152,6 +164,10 @@ bool EncodeSymbols(const uint32_t *symbols, int num_values, int num_components,
     if (tagged_scheme_total_bits < raw_scheme_total_bits ||
         max_value_bit_length > kMaxRawEncodingBitLength) {
       method = SYMBOL_CODING_TAGGED;
+    } else if (num_values >= kMinNumInterleavedRawSymbols &&
+               options != nullptr &&
+               options->GetBool("symbol_encoding_interleaving", false)) {
+      method = SYMBOL_CODING_RAW_INTERLEAVED;
     } else {
       method = SYMBOL_CODING_RAW;
     }
@@ -164,9 +180,15 @@ bool EncodeSymbols(const uint32_t *symbols, int num_values, int num_components,
   }
   if (method == SYMBOL_CODING_RAW) {
     return EncodeRawSymbols<RAnsSymbolEncoder>(symbols, num_values, max_value,
-                                               num_unique_symbols, options,
+                                               num_unique_symbols, 1, options,
                                                target_buffer);
   }
+  if (method == SYMBOL_CODING_RAW_INTERLEAVED) {
+    target_buffer->Encode(static_cast<uint8_t>(kNumInterleavedRAnsStates));
+    return EncodeRawSymbols<RAnsSymbolEncoder>(
+        symbols, num_values, max_value, num_unique_symbols,
+        kNumInterleavedRAnsStates, options, target_buffer);
+  }
   // Unknown method selected.
   return false;
 }
@@ -245,6 +267,7 @@ bool EncodeTaggedSymbols(const uint32_t *symbols, int num_values,
 template <class SymbolEncoderT>
 bool EncodeRawSymbolsInternal(const uint32_t *symbols, int num_values,
                               uint32_t max_entry_value,
+                              int num_interleaved_states,
                               EncoderBuffer *target_buffer) {
   // Count the frequency of each entry value.
   std::vector<uint64_t> frequencies(max_entry_value + 1, 0);
@@ -255,6 +278,19 @@ bool EncodeRawSymbolsInternal(const uint32_t *symbols, int num_values,
   SymbolEncoderT encoder;
   encoder.Create(frequencies.data(), static_cast<int>(frequencies.size()),
                  target_buffer);
+  if (num_interleaved_states == 4) {
+    encoder.template EncodeInterleavedSymbols<4>(symbols, num_values,
+                                                 target_buffer);
+    return true;
+  }
+  if (num_interleaved_states == 8) {
+    encoder.template EncodeInterleavedSymbols<8>(symbols, num_values,
+                                                 target_buffer);
+    return true;
+  }
+  if (num_interleaved_states != 1) {
+    return false;
+  }
   encoder.StartEncoding(target_buffer);
   // Encode all values.
   if (SymbolEncoderT::needs_reverse_encoding()) {
@@ -273,7 +309,8 @@ bool EncodeRawSymbolsInternal(const uint32_t *symbols, int num_values,
 template <template <int> class SymbolEncoderT>
 bool EncodeRawSymbols(const uint32_t *symbols, int num_values,
                       uint32_t max_entry_value, int32_t num_unique_symbols,
-                      const Options *options, EncoderBuffer *target_buffer) {
+                      int num_interleaved_states, const Options *options,
+                      EncoderBuffer *target_buffer) {
   int symbol_bits = 0;
   if (num_unique_symbols > 0) {
     symbol_bits = MostSignificantBit(num_unique_symbols);
@@ -316,58 +353,76 @@ bool EncodeRawSymbols(const uint32_t *symbols, int num_values,
       FALLTHROUGH_INTENDED;
     case 1:
       return EncodeRawSymbolsInternal<SymbolEncoderT<1>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 2:
       return EncodeRawSymbolsInternal<SymbolEncoderT<2>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 3:
       return EncodeRawSymbolsInternal<SymbolEncoderT<3>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 4:
       return EncodeRawSymbolsInternal<SymbolEncoderT<4>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 5:
       return EncodeRawSymbolsInternal<SymbolEncoderT<5>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 6:
       return EncodeRawSymbolsInternal<SymbolEncoderT<6>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 7:
       return EncodeRawSymbolsInternal<SymbolEncoderT<7>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 8:
       return EncodeRawSymbolsInternal<SymbolEncoderT<8>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 9:
       return EncodeRawSymbolsInternal<SymbolEncoderT<9>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 10:
       return EncodeRawSymbolsInternal<SymbolEncoderT<10>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 11:
       return EncodeRawSymbolsInternal<SymbolEncoderT<11>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 12:
       return EncodeRawSymbolsInternal<SymbolEncoderT<12>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 13:
       return EncodeRawSymbolsInternal<SymbolEncoderT<13>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 14:
       return EncodeRawSymbolsInternal<SymbolEncoderT<14>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 15:
       return EncodeRawSymbolsInternal<SymbolEncoderT<15>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 16:
       return EncodeRawSymbolsInternal<SymbolEncoderT<16>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 17:
       return EncodeRawSymbolsInternal<SymbolEncoderT<17>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     case 18:
       return EncodeRawSymbolsInternal<SymbolEncoderT<18>>(
-          symbols, num_values, max_entry_value, target_buffer);
+          symbols, num_values, max_entry_value, num_interleaved_states,
+          target_buffer);
     default:
       return false;
   }
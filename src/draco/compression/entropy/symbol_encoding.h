@@ -24,11 +24,13 @@ namespace draco {
 // Encodes an array of symbols using an entropy coding. This function
 // automatically decides whether to encode the symbol values using bit
 // length tags (see EncodeTaggedSymbols), or whether to encode them directly
-// (see EncodeRawSymbols). The symbols can be grouped into separate components
-// that can be used for better compression. |options| is an optional parameter
-// that allows more direct control over various stages of the symbol encoding
-// (see below for functions that are used to set valid options).
-// Returns false on error.
+// (see EncodeRawSymbols). When enabled by SetSymbolEncodingInterleaving(),
+// large inputs that are encoded directly use multiple interleaved rANS states
+// to speed up the decoding (see SYMBOL_CODING_RAW_INTERLEAVED). The symbols can
+// be grouped into separate components that can be used for better compression.
+// |options| is an optional parameter that allows more direct control over
+// various stages of the symbol encoding (see below for functions that are used
+// to set valid options). Returns false on error.
 bool EncodeSymbols(const uint32_t *symbols, int num_values, int num_components,
                    const Options *options, EncoderBuffer *target_buffer);
 
@@ -42,6 +44,11 @@ void SetSymbolEncodingMethod(Options *options, SymbolCodingMethod method);
 // Returns false if an invalid level has been set.
 bool SetSymbolEncodingCompressionLevel(Options *options, int compression_level);
 
+// Sets whether the symbol encoder may use the SYMBOL_CODING_RAW_INTERLEAVED
+// method. The method is supported only by decoders of mesh bitstream version
+// 2.3 and point cloud bitstream version 2.4 or newer. Disabled by default.
+void SetSymbolEncodingInterleaving(Options *options, bool enabled);
+
 }  // namespace draco
 
 #endif  // DRACO_COMPRESSION_ENTROPY_SYMBOL_ENCODING_H_
@@ -0,0 +1,67 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark/benchmark.h"
+#include "draco/compression/mesh/mesh_edgebreaker_decoder.h"
+#include "draco/core/draco_benchmark_utils.h"
+
+namespace draco {
+namespace {
+
+// Edgebreaker decoder that stops right after the connectivity has been
+// decoded (MeshEdgebreakerDecoderImpl::DecodeConnectivity()) so that the
+// benchmark is not affected by the cost of attribute decoding.
+class ConnectivityOnlyEdgebreakerDecoder : public MeshEdgebreakerDecoder {
+ protected:
+  bool DecodePointAttributes() override { return true; }
+};
+
+void BM_EdgebreakerDecodeConnectivity(benchmark::State &state) {
+  const Mesh *const mesh = GetBenchmarkMesh(state.range(kBenchmarkMeshArg));
+  if (mesh == nullptr) {
+    state.SkipWithError("Failed to load the input mesh.");
+    return;
+  }
+  // Quantization does not affect the connectivity so we use the default
+  // position quantization of the draco_encoder tool.
+  EncoderBuffer encoded;
+  if (!EncodeBenchmarkMesh(*mesh, state.range(kBenchmarkSpeedArg), 11,
+                           &encoded)
+           .ok()) {
+    state.SkipWithError("Failed to encode the input mesh.");
+    return;
+  }
+  const DecoderOptions options;
+  int64_t connectivity_size = 0;
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    Mesh out_mesh;
+    ConnectivityOnlyEdgebreakerDecoder decoder;
+    const Status status = decoder.Decode(options, &buffer, &out_mesh);
+    if (!status.ok()) {
+      state.SkipWithError(status.error_msg());
+      return;
+    }
+    // The decoder re-initializes |buffer| at the end of the traversal data so
+    // the size of the connectivity is derived from the remaining data.
+    connectivity_size = encoded.size() - buffer.remaining_size();
+    benchmark::DoNotOptimize(out_mesh.num_faces());
+  }
+  SetMeshThroughputCounters(*mesh, connectivity_size, state);
+}
+BENCHMARK(BM_EdgebreakerDecodeConnectivity)->Apply(ApplyMeshSpeedArgs);
+
+}  // namespace
+}  // namespace draco
@@ -46,6 +46,7 @@ namespace draco {
 template <class TraversalDecoder>
 MeshEdgebreakerDecoderImpl<TraversalDecoder>::MeshEdgebreakerDecoderImpl()
     : decoder_(nullptr),
+      resource_pool_(nullptr),
       last_symbol_id_(-1),
       last_vert_id_(-1),
       last_face_id_(-1),
@@ -57,9 +58,49 @@ template <class TraversalDecoder>
 bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::Init(
     MeshEdgebreakerDecoder *decoder) {
   decoder_ = decoder;
+  resource_pool_ = decoder->resource_pool();
+  if (resource_pool_ != nullptr) {
+    AcquirePooledResources();
+  }
   return true;
 }
 
+template <class TraversalDecoder>
+MeshEdgebreakerDecoderImpl<TraversalDecoder>::~MeshEdgebreakerDecoderImpl() {
+  if (resource_pool_ != nullptr) {
+    ReleasePooledResources();
+  }
+}
+
+template <class TraversalDecoder>
+void MeshEdgebreakerDecoderImpl<TraversalDecoder>::AcquirePooledResources() {
+  resource_pool_->Acquire(&vertex_traversal_length_);
+  resource_pool_->Acquire(&topology_split_data_);
+  resource_pool_->Acquire(&hole_event_data_);
+  resource_pool_->Acquire(&init_face_configurations_);
+  resource_pool_->Acquire(&init_corners_);
+  resource_pool_->Acquire(&is_vert_hole_);
+  resource_pool_->Acquire(&new_to_parent_vertex_map_);
+  resource_pool_->Acquire(&processed_corner_ids_);
+  resource_pool_->Acquire(&processed_connectivity_corners_);
+  resource_pool_->Acquire(&attribute_data_);
+}
+
+template <class TraversalDecoder>
+void MeshEdgebreakerDecoderImpl<TraversalDecoder>::ReleasePooledResources() {
+  resource_pool_->Release(&vertex_traversal_length_);
+  resource_pool_->Release(&topology_split_data_);
+  resource_pool_->Release(&hole_event_data_);
+  resource_pool_->Release(&init_face_configurations_);
+  resource_pool_->Release(&init_corners_);
+  resource_pool_->Release(&is_vert_hole_);
+  resource_pool_->Release(&new_to_parent_vertex_map_);
+  resource_pool_->Release(&processed_corner_ids_);
+  resource_pool_->Release(&processed_connectivity_corners_);
+  resource_pool_->Release(&attribute_data_);
+  resource_pool_->ReleaseObject(std::move(corner_table_));
+}
+
 template <class TraversalDecoder>
 const MeshAttributeCornerTable *
 MeshEdgebreakerDecoderImpl<TraversalDecoder>::GetAttributeCornerTable(
@@ -372,7 +413,14 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity() {
 
   // Decode topology (connectivity).
   vertex_traversal_length_.clear();
-  corner_table_ = std::unique_ptr<CornerTable>(new CornerTable());
+  if (resource_pool_ != nullptr) {
+    // Reuse the memory of a corner table from a previous decoding call. The
+    // table is reinitialized by CornerTable::Reset() below.
+    resource_pool_->ReleaseObject(std::move(corner_table_));
+    corner_table_ = resource_pool_->AcquireObject<CornerTable>();
+  } else {
+    corner_table_ = std::unique_ptr<CornerTable>(new CornerTable());
+  }
   if (corner_table_ == nullptr) {
     return false;
   }
@@ -545,16 +593,23 @@ int MeshEdgebreakerDecoderImpl<TraversalDecoder>::DecodeConnectivity(
   // removes the top edge from the stack and TOPOLOGY_E adds a new edge to the
   // stack.
   std::vector<CornerIndex> active_corner_stack;
+  const ScopedPooledContainer<std::vector<CornerIndex>> pooled_corner_stack(
+      resource_pool_, &active_corner_stack);
 
   // Additional active edges may be added as a result of topology split events.
   // They can be added in arbitrary order, but we always know the split symbol
   // id they belong to, so we can address them using this symbol id.
   std::unordered_map<int, CornerIndex> topology_split_active_corners;
+  const ScopedPooledContainer<std::unordered_map<int, CornerIndex>>
+      pooled_split_active_corners(resource_pool_,
+                                  &topology_split_active_corners);
 
   // Vector used for storing vertices that were marked as isolated during the
   // decoding process. Currently used only when the mesh doesn't contain any
   // non-position connectivity data.
   std::vector<VertexIndex> invalid_vertices;
+  const ScopedPooledContainer<std::vector<VertexIndex>> pooled_invalid_vertices(
+      resource_pool_, &invalid_vertices);
   const bool remove_invalid_vertices = attribute_data_.empty();
 
   int max_num_vertices = static_cast<int>(is_vert_hole_.size());
@@ -1191,8 +1246,13 @@ bool MeshEdgebreakerDecoderImpl<TraversalDecoder>::AssignPointsToCorners(
   // each point is stored. The corners are used to sample the attribute values
   // in the last stage of the deduplication.
   std::vector<int32_t> point_to_corner_map;
+  const ScopedPooledContainer<std::vector<int32_t>> pooled_point_to_corner_map(
+      resource_pool_, &point_to_corner_map);
   // Map between every corner and their new point ids.
-  std::vector<int32_t> corner_to_point_map(corner_table_->num_corners());
+  std::vector<int32_t> corner_to_point_map;
+  const ScopedPooledContainer<std::vector<int32_t>> pooled_corner_to_point_map(
+      resource_pool_, &corner_to_point_map);
+  corner_to_point_map.resize(corner_table_->num_corners());
   for (int v = 0; v < corner_table_->num_vertices(); ++v) {
     CornerIndex c = corner_table_->LeftMostCorner(VertexIndex(v));
     if (c == kInvalidCornerIndex) {
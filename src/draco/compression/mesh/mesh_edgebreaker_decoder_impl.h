@@ -19,6 +19,7 @@
 #include <unordered_set>
 
 #include "draco/compression/attributes/mesh_attribute_indices_encoding_data.h"
+#include "draco/compression/decoder_resource_pool.h"
 #include "draco/compression/mesh/mesh_edgebreaker_decoder_impl_interface.h"
 #include "draco/compression/mesh/mesh_edgebreaker_shared.h"
 #include "draco/compression/mesh/traverser/mesh_traversal_sequencer.h"
@@ -52,6 +53,7 @@ template <class TraversalDecoderT>
 class MeshEdgebreakerDecoderImpl : public MeshEdgebreakerDecoderImplInterface {
  public:
   MeshEdgebreakerDecoderImpl();
+  ~MeshEdgebreakerDecoderImpl() override;
   bool Init(MeshEdgebreakerDecoder *decoder) override;
 
   const MeshAttributeCornerTable *GetAttributeCornerTable(
@@ -135,8 +137,17 @@ class MeshEdgebreakerDecoderImpl : public MeshEdgebreakerDecoderImplInterface {
     corner_table_->SetOppositeCorner(corner_1, corner_0);
   }
 
+  // Acquires the temporary containers used by the decoder from
+  // |resource_pool_| or releases them back to the pool.
+  void AcquirePooledResources();
+  void ReleasePooledResources();
+
   MeshEdgebreakerDecoder *decoder_;
 
+  // Optional pool of resources that are reused across decoding calls. Not
+  // owned by the decoder.
+  DecoderResourcePool *resource_pool_;
+
   std::unique_ptr<CornerTable> corner_table_;
 
   // Stack used for storing corners that need to be traversed when decoding
@@ -45,6 +45,12 @@ class MeshEdgebreakerTraversalDecoder {
     return decoder_impl_->GetDecoder()->bitstream_version();
   }
 
+  // Returns true if the traversal may contain symbols encoded with the
+  // SYMBOL_CODING_RAW_INTERLEAVED method.
+  bool IsInterleavedSymbolCodingSupported() const {
+    return decoder_impl_->GetDecoder()->IsInterleavedSymbolCodingSupported();
+  }
+
   // Used to tell the decoder what is the number of expected decoded vertices.
   // Ignored by default.
   void SetNumEncodedVertices(int /* num_vertices */) {}
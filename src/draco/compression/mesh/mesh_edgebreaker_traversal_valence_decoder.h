@@ -114,7 +114,8 @@ class MeshEdgebreakerTraversalValenceDecoder
       }
       if (num_symbols > 0) {
         context_symbols_[i].resize(num_symbols);
-        DecodeSymbols(num_symbols, 1, out_buffer, context_symbols_[i].data());
+        DecodeSymbols(num_symbols, 1, IsInterleavedSymbolCodingSupported(),
+                      out_buffer, context_symbols_[i].data());
         // All symbols are going to be processed from the back.
         context_counters_[i] = num_symbols;
       }
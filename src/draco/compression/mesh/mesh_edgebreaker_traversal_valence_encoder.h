@@ -190,13 +190,18 @@ class MeshEdgebreakerTraversalValenceEncoder
     MeshEdgebreakerTraversalEncoder::EncodeAttributeSeams();
 
     // Store the contexts.
+    Options symbol_encoding_options;
+    SetSymbolEncodingInterleaving(
+        &symbol_encoding_options,
+        encoder_impl()->GetEncoder()->options()->GetGlobalBool(
+            "interleaved_symbol_coding", false));
     for (int i = 0; i < context_symbols_.size(); ++i) {
       EncodeVarint<uint32_t>(static_cast<uint32_t>(context_symbols_[i].size()),
                              GetOutputBuffer());
       if (context_symbols_[i].size() > 0) {
         EncodeSymbols(context_symbols_[i].data(),
-                      static_cast<int>(context_symbols_[i].size()), 1, nullptr,
-                      GetOutputBuffer());
+                      static_cast<int>(context_symbols_[i].size()), 1,
+                      &symbol_encoding_options, GetOutputBuffer());
       }
     }
   }
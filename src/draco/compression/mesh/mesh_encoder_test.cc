@@ -24,9 +24,15 @@ namespace draco {
 
 struct MeshEncoderTestParams {
   MeshEncoderTestParams(const std::string &encoding_method, int cl)
-      : encoding_method(encoding_method), cl(cl) {}
+      : MeshEncoderTestParams(encoding_method, cl, false) {}
+  MeshEncoderTestParams(const std::string &encoding_method, int cl,
+                        bool interleaved_symbol_coding)
+      : encoding_method(encoding_method),
+        cl(cl),
+        interleaved_symbol_coding(interleaved_symbol_coding) {}
   std::string encoding_method;
   int cl;
+  bool interleaved_symbol_coding;
 };
 
 class MeshEncoderTest : public ::testing::TestWithParam<MeshEncoderTestParams> {
@@ -57,6 +63,9 @@ class MeshEncoderTest : public ::testing::TestWithParam<MeshEncoderTestParams> {
     ASSERT_TRUE(GetMethod(&method))
         << "Test is run for an unknown encoding method";
 
+    // Interleaved symbol coding requires mesh bitstream version 2.3. Otherwise
+    // the encoder writes version 2.2.
+    const int version_minor = GetParam().interleaved_symbol_coding ? 3 : 2;
     std::string golden_file_name = file_name;
     golden_file_name += '.';
     golden_file_name += GetParam().encoding_method;
@@ -65,13 +74,14 @@ class MeshEncoderTest : public ::testing::TestWithParam<MeshEncoderTestParams> {
     golden_file_name += ".";
     golden_file_name += std::to_string(kDracoMeshBitstreamVersionMajor);
     golden_file_name += ".";
-    golden_file_name += std::to_string(kDracoMeshBitstreamVersionMinor);
+    golden_file_name += std::to_string(version_minor);
     golden_file_name += ".drc";
     const std::unique_ptr<Mesh> mesh(ReadMeshFromTestFile(file_name));
     ASSERT_NE(mesh, nullptr) << "Failed to load test model " << file_name;
 
     ExpertEncoder encoder(*mesh);
     encoder.SetEncodingMethod(method);
+    encoder.SetInterleavedSymbolCoding(GetParam().interleaved_symbol_coding);
     encoder.SetSpeedOptions(10 - GetParam().cl, 10 - GetParam().cl);
     encoder.SetAttributeQuantization(0, 20);
     for (int i = 1; i < mesh->num_attributes(); ++i) {
@@ -85,7 +95,13 @@ class MeshEncoderTest : public ::testing::TestWithParam<MeshEncoderTestParams> {
     // Check that the encoded mesh was really encoded with the selected method.
     DecoderBuffer decoder_buffer;
     decoder_buffer.Init(buffer.data(), buffer.size());
-    decoder_buffer.Advance(8);  // Skip the header to the encoding method id.
+    decoder_buffer.Advance(5);  // Skip the "DRACO" string.
+    uint8_t encoded_version_major, encoded_version_minor;
+    ASSERT_TRUE(decoder_buffer.Decode(&encoded_version_major));
+    ASSERT_TRUE(decoder_buffer.Decode(&encoded_version_minor));
+    ASSERT_EQ(encoded_version_major, kDracoMeshBitstreamVersionMajor);
+    ASSERT_EQ(encoded_version_minor, version_minor);
+    decoder_buffer.Advance(1);  // Skip the encoder type.
     uint8_t encoded_method;
     ASSERT_TRUE(decoder_buffer.Decode(&encoded_method));
     ASSERT_EQ(encoded_method, method);
@@ -113,6 +129,9 @@ INSTANTIATE_TEST_SUITE_P(
     MeshEncoderTests, MeshEncoderTest,
     ::testing::Values(MeshEncoderTestParams("sequential", 3),
                       MeshEncoderTestParams("edgebreaker", 4),
-                      MeshEncoderTestParams("edgebreaker", 10)));
+                      MeshEncoderTestParams("edgebreaker", 10),
+                      MeshEncoderTestParams("sequential", 3, true),
+                      MeshEncoderTestParams("edgebreaker", 4, true),
+                      MeshEncoderTestParams("edgebreaker", 10, true)));
 
 }  // namespace draco
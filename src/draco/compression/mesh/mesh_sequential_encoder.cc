@@ -112,8 +112,12 @@ bool MeshSequentialEncoder::CompressAndEncodeIndices() {
       last_index_value = index_value;
     }
   }
+  Options symbol_encoding_options;
+  SetSymbolEncodingInterleaving(
+      &symbol_encoding_options,
+      options()->GetGlobalBool("interleaved_symbol_coding", false));
   EncodeSymbols(indices_buffer.data(), static_cast<int>(indices_buffer.size()),
-                1, nullptr, buffer());
+                1, &symbol_encoding_options, buffer());
   return true;
 }
 
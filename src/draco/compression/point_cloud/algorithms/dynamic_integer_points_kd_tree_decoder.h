@@ -86,6 +86,7 @@ class DynamicIntegerPointsKdTreeDecoder {
       : bit_length_(0),
         num_points_(0),
         num_decoded_points_(0),
+        max_decoded_points_(std::numeric_limits<uint32_t>::max()),
         dimension_(dimension),
         p_(dimension, 0),
         axes_(dimension, 0),
@@ -112,8 +113,46 @@ class DynamicIntegerPointsKdTreeDecoder {
                     uint32_t oit_max_points);
 #endif  // DRACO_OLD_GCC
 
+  // Decodes the top levels of a point cloud encoded by
+  // DynamicIntegerPointsKdTreeEncoder::EncodePointsWithIndex(). Points stored
+  // in the top |index_depth| levels are written to |oit| and roots of all
+  // subtrees at depth |index_depth| are stored in |out_subtrees|.
+  template <class OutputIteratorT>
+  bool DecodeIndexedPoints(DecoderBuffer *buffer, uint32_t index_depth,
+                           OutputIteratorT &oit, uint32_t oit_max_points,
+                           std::vector<KdTreeSubtreeRoot> *out_subtrees);
+
+  // Decodes points of a subtree given by |root| from |buffer| that contains
+  // the subtree data encoded by EncodePointsWithIndex(). |bit_length| must be
+  // the value returned by bit_length() after DecodeIndexedPoints(). Decoding
+  // stops after |max_points| points were written to |oit|.
+  template <class OutputIteratorT>
+  bool DecodeSubtree(DecoderBuffer *buffer, uint32_t bit_length,
+                     const KdTreeSubtreeRoot &root, OutputIteratorT &oit,
+                     uint32_t max_points);
+
+  // Decodes the header of a point cloud encoded by
+  // DynamicIntegerPointsKdTreeEncoder::EncodePointsByLevels(). The root node
+  // of the tree is stored in |out_nodes| unless the point cloud is empty.
+  bool DecodeLevelsHeader(DecoderBuffer *buffer, uint32_t oit_max_points,
+                          std::vector<KdTreeSubtreeRoot> *out_nodes);
+
+  // Decodes one level of the tree from |buffer| that contains the level data
+  // encoded by EncodePointsByLevels(). |nodes| must contain all nodes of the
+  // level, i.e. the nodes returned by DecodeLevelsHeader() or by the previous
+  // call of this method. Points of the leaf nodes are written to |oit| and
+  // |nodes| is replaced by the nodes of the next level. |bit_length| must be
+  // the value returned by bit_length() after DecodeLevelsHeader().
+  template <class OutputIteratorT>
+  bool DecodeLevel(DecoderBuffer *buffer, uint32_t bit_length,
+                   std::vector<KdTreeSubtreeRoot> *nodes,
+                   OutputIteratorT &oit);
+
   const uint32_t dimension() const { return dimension_; }
 
+  // Returns the highest bit used for all coordinates of the decoded points.
+  uint32_t bit_length() const { return bit_length_; }
+
   // Returns the number of decoded points. Must be called after DecodePoints().
   uint32_t num_decoded_points() const { return num_decoded_points_; }
 
@@ -121,8 +160,27 @@ class DynamicIntegerPointsKdTreeDecoder {
   uint32_t GetAxis(uint32_t num_remaining_points, const VectorUint32 &levels,
                    uint32_t last_axis);
 
+  // Decodes the subtree given by |root|. When |out_subtrees| is not null,
+  // nodes at |max_depth| are not decoded but they are stored in
+  // |out_subtrees|.
   template <class OutputIteratorT>
-  bool DecodeInternal(uint32_t num_points, OutputIteratorT &oit);
+  bool DecodeInternal(const KdTreeSubtreeRoot &root, uint32_t max_depth,
+                      std::vector<KdTreeSubtreeRoot> *out_subtrees,
+                      OutputIteratorT &oit);
+
+  bool StartBitDecoders(DecoderBuffer *buffer) {
+    return numbers_decoder_.StartDecoding(buffer) &&
+           remaining_bits_decoder_.StartDecoding(buffer) &&
+           axis_decoder_.StartDecoding(buffer) &&
+           half_decoder_.StartDecoding(buffer);
+  }
+
+  void EndBitDecoders() {
+    numbers_decoder_.EndDecoding();
+    remaining_bits_decoder_.EndDecoding();
+    axis_decoder_.EndDecoding();
+    half_decoder_.EndDecoding();
+  }
 
   void DecodeNumber(int nbits, uint32_t *value) {
     numbers_decoder_.DecodeLeastSignificantBits32(nbits, value);
@@ -130,19 +188,22 @@ class DynamicIntegerPointsKdTreeDecoder {
 
   struct DecodingStatus {
     DecodingStatus(uint32_t num_remaining_points_, uint32_t last_axis_,
-                   uint32_t stack_pos_)
+                   uint32_t stack_pos_, uint32_t depth_)
         : num_remaining_points(num_remaining_points_),
           last_axis(last_axis_),
-          stack_pos(stack_pos_) {}
+          stack_pos(stack_pos_),
+          depth(depth_) {}
 
     uint32_t num_remaining_points;
     uint32_t last_axis;
     uint32_t stack_pos;  // used to get base and levels
+    uint32_t depth;
   };
 
   uint32_t bit_length_;
   uint32_t num_points_;
   uint32_t num_decoded_points_;
+  uint32_t max_decoded_points_;
   uint32_t dimension_;
   NumbersDecoder numbers_decoder_;
   RemainingBitsDecoder remaining_bits_decoder_;
@@ -199,29 +260,207 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodePoints(
     return false;
   }
   num_decoded_points_ = 0;
+  max_decoded_points_ = std::numeric_limits<uint32_t>::max();
 
-  if (!numbers_decoder_.StartDecoding(buffer)) {
+  if (!StartBitDecoders(buffer)) {
+    return false;
+  }
+  if (!DecodeInternal(KdTreeSubtreeRoot(dimension_, num_points_), 0, nullptr,
+                      oit)) {
+    return false;
+  }
+  EndBitDecoders();
+
+  return true;
+}
+
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::
+    DecodeIndexedPoints(DecoderBuffer *buffer, uint32_t index_depth,
+                        OutputIteratorT &oit, uint32_t oit_max_points,
+                        std::vector<KdTreeSubtreeRoot> *out_subtrees) {
+  out_subtrees->clear();
+  if (index_depth == 0) {
     return false;
   }
-  if (!remaining_bits_decoder_.StartDecoding(buffer)) {
+  if (!buffer->Decode(&bit_length_)) {
+    return false;
+  }
+  if (bit_length_ > 32) {
+    return false;
+  }
+  if (!buffer->Decode(&num_points_)) {
+    return false;
+  }
+  if (num_points_ == 0) {
+    return true;
+  }
+  if (num_points_ > oit_max_points) {
+    return false;
+  }
+  num_decoded_points_ = 0;
+  max_decoded_points_ = std::numeric_limits<uint32_t>::max();
+
+  if (!StartBitDecoders(buffer)) {
     return false;
   }
-  if (!axis_decoder_.StartDecoding(buffer)) {
+  if (!DecodeInternal(KdTreeSubtreeRoot(dimension_, num_points_), index_depth,
+                      out_subtrees, oit)) {
     return false;
   }
-  if (!half_decoder_.StartDecoding(buffer)) {
+  EndBitDecoders();
+
+  return true;
+}
+
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeSubtree(
+    DecoderBuffer *buffer, uint32_t bit_length, const KdTreeSubtreeRoot &root,
+    OutputIteratorT &oit, uint32_t max_points) {
+  if (bit_length > 32 || root.base.size() != dimension_ ||
+      root.levels.size() != dimension_) {
     return false;
   }
+  bit_length_ = bit_length;
+  num_points_ = root.num_points;
+  num_decoded_points_ = 0;
+  max_decoded_points_ = max_points;
 
-  if (!DecodeInternal(num_points_, oit)) {
+  if (!StartBitDecoders(buffer)) {
     return false;
   }
+  if (!DecodeInternal(root, 0, nullptr, oit)) {
+    return false;
+  }
+  EndBitDecoders();
 
-  numbers_decoder_.EndDecoding();
-  remaining_bits_decoder_.EndDecoding();
-  axis_decoder_.EndDecoding();
-  half_decoder_.EndDecoding();
+  return true;
+}
 
+template <int compression_level_t>
+bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::
+    DecodeLevelsHeader(DecoderBuffer *buffer, uint32_t oit_max_points,
+                       std::vector<KdTreeSubtreeRoot> *out_nodes) {
+  out_nodes->clear();
+  if (!buffer->Decode(&bit_length_)) {
+    return false;
+  }
+  if (bit_length_ > 32) {
+    return false;
+  }
+  if (!buffer->Decode(&num_points_)) {
+    return false;
+  }
+  if (num_points_ > oit_max_points) {
+    return false;
+  }
+  if (num_points_ > 0) {
+    out_nodes->push_back(KdTreeSubtreeRoot(dimension_, num_points_));
+  }
+  return true;
+}
+
+template <int compression_level_t>
+template <class OutputIteratorT>
+bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeLevel(
+    DecoderBuffer *buffer, uint32_t bit_length,
+    std::vector<KdTreeSubtreeRoot> *nodes, OutputIteratorT &oit) {
+  if (bit_length > 32) {
+    return false;
+  }
+  bit_length_ = bit_length;
+  if (!StartBitDecoders(buffer)) {
+    return false;
+  }
+  std::vector<KdTreeSubtreeRoot> next_nodes;
+  for (const KdTreeSubtreeRoot &node : *nodes) {
+    if (node.base.size() != dimension_ || node.levels.size() != dimension_) {
+      return false;
+    }
+    const uint32_t num_remaining_points = node.num_points;
+    const uint32_t axis =
+        GetAxis(num_remaining_points, node.levels, node.last_axis);
+    if (axis >= dimension_) {
+      return false;
+    }
+    const uint32_t level = node.levels[axis];
+
+    // All axes have been fully subdivided, just output points.
+    if ((bit_length_ - level) == 0) {
+      for (uint32_t i = 0; i < num_remaining_points; i++) {
+        *oit = node.base;
+        ++oit;
+      }
+      continue;
+    }
+
+    // Points of small nodes are decoded directly, the same way as in
+    // DecodeInternal().
+    if (num_remaining_points <= 2) {
+      axes_[0] = axis;
+      for (uint32_t i = 1; i < dimension_; i++) {
+        axes_[i] = DRACO_INCREMENT_MOD(axes_[i - 1], dimension_);
+      }
+      for (uint32_t i = 0; i < num_remaining_points; ++i) {
+        for (uint32_t j = 0; j < dimension_; j++) {
+          p_[axes_[j]] = 0;
+          const uint32_t num_remaining_bits =
+              bit_length_ - node.levels[axes_[j]];
+          if (num_remaining_bits) {
+            if (!remaining_bits_decoder_.DecodeLeastSignificantBits32(
+                    num_remaining_bits, &p_[axes_[j]])) {
+              return false;
+            }
+          }
+          p_[axes_[j]] = node.base[axes_[j]] | p_[axes_[j]];
+        }
+        *oit = p_;
+        ++oit;
+      }
+      continue;
+    }
+
+    const int num_remaining_bits = bit_length_ - level;
+    const uint32_t modifier = 1 << (num_remaining_bits - 1);
+    const int incoming_bits = MostSignificantBit(num_remaining_points);
+
+    uint32_t number = 0;
+    DecodeNumber(incoming_bits, &number);
+
+    uint32_t first_half = num_remaining_points / 2;
+    if (first_half < number) {
+      // Invalid |number|.
+      return false;
+    }
+    first_half -= number;
+    uint32_t second_half = num_remaining_points - first_half;
+
+    if (first_half != second_half) {
+      if (!half_decoder_.DecodeNextBit()) {
+        std::swap(first_half, second_half);
+      }
+    }
+
+    KdTreeSubtreeRoot child;
+    child.levels = node.levels;
+    child.levels[axis] += 1;
+    child.last_axis = axis;
+    if (first_half) {
+      child.base = node.base;
+      child.num_points = first_half;
+      next_nodes.push_back(child);
+    }
+    if (second_half) {
+      child.base = node.base;
+      child.base[axis] += modifier;
+      child.num_points = second_half;
+      next_nodes.push_back(child);
+    }
+  }
+  EndBitDecoders();
+  nodes->swap(next_nodes);
   return true;
 }
 
@@ -250,11 +489,13 @@ uint32_t DynamicIntegerPointsKdTreeDecoder<compression_level_t>::GetAxis(
 template <int compression_level_t>
 template <class OutputIteratorT>
 bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
-    uint32_t num_points, OutputIteratorT &oit) {
+    const KdTreeSubtreeRoot &root, uint32_t max_depth,
+    std::vector<KdTreeSubtreeRoot> *out_subtrees, OutputIteratorT &oit) {
   typedef DecodingStatus Status;
-  base_stack_[0] = VectorUint32(dimension_, 0);
-  levels_stack_[0] = VectorUint32(dimension_, 0);
-  DecodingStatus init_status(num_points, 0, 0);
+  const uint32_t num_points = root.num_points;
+  base_stack_[0] = root.base;
+  levels_stack_[0] = root.levels;
+  DecodingStatus init_status(num_points, root.last_axis, 0, 0);
   std::stack<Status> status_stack;
   status_stack.push(init_status);
 
@@ -273,6 +514,17 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
       return false;
     }
 
+    if (out_subtrees != nullptr && status.depth == max_depth) {
+      // The subtree is decoded separately by the caller.
+      KdTreeSubtreeRoot subtree;
+      subtree.base = old_base;
+      subtree.levels = levels;
+      subtree.last_axis = last_axis;
+      subtree.num_points = num_remaining_points;
+      out_subtrees->push_back(subtree);
+      continue;
+    }
+
     const uint32_t axis = GetAxis(num_remaining_points, levels, last_axis);
     if (axis >= dimension_) {
       return false;
@@ -283,6 +535,9 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
     // All axes have been fully subdivided, just output points.
     if ((bit_length_ - level) == 0) {
       for (uint32_t i = 0; i < num_remaining_points; i++) {
+        if (num_decoded_points_ == max_decoded_points_) {
+          return true;
+        }
         *oit = old_base;
         ++oit;
         ++num_decoded_points_;
@@ -301,6 +556,9 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
         axes_[i] = DRACO_INCREMENT_MOD(axes_[i - 1], dimension_);
       }
       for (uint32_t i = 0; i < num_remaining_points; ++i) {
+        if (num_decoded_points_ == max_decoded_points_) {
+          return true;
+        }
         for (uint32_t j = 0; j < dimension_; j++) {
           p_[axes_[j]] = 0;
           const uint32_t num_remaining_bits = bit_length_ - levels[axes_[j]];
@@ -350,10 +608,12 @@ bool DynamicIntegerPointsKdTreeDecoder<compression_level_t>::DecodeInternal(
     levels_stack_[stack_pos][axis] += 1;
     levels_stack_[stack_pos + 1] = levels_stack_[stack_pos];  // copy
     if (first_half) {
-      status_stack.push(DecodingStatus(first_half, axis, stack_pos));
+      status_stack.push(
+          DecodingStatus(first_half, axis, stack_pos, status.depth + 1));
     }
     if (second_half) {
-      status_stack.push(DecodingStatus(second_half, axis, stack_pos + 1));
+      status_stack.push(
+          DecodingStatus(second_half, axis, stack_pos + 1, status.depth + 1));
     }
   }
   return true;
@@ -19,6 +19,7 @@
 #include <array>
 #include <memory>
 #include <stack>
+#include <utility>
 #include <vector>
 
 #include "draco/compression/bit_coders/adaptive_rans_bit_encoder.h"
@@ -121,6 +122,31 @@ class DynamicIntegerPointsKdTreeEncoder {
     return EncodePoints(begin, end, 32, buffer);
   }
 
+  // Encodes an integer point cloud given by [begin,end) into buffer such that
+  // subtrees of the kd-tree can be decoded independently of each other.
+  // Only the top |index_depth| levels of the tree are encoded into |buffer|.
+  // Each subtree rooted at depth |index_depth| is encoded into a separate
+  // entry of |out_subtree_buffers| in the order in which the subtrees are
+  // reached by the depth-first traversal of the tree. |index_depth| must be
+  // greater than 0.
+  template <class RandomAccessIteratorT>
+  bool EncodePointsWithIndex(RandomAccessIteratorT begin,
+                             RandomAccessIteratorT end,
+                             const uint32_t &bit_length, uint32_t index_depth,
+                             EncoderBuffer *buffer,
+                             std::vector<EncoderBuffer> *out_subtree_buffers);
+
+  // Encodes an integer point cloud given by [begin,end) level by level in the
+  // breadth-first order of the kd-tree. Only |bit_length| and the number of
+  // points are encoded into |buffer|. The nodes of each level of the tree are
+  // encoded into a separate entry of |out_level_buffers| so that the decoder
+  // can stop after any level and continue with the next one later.
+  template <class RandomAccessIteratorT>
+  bool EncodePointsByLevels(RandomAccessIteratorT begin,
+                            RandomAccessIteratorT end,
+                            const uint32_t &bit_length, EncoderBuffer *buffer,
+                            std::vector<EncoderBuffer> *out_level_buffers);
+
   const uint32_t dimension() const { return dimension_; }
 
  private:
@@ -129,8 +155,38 @@ class DynamicIntegerPointsKdTreeEncoder {
                             RandomAccessIteratorT end,
                             const VectorUint32 &old_base,
                             const VectorUint32 &levels, uint32_t last_axis);
+  // Encodes the subtree given by |root| containing points [begin,end). When
+  // |out_subtrees| is not null, nodes at |max_depth| are not encoded but they
+  // are stored in |out_subtrees| together with the iterator to the first
+  // point of the node.
   template <class RandomAccessIteratorT>
-  void EncodeInternal(RandomAccessIteratorT begin, RandomAccessIteratorT end);
+  void EncodeInternal(
+      RandomAccessIteratorT begin, RandomAccessIteratorT end,
+      const KdTreeSubtreeRoot &root, uint32_t max_depth,
+      std::vector<std::pair<RandomAccessIteratorT, KdTreeSubtreeRoot>>
+          *out_subtrees);
+
+  // Encodes a single node of the tree given by |node| whose points start at
+  // |begin|. Children of the node are appended to |out_children|.
+  template <class RandomAccessIteratorT>
+  void EncodeNode(
+      RandomAccessIteratorT begin, const KdTreeSubtreeRoot &node,
+      std::vector<std::pair<RandomAccessIteratorT, KdTreeSubtreeRoot>>
+          *out_children);
+
+  void StartBitEncoders() {
+    numbers_encoder_.StartEncoding();
+    remaining_bits_encoder_.StartEncoding();
+    axis_encoder_.StartEncoding();
+    half_encoder_.StartEncoding();
+  }
+
+  void EndBitEncoders(EncoderBuffer *buffer) {
+    numbers_encoder_.EndEncoding(buffer);
+    remaining_bits_encoder_.EndEncoding(buffer);
+    axis_encoder_.EndEncoding(buffer);
+    half_encoder_.EndEncoding(buffer);
+  }
 
   class Splitter {
    public:
@@ -152,11 +208,12 @@ class DynamicIntegerPointsKdTreeEncoder {
   template <class RandomAccessIteratorT>
   struct EncodingStatus {
     EncodingStatus(RandomAccessIteratorT begin_, RandomAccessIteratorT end_,
-                   uint32_t last_axis_, uint32_t stack_pos_)
+                   uint32_t last_axis_, uint32_t stack_pos_, uint32_t depth_)
         : begin(begin_),
           end(end_),
           last_axis(last_axis_),
-          stack_pos(stack_pos_) {
+          stack_pos(stack_pos_),
+          depth(depth_) {
       num_remaining_points = static_cast<uint32_t>(end - begin);
     }
 
@@ -165,6 +222,7 @@ class DynamicIntegerPointsKdTreeEncoder {
     uint32_t last_axis;
     uint32_t num_remaining_points;
     uint32_t stack_pos;  // used to get base and levels
+    uint32_t depth;
   };
 
   uint32_t bit_length_;
@@ -195,20 +253,162 @@ bool DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodePoints(
     return true;
   }
 
-  numbers_encoder_.StartEncoding();
-  remaining_bits_encoder_.StartEncoding();
-  axis_encoder_.StartEncoding();
-  half_encoder_.StartEncoding();
+  StartBitEncoders();
+  EncodeInternal<RandomAccessIteratorT>(
+      begin, end, KdTreeSubtreeRoot(dimension_, num_points_), 0, nullptr);
+  EndBitEncoders(buffer);
 
-  EncodeInternal(begin, end);
+  return true;
+}
 
-  numbers_encoder_.EndEncoding(buffer);
-  remaining_bits_encoder_.EndEncoding(buffer);
-  axis_encoder_.EndEncoding(buffer);
-  half_encoder_.EndEncoding(buffer);
+template <int compression_level_t>
+template <class RandomAccessIteratorT>
+bool DynamicIntegerPointsKdTreeEncoder<compression_level_t>::
+    EncodePointsWithIndex(RandomAccessIteratorT begin,
+                          RandomAccessIteratorT end,
+                          const uint32_t &bit_length, uint32_t index_depth,
+                          EncoderBuffer *buffer,
+                          std::vector<EncoderBuffer> *out_subtree_buffers) {
+  if (index_depth == 0) {
+    return false;
+  }
+  bit_length_ = bit_length;
+  num_points_ = static_cast<uint32_t>(end - begin);
+  out_subtree_buffers->clear();
 
+  buffer->Encode(bit_length_);
+  buffer->Encode(num_points_);
+  if (num_points_ == 0) {
+    return true;
+  }
+
+  // Encode the top levels of the tree and collect the subtrees.
+  std::vector<std::pair<RandomAccessIteratorT, KdTreeSubtreeRoot>> subtrees;
+  StartBitEncoders();
+  EncodeInternal(begin, end, KdTreeSubtreeRoot(dimension_, num_points_),
+                 index_depth, &subtrees);
+  EndBitEncoders(buffer);
+
+  // Encode each subtree with its own bit encoders.
+  out_subtree_buffers->resize(subtrees.size());
+  for (size_t i = 0; i < subtrees.size(); ++i) {
+    const RandomAccessIteratorT subtree_begin = subtrees[i].first;
+    const KdTreeSubtreeRoot &root = subtrees[i].second;
+    StartBitEncoders();
+    EncodeInternal<RandomAccessIteratorT>(
+        subtree_begin, subtree_begin + root.num_points, root, 0, nullptr);
+    EndBitEncoders(&(*out_subtree_buffers)[i]);
+  }
   return true;
 }
+
+template <int compression_level_t>
+template <class RandomAccessIteratorT>
+bool DynamicIntegerPointsKdTreeEncoder<compression_level_t>::
+    EncodePointsByLevels(RandomAccessIteratorT begin,
+                         RandomAccessIteratorT end,
+                         const uint32_t &bit_length, EncoderBuffer *buffer,
+                         std::vector<EncoderBuffer> *out_level_buffers) {
+  typedef std::pair<RandomAccessIteratorT, KdTreeSubtreeRoot> Node;
+  bit_length_ = bit_length;
+  num_points_ = static_cast<uint32_t>(end - begin);
+  out_level_buffers->clear();
+
+  buffer->Encode(bit_length_);
+  buffer->Encode(num_points_);
+  if (num_points_ == 0) {
+    return true;
+  }
+
+  std::vector<Node> nodes(
+      1, Node(begin, KdTreeSubtreeRoot(dimension_, num_points_)));
+  std::vector<Node> next_nodes;
+  while (!nodes.empty()) {
+    next_nodes.clear();
+    StartBitEncoders();
+    for (const Node &node : nodes) {
+      EncodeNode(node.first, node.second, &next_nodes);
+    }
+    out_level_buffers->emplace_back();
+    EndBitEncoders(&out_level_buffers->back());
+    nodes.swap(next_nodes);
+  }
+  return true;
+}
+
+template <int compression_level_t>
+template <class RandomAccessIteratorT>
+void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeNode(
+    RandomAccessIteratorT begin, const KdTreeSubtreeRoot &node,
+    std::vector<std::pair<RandomAccessIteratorT, KdTreeSubtreeRoot>>
+        *out_children) {
+  const RandomAccessIteratorT end = begin + node.num_points;
+  const uint32_t axis =
+      GetAndEncodeAxis(begin, end, node.base, node.levels, node.last_axis);
+  const uint32_t level = node.levels[axis];
+
+  // If this happens all axis are subdivided to the end.
+  if ((bit_length_ - level) == 0) {
+    return;
+  }
+
+  // Points of small nodes are encoded directly, the same way as in
+  // EncodeInternal().
+  if (node.num_points <= 2) {
+    axes_[0] = axis;
+    for (uint32_t i = 1; i < dimension_; i++) {
+      axes_[i] = DRACO_INCREMENT_MOD(axes_[i - 1], dimension_);
+    }
+    for (uint32_t i = 0; i < node.num_points; ++i) {
+      const auto &p = *(begin + i);
+      for (uint32_t j = 0; j < dimension_; j++) {
+        const uint32_t num_remaining_bits = bit_length_ - node.levels[axes_[j]];
+        if (num_remaining_bits) {
+          remaining_bits_encoder_.EncodeLeastSignificantBits32(
+              num_remaining_bits, p[axes_[j]]);
+        }
+      }
+    }
+    return;
+  }
+
+  const uint32_t num_remaining_bits = bit_length_ - level;
+  const uint32_t split_value =
+      node.base[axis] + (1 << (num_remaining_bits - 1));
+  const RandomAccessIteratorT split =
+      std::partition(begin, end, Splitter(axis, split_value));
+
+  // Encode number of points in first and second half.
+  const int required_bits = MostSignificantBit(node.num_points);
+  const uint32_t first_half = static_cast<uint32_t>(split - begin);
+  const uint32_t second_half = static_cast<uint32_t>(end - split);
+  const bool left = first_half < second_half;
+  if (first_half != second_half) {
+    half_encoder_.EncodeBit(left);
+  }
+  if (left) {
+    EncodeNumber(required_bits, node.num_points / 2 - first_half);
+  } else {
+    EncodeNumber(required_bits, node.num_points / 2 - second_half);
+  }
+
+  KdTreeSubtreeRoot child;
+  child.levels = node.levels;
+  child.levels[axis] += 1;
+  child.last_axis = axis;
+  if (split != begin) {
+    child.base = node.base;
+    child.num_points = first_half;
+    out_children->push_back(std::make_pair(begin, child));
+  }
+  if (split != end) {
+    child.base = node.base;
+    child.base[axis] = split_value;
+    child.num_points = second_half;
+    out_children->push_back(std::make_pair(split, child));
+  }
+}
+
 template <int compression_level_t>
 template <class RandomAccessIteratorT>
 uint32_t
@@ -271,12 +471,15 @@ DynamicIntegerPointsKdTreeEncoder<compression_level_t>::GetAndEncodeAxis(
 template <int compression_level_t>
 template <class RandomAccessIteratorT>
 void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
-    RandomAccessIteratorT begin, RandomAccessIteratorT end) {
+    RandomAccessIteratorT begin, RandomAccessIteratorT end,
+    const KdTreeSubtreeRoot &root, uint32_t max_depth,
+    std::vector<std::pair<RandomAccessIteratorT, KdTreeSubtreeRoot>>
+        *out_subtrees) {
   typedef EncodingStatus<RandomAccessIteratorT> Status;
 
-  base_stack_[0] = VectorUint32(dimension_, 0);
-  levels_stack_[0] = VectorUint32(dimension_, 0);
-  Status init_status(begin, end, 0, 0);
+  base_stack_[0] = root.base;
+  levels_stack_[0] = root.levels;
+  Status init_status(begin, end, root.last_axis, 0, 0);
   std::stack<Status> status_stack;
   status_stack.push(init_status);
 
@@ -292,6 +495,17 @@ void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
     const VectorUint32 &old_base = base_stack_[stack_pos];
     const VectorUint32 &levels = levels_stack_[stack_pos];
 
+    if (out_subtrees != nullptr && status.depth == max_depth) {
+      // The subtree is encoded separately by the caller.
+      KdTreeSubtreeRoot subtree;
+      subtree.base = old_base;
+      subtree.levels = levels;
+      subtree.last_axis = last_axis;
+      subtree.num_points = status.num_remaining_points;
+      out_subtrees->push_back(std::make_pair(begin, subtree));
+      continue;
+    }
+
     const uint32_t axis =
         GetAndEncodeAxis(begin, end, old_base, levels, last_axis);
     const uint32_t level = levels[axis];
@@ -355,10 +569,12 @@ void DynamicIntegerPointsKdTreeEncoder<compression_level_t>::EncodeInternal(
     levels_stack_[stack_pos][axis] += 1;
     levels_stack_[stack_pos + 1] = levels_stack_[stack_pos];  // copy
     if (split != begin) {
-      status_stack.push(Status(begin, split, axis, stack_pos));
+      status_stack.push(
+          Status(begin, split, axis, stack_pos, status.depth + 1));
     }
     if (split != end) {
-      status_stack.push(Status(split, end, axis, stack_pos + 1));
+      status_stack.push(
+          Status(split, end, axis, stack_pos + 1, status.depth + 1));
     }
   }
 }
@@ -45,6 +45,26 @@ struct PointDLess<VectorD<CoeffT, dimension_t>> {
   }
 };
 
+// State of the integer kd-tree coder at the root of a subtree that is coded
+// independently of the rest of the tree. See
+// DynamicIntegerPointsKdTreeEncoder::EncodePointsWithIndex().
+struct KdTreeSubtreeRoot {
+  KdTreeSubtreeRoot() : last_axis(0), num_points(0) {}
+  KdTreeSubtreeRoot(uint32_t dimension, uint32_t num_points_)
+      : base(dimension, 0),
+        levels(dimension, 0),
+        last_axis(0),
+        num_points(num_points_) {}
+
+  // Minimum corner of the cell containing all points of the subtree.
+  std::vector<uint32_t> base;
+  // Number of splits of the cell along each axis.
+  std::vector<uint32_t> levels;
+  // Axis used by the split that created the subtree.
+  uint32_t last_axis;
+  uint32_t num_points;
+};
+
 template <class PointDT>
 class PointTraits {};
 
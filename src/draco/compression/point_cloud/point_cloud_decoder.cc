@@ -14,6 +14,9 @@
 //
 #include "draco/compression/point_cloud/point_cloud_decoder.h"
 
+#include <algorithm>
+
+#include "draco/core/thread_pool.h"
 #include "draco/metadata/metadata_decoder.h"
 
 namespace draco {
@@ -23,7 +26,9 @@ PointCloudDecoder::PointCloudDecoder()
       buffer_(nullptr),
       version_major_(0),
       version_minor_(0),
-      options_(nullptr) {}
+      options_(nullptr),
+      resource_pool_(nullptr),
+      recycled_attributes_(nullptr) {}
 
 Status PointCloudDecoder::DecodeHeader(DecoderBuffer *buffer,
                                        DracoHeader *out_header) {
@@ -52,6 +57,27 @@ Status PointCloudDecoder::DecodeHeader(DecoderBuffer *buffer,
   return OkStatus();
 }
 
+std::unique_ptr<PointAttribute> PointCloudDecoder::CreateAttribute(
+    const GeometryAttribute &ga) {
+  std::unique_ptr<PointAttribute> att(new PointAttribute(ga));
+  if (recycled_attributes_ == nullptr) {
+    return att;
+  }
+  for (auto it = recycled_attributes_->begin();
+       it != recycled_attributes_->end(); ++it) {
+    const PointAttribute &recycled_att = **it;
+    if (recycled_att.attribute_type() == ga.attribute_type() &&
+        recycled_att.data_type() == ga.data_type() &&
+        recycled_att.num_components() == ga.num_components() &&
+        recycled_att.normalized() == ga.normalized()) {
+      att->RecycleStorage(it->get());
+      recycled_attributes_->erase(it);
+      break;
+    }
+  }
+  return att;
+}
+
 Status PointCloudDecoder::DecodeMetadata() {
   std::unique_ptr<GeometryMetadata> metadata =
       std::unique_ptr<GeometryMetadata>(new GeometryMetadata());
@@ -69,6 +95,9 @@ Status PointCloudDecoder::Decode(const DecoderOptions &options,
   options_ = &options;
   buffer_ = in_buffer;
   point_cloud_ = out_point_cloud;
+  // Clear data from any previous decoding so the decoder can be reused.
+  attributes_decoders_.clear();
+  attribute_to_decoder_map_.clear();
   DracoHeader header;
   DRACO_RETURN_IF_ERROR(DecodeHeader(buffer_, &header))
   // Sanity check that we are really using the right decoder (mostly for cases
@@ -177,14 +206,129 @@ bool PointCloudDecoder::DecodePointAttributes() {
 }
 
 bool PointCloudDecoder::DecodeAllAttributes() {
+  const int num_threads =
+      options_ ? options_->GetGlobalInt("num_decoding_threads", 1) : 1;
+  // Older bitstreams revert attribute transforms while the input buffer is
+  // being parsed so they can be decoded only sequentially.
+  if (num_threads > 1 && bitstream_version() >= DRACO_BITSTREAM_VERSION(2, 0)) {
+    if (!DecodeAllAttributesInParallel(num_threads)) {
+      return false;
+    }
+  } else {
+    for (auto &att_dec : attributes_decoders_) {
+      if (!att_dec->DecodeAttributes(buffer_)) {
+        return false;
+      }
+    }
+  }
   for (auto &att_dec : attributes_decoders_) {
-    if (!att_dec->DecodeAttributes(buffer_)) {
+    if (!att_dec->OnAllAttributesDecoded()) {
       return false;
     }
   }
   return true;
 }
 
+bool PointCloudDecoder::DecodeAllAttributesInParallel(int num_threads) {
+  // All data is parsed sequentially, only the work that does not depend on
+  // the input buffer is deferred.
+  for (auto &att_dec : attributes_decoders_) {
+    if (!att_dec->DecodeAttributesDeferred(buffer_)) {
+      return false;
+    }
+  }
+
+  // Each attribute must be finalized after all of its parent attributes. The
+  // attributes are grouped into levels where each level contains attributes
+  // whose parents belong to lower levels only.
+  struct DeferredAttribute {
+    AttributesDecoderInterface *decoder = nullptr;
+    int local_id = -1;
+    std::vector<int32_t> parent_ids;
+  };
+  const int num_attributes = point_cloud_->num_attributes();
+  if (num_attributes == 0) {
+    return true;
+  }
+  std::vector<DeferredAttribute> deferred_attributes(num_attributes);
+  for (auto &att_dec : attributes_decoders_) {
+    for (int i = 0; i < att_dec->GetNumAttributes(); ++i) {
+      const int32_t att_id = att_dec->GetAttributeId(i);
+      if (att_id < 0 || att_id >= num_attributes) {
+        return false;
+      }
+      deferred_attributes[att_id].decoder = att_dec.get();
+      deferred_attributes[att_id].local_id = i;
+      deferred_attributes[att_id].parent_ids =
+          att_dec->GetParentAttributeIds(i);
+    }
+  }
+  std::vector<int> levels(num_attributes, -1);
+  int num_levels = 0;
+  int num_assigned_attributes = 0;
+  while (num_assigned_attributes < num_attributes) {
+    bool progress = false;
+    for (int att_id = 0; att_id < num_attributes; ++att_id) {
+      if (levels[att_id] >= 0) {
+        continue;
+      }
+      if (deferred_attributes[att_id].decoder == nullptr) {
+        return false;  // Attribute not handled by any attribute decoder.
+      }
+      int level = 0;
+      for (const int32_t parent_id : deferred_attributes[att_id].parent_ids) {
+        if (parent_id < 0 || parent_id >= num_attributes ||
+            parent_id == att_id) {
+          return false;
+        }
+        if (levels[parent_id] < 0) {
+          level = -1;
+          break;
+        }
+        level = std::max(level, levels[parent_id] + 1);
+      }
+      if (level < 0) {
+        continue;  // Some parent attribute was not assigned yet.
+      }
+      levels[att_id] = level;
+      num_levels = std::max(num_levels, level + 1);
+      ++num_assigned_attributes;
+      progress = true;
+    }
+    if (!progress) {
+      return false;  // Cyclic dependency between attributes.
+    }
+  }
+
+  // There is no need for more threads than the number of attributes that can
+  // be finalized concurrently.
+  std::vector<int> level_sizes(num_levels, 0);
+  for (int att_id = 0; att_id < num_attributes; ++att_id) {
+    ++level_sizes[levels[att_id]];
+  }
+  ThreadPool thread_pool(std::min(
+      num_threads, *std::max_element(level_sizes.begin(), level_sizes.end())));
+  std::vector<uint8_t> finalized(num_attributes, 0);
+  for (int level = 0; level < num_levels; ++level) {
+    for (int att_id = 0; att_id < num_attributes; ++att_id) {
+      if (levels[att_id] != level) {
+        continue;
+      }
+      const DeferredAttribute &att = deferred_attributes[att_id];
+      thread_pool.Schedule([&att, &finalized, att_id]() {
+        finalized[att_id] = att.decoder->FinalizeAttribute(att.local_id);
+      });
+    }
+    thread_pool.Wait();
+    for (int att_id = 0; att_id < num_attributes; ++att_id) {
+      if (levels[att_id] == level && !finalized[att_id]) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 const PointAttribute *PointCloudDecoder::GetPortableAttribute(
     int32_t parent_att_id) {
   if (parent_att_id < 0 || parent_att_id >= point_cloud_->num_attributes()) {
@@ -15,9 +15,13 @@
 #ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_DECODER_H_
 #define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_DECODER_H_
 
+#include <memory>
+#include <vector>
+
 #include "draco/compression/attributes/attributes_decoder_interface.h"
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/config/decoder_options.h"
+#include "draco/compression/decoder_resource_pool.h"
 #include "draco/core/status.h"
 #include "draco/point_cloud/point_cloud.h"
 
@@ -64,6 +68,15 @@ class PointCloudDecoder {
     return DRACO_BITSTREAM_VERSION(version_major_, version_minor_);
   }
 
+  // Returns true if the decoded bitstream may contain symbols encoded with the
+  // SYMBOL_CODING_RAW_INTERLEAVED method. The method was added in mesh
+  // bitstream version 2.3 and in point cloud bitstream version 2.4.
+  bool IsInterleavedSymbolCodingSupported() const {
+    return bitstream_version() >= (GetGeometryType() == POINT_CLOUD
+                                       ? DRACO_BITSTREAM_VERSION(2, 4)
+                                       : DRACO_BITSTREAM_VERSION(2, 3));
+  }
+
   const AttributesDecoderInterface *attributes_decoder(int dec_id) {
     return attributes_decoders_[dec_id].get();
   }
@@ -79,6 +92,24 @@ class PointCloudDecoder {
   DecoderBuffer *buffer() { return buffer_; }
   const DecoderOptions *options() const { return options_; }
 
+  // Sets attributes of a previously decoded geometry whose memory can be
+  // reused by the decoded attributes. The reused attributes are removed from
+  // |attributes|. The vector is not owned by the decoder. Can be nullptr.
+  void SetRecycledAttributes(
+      std::vector<std::unique_ptr<PointAttribute>> *attributes) {
+    recycled_attributes_ = attributes;
+  }
+
+  // Creates a new attribute described by |ga| for the decoded point cloud.
+  // When there is a recycled attribute with the same layout, its memory is
+  // reused by the new attribute. See SetRecycledAttributes().
+  std::unique_ptr<PointAttribute> CreateAttribute(const GeometryAttribute &ga);
+
+  // Sets a pool of temporary resources that can be reused by the decoder. The
+  // pool is not owned by the decoder and it must outlive it. Can be nullptr.
+  void SetResourcePool(DecoderResourcePool *pool) { resource_pool_ = pool; }
+  DecoderResourcePool *resource_pool() const { return resource_pool_; }
+
  protected:
   // Can be implemented by derived classes to perform any custom initialization
   // of the decoder. Called in the Decode() method.
@@ -90,6 +121,11 @@ class PointCloudDecoder {
   virtual bool DecodePointAttributes();
 
   virtual bool DecodeAllAttributes();
+  // Decodes all attributes using the deferred decoding of the attribute
+  // decoders (see AttributesDecoderInterface::DecodeAttributesDeferred()).
+  // Attributes are finalized on |num_threads| threads in an order given by
+  // dependencies between the attributes.
+  bool DecodeAllAttributesInParallel(int num_threads);
   virtual bool OnAttributesDecoded() { return true; }
 
   Status DecodeMetadata();
@@ -111,6 +147,10 @@ class PointCloudDecoder {
   uint8_t version_minor_;
 
   const DecoderOptions *options_;
+
+  DecoderResourcePool *resource_pool_;
+
+  std::vector<std::unique_ptr<PointAttribute>> *recycled_attributes_;
 };
 
 }  // namespace draco
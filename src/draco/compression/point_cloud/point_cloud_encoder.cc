@@ -14,6 +14,9 @@
 //
 #include "draco/compression/point_cloud/point_cloud_encoder.h"
 
+#include <algorithm>
+
+#include "draco/core/thread_pool.h"
 #include "draco/metadata/metadata_encoder.h"
 
 namespace draco {
@@ -38,8 +41,12 @@ Status PointCloudEncoder::Encode(const EncoderOptions &options,
   if (!point_cloud_) {
     return Status(Status::DRACO_ERROR, "Invalid input geometry.");
   }
+  // Every completed section of the encoded data is flushed to the output of
+  // |buffer_| (if any), so that the buffer does not need to hold the entire
+  // encoded geometry.
   DRACO_RETURN_IF_ERROR(EncodeHeader())
   DRACO_RETURN_IF_ERROR(EncodeMetadata())
+  DRACO_RETURN_IF_ERROR(FlushBuffer())
   if (!InitializeEncoder()) {
     return Status(Status::DRACO_ERROR, "Failed to initialize encoder.");
   }
@@ -47,9 +54,11 @@ Status PointCloudEncoder::Encode(const EncoderOptions &options,
     return Status(Status::DRACO_ERROR, "Failed to encode internal data.");
   }
   DRACO_RETURN_IF_ERROR(EncodeGeometryData());
+  DRACO_RETURN_IF_ERROR(FlushBuffer())
   if (!EncodePointAttributes()) {
     return Status(Status::DRACO_ERROR, "Failed to encode point attributes.");
   }
+  DRACO_RETURN_IF_ERROR(FlushBuffer())
   if (options.GetGlobalBool("store_number_of_encoded_points", false)) {
     ComputeNumberOfEncodedPoints();
   }
@@ -62,16 +71,9 @@ Status PointCloudEncoder::EncodeHeader() {
   buffer_->Encode("DRACO", 5);
   // Version (major, minor).
   const uint8_t encoder_type = GetGeometryType();
-  uint8_t version_major, version_minor;
-  version_major = encoder_type == POINT_CLOUD
-                      ? kDracoPointCloudBitstreamVersionMajor
-                      : kDracoMeshBitstreamVersionMajor;
-  version_minor = encoder_type == POINT_CLOUD
-                      ? kDracoPointCloudBitstreamVersionMinor
-                      : kDracoMeshBitstreamVersionMinor;
-
-  buffer_->Encode(version_major);
-  buffer_->Encode(version_minor);
+  const uint16_t version = GetBitstreamVersion();
+  buffer_->Encode(DRACO_BISTREAM_VERSION_MAJOR(version));
+  buffer_->Encode(DRACO_BISTREAM_VERSION_MINOR(version));
   // Type of the encoder (point cloud, mesh, ...).
   buffer_->Encode(encoder_type);
   // Unique identifier for the selected encoding method (edgebreaker, etc...).
@@ -86,6 +88,34 @@ Status PointCloudEncoder::EncodeHeader() {
   return OkStatus();
 }
 
+uint16_t PointCloudEncoder::GetBitstreamVersion() const {
+  // Interleaved symbol coding was added in mesh bitstream version 2.3 and in
+  // point cloud bitstream version 2.4.
+  const bool interleaved_symbol_coding =
+      options_->GetGlobalBool("interleaved_symbol_coding", false);
+  if (GetGeometryType() == POINT_CLOUD) {
+    if (GetEncodingMethod() == POINT_CLOUD_KD_TREE_ENCODING &&
+        (options_->GetGlobalInt("kd_tree_index_depth", 0) > 0 ||
+         options_->GetGlobalBool("kd_tree_progressive", false))) {
+      // The subtree index and the progressive layout of the kd-tree data were
+      // added in version 2.5. The default depth-first layout is written in the
+      // older format.
+      return DRACO_BITSTREAM_VERSION(2, 5);
+    }
+    return interleaved_symbol_coding ? DRACO_BITSTREAM_VERSION(2, 4)
+                                     : DRACO_BITSTREAM_VERSION(2, 3);
+  }
+  return interleaved_symbol_coding ? DRACO_BITSTREAM_VERSION(2, 3)
+                                   : DRACO_BITSTREAM_VERSION(2, 2);
+}
+
+Status PointCloudEncoder::FlushBuffer() {
+  if (!buffer_->Flush()) {
+    return Status(Status::IO_ERROR, "Failed to write the encoded data.");
+  }
+  return OkStatus();
+}
+
 Status PointCloudEncoder::EncodeMetadata() {
   if (!point_cloud_->GetMetadata()) {
     return OkStatus();
@@ -135,6 +165,9 @@ bool PointCloudEncoder::EncodePointAttributes() {
       return false;
     }
   }
+  if (!buffer_->Flush()) {
+    return false;
+  }
 
   // Lastly encode all the attributes using the provided attribute encoders.
   if (!EncodeAllAttributes()) {
@@ -159,10 +192,104 @@ bool PointCloudEncoder::GenerateAttributesEncoders() {
 }
 
 bool PointCloudEncoder::EncodeAllAttributes() {
+  const int num_threads =
+      options_ ? options_->GetGlobalInt("num_encoding_threads", 1) : 1;
+  if (num_threads > 1 && attributes_encoders_.size() > 1) {
+    return EncodeAllAttributesInParallel(num_threads);
+  }
   for (int att_encoder_id : attributes_encoder_ids_order_) {
     if (!attributes_encoders_[att_encoder_id]->EncodeAttributes(buffer_)) {
       return false;
     }
+    if (!buffer_->Flush()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool PointCloudEncoder::EncodeAllAttributesInParallel(int num_threads) {
+  // Each attributes encoder can run only after the encoders of all its parent
+  // attributes are finished. The encoders are grouped into levels where each
+  // level contains encoders whose parents belong to lower levels only. The
+  // encoding order is already sorted by the dependencies so the levels can be
+  // computed in a single pass.
+  const int num_encoders = static_cast<int>(attributes_encoders_.size());
+  std::vector<int> levels(num_encoders, -1);
+  int num_levels = 0;
+  for (int att_encoder_id : attributes_encoder_ids_order_) {
+    AttributesEncoder *const att_enc =
+        attributes_encoders_[att_encoder_id].get();
+    int level = 0;
+    for (uint32_t i = 0; i < att_enc->num_attributes(); ++i) {
+      const int32_t att_id = att_enc->GetAttributeId(i);
+      for (int p = 0; p < att_enc->NumParentAttributes(att_id); ++p) {
+        const int32_t parent_encoder_id =
+            attribute_to_encoder_map_[att_enc->GetParentAttributeId(att_id, p)];
+        if (parent_encoder_id == att_encoder_id) {
+          continue;  // Dependencies within an encoder are resolved by it.
+        }
+        if (levels[parent_encoder_id] < 0) {
+          return false;  // Parent encoder is not processed before its child.
+        }
+        level = std::max(level, levels[parent_encoder_id] + 1);
+      }
+    }
+    levels[att_encoder_id] = level;
+    num_levels = std::max(num_levels, level + 1);
+  }
+
+  // Every encoder writes its data into a separate buffer. Buffers are passed
+  // to |buffer_| in the canonical encoding order as soon as all preceding
+  // encoders are finished, which makes the output identical to the sequential
+  // encoding.
+  std::vector<int> level_sizes(num_levels, 0);
+  for (int att_encoder_id = 0; att_encoder_id < num_encoders;
+       ++att_encoder_id) {
+    ++level_sizes[levels[att_encoder_id]];
+  }
+  ThreadPool thread_pool(std::min(
+      num_threads, *std::max_element(level_sizes.begin(), level_sizes.end())));
+  std::vector<EncoderBuffer> encoder_buffers(num_encoders);
+  std::vector<uint8_t> encoded(num_encoders, 0);
+  size_t num_written_encoders = 0;
+  for (int level = 0; level < num_levels; ++level) {
+    for (int att_encoder_id = 0; att_encoder_id < num_encoders;
+         ++att_encoder_id) {
+      if (levels[att_encoder_id] != level) {
+        continue;
+      }
+      AttributesEncoder *const att_enc =
+          attributes_encoders_[att_encoder_id].get();
+      EncoderBuffer *const att_buffer = &encoder_buffers[att_encoder_id];
+      thread_pool.Schedule([att_enc, att_buffer, &encoded, att_encoder_id]() {
+        encoded[att_encoder_id] = att_enc->EncodeAttributes(att_buffer);
+      });
+    }
+    thread_pool.Wait();
+    for (int att_encoder_id = 0; att_encoder_id < num_encoders;
+         ++att_encoder_id) {
+      if (levels[att_encoder_id] == level && !encoded[att_encoder_id]) {
+        return false;
+      }
+    }
+    while (num_written_encoders < attributes_encoder_ids_order_.size()) {
+      const int att_encoder_id =
+          attributes_encoder_ids_order_[num_written_encoders];
+      if (levels[att_encoder_id] > level) {
+        break;
+      }
+      EncoderBuffer *const att_buffer = &encoder_buffers[att_encoder_id];
+      if (!buffer_->Encode(att_buffer->data(), att_buffer->size())) {
+        return false;
+      }
+      if (!buffer_->Flush()) {
+        return false;
+      }
+      // Release the memory of the encoded data.
+      *att_buffer = EncoderBuffer();
+      ++num_written_encoders;
+    }
   }
   return true;
 }
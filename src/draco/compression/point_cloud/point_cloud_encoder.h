@@ -44,6 +44,12 @@ class PointCloudEncoder {
   // for mesh compression).
   virtual uint8_t GetEncodingMethod() const = 0;
 
+  // Returns the bitstream version of the encoded data. It is the oldest version
+  // that supports all features requested by the encoder options, so that the
+  // data can be decoded by older decoders whenever possible. Valid only during
+  // the Encode() function call.
+  uint16_t GetBitstreamVersion() const;
+
   // Returns the number of points that were encoded during the last Encode()
   // function call. Valid only if "store_number_of_encoded_points" flag was set
   // in the provided EncoderOptions.
@@ -115,6 +121,10 @@ class PointCloudEncoder {
   // Encodes all the attribute data using the created attribute encoders.
   virtual bool EncodeAllAttributes();
 
+  // Encodes the attribute data of attributes encoders that do not depend on
+  // each other concurrently using up to |num_threads| threads.
+  bool EncodeAllAttributesInParallel(int num_threads);
+
   // Computes and sets the num_encoded_points_ for the encoder.
   virtual void ComputeNumberOfEncodedPoints() = 0;
 
@@ -129,6 +139,9 @@ class PointCloudEncoder {
   // Encode metadata.
   Status EncodeMetadata();
 
+  // Passes the data encoded so far to the output of |buffer_|.
+  Status FlushBuffer();
+
   // Rearranges attribute encoders and their attributes to reflect the
   // underlying attribute dependencies. This ensures that the attributes are
   // encoded in the correct order (parent attributes before their children).
@@ -145,7 +158,8 @@ class PointCloudEncoder {
   // in which they were created because of attribute dependencies.
   std::vector<int32_t> attributes_encoder_ids_order_;
 
-  // This buffer holds the final encoded data.
+  // This buffer holds the final encoded data. When the buffer has an output
+  // function, it holds only the data encoded since the last flush.
   EncoderBuffer *buffer_;
 
   const EncoderOptions *options_;
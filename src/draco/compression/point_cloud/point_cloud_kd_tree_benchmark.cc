@@ -0,0 +1,101 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "benchmark/benchmark.h"
+#include "draco/compression/point_cloud/point_cloud_kd_tree_decoder.h"
+#include "draco/compression/point_cloud/point_cloud_kd_tree_encoder.h"
+#include "draco/core/draco_benchmark_utils.h"
+
+namespace draco {
+namespace {
+
+// The kd-tree coders are run on the vertices of the benchmark meshes, ignoring
+// their connectivity.
+Status EncodeKdTreePointCloud(const PointCloud &pc, int speed,
+                              int quantization_bits,
+                              EncoderBuffer *out_buffer) {
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetGlobalInt("quantization_bits", quantization_bits);
+  options.SetSpeed(speed, speed);
+  PointCloudKdTreeEncoder encoder;
+  encoder.SetPointCloud(pc);
+  out_buffer->Clear();
+  return encoder.Encode(options, out_buffer);
+}
+
+void BM_KdTreeEncodePointCloud(benchmark::State &state) {
+  const Mesh *const mesh = GetBenchmarkMesh(state.range(kBenchmarkMeshArg));
+  if (mesh == nullptr) {
+    state.SkipWithError("Failed to load the input mesh.");
+    return;
+  }
+  const int speed = state.range(kBenchmarkSpeedArg);
+  const int quantization_bits = state.range(kBenchmarkQuantizationArg);
+  EncoderBuffer buffer;
+  for (auto _ : state) {
+    const Status status =
+        EncodeKdTreePointCloud(*mesh, speed, quantization_bits, &buffer);
+    if (!status.ok()) {
+      state.SkipWithError(status.error_msg());
+      return;
+    }
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  int64_t data_size = 0;
+  for (int i = 0; i < mesh->num_attributes(); ++i) {
+    data_size += mesh->attribute(i)->buffer()->data_size();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          data_size);
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          mesh->num_points());
+  state.counters["encoded_bytes"] = static_cast<double>(buffer.size());
+}
+BENCHMARK(BM_KdTreeEncodePointCloud)->Apply(ApplyMeshSpeedQuantizationArgs);
+
+void BM_KdTreeDecodePointCloud(benchmark::State &state) {
+  const Mesh *const mesh = GetBenchmarkMesh(state.range(kBenchmarkMeshArg));
+  if (mesh == nullptr) {
+    state.SkipWithError("Failed to load the input mesh.");
+    return;
+  }
+  EncoderBuffer encoded;
+  if (!EncodeKdTreePointCloud(*mesh, state.range(kBenchmarkSpeedArg),
+                              state.range(kBenchmarkQuantizationArg), &encoded)
+           .ok()) {
+    state.SkipWithError("Failed to encode the input point cloud.");
+    return;
+  }
+  const DecoderOptions options;
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    PointCloud out_pc;
+    PointCloudKdTreeDecoder decoder;
+    const Status status = decoder.Decode(options, &buffer, &out_pc);
+    if (!status.ok()) {
+      state.SkipWithError(status.error_msg());
+      return;
+    }
+    benchmark::DoNotOptimize(out_pc.num_points());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          encoded.size());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          mesh->num_points());
+}
+BENCHMARK(BM_KdTreeDecodePointCloud)->Apply(ApplyMeshSpeedQuantizationArgs);
+
+}  // namespace
+}  // namespace draco
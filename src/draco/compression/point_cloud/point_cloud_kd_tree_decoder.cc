@@ -14,10 +14,72 @@
 //
 #include "draco/compression/point_cloud/point_cloud_kd_tree_decoder.h"
 
-#include "draco/compression/attributes/kd_tree_attributes_decoder.h"
+#include <utility>
+
+#include "draco/compression/config/compression_shared.h"
 
 namespace draco {
 
+PointCloudKdTreeDecoder::PointCloudKdTreeDecoder()
+    : progressive_(false), kd_tree_decoder_(nullptr) {}
+
+Status PointCloudKdTreeDecoder::DecodeProgressive(
+    const DecoderOptions &options, int max_depth, DecoderBuffer *in_buffer,
+    PointCloud *out_point_cloud) {
+  // Reset the state of any previous progressive decoding.
+  progressive_ = false;
+  kd_tree_decoder_ = nullptr;
+  DecoderBuffer header_buffer = *in_buffer;
+  DracoHeader header;
+  DRACO_RETURN_IF_ERROR(DecodeHeader(&header_buffer, &header));
+  if (header.encoder_method != POINT_CLOUD_KD_TREE_ENCODING) {
+    return Status(Status::DRACO_ERROR, "Input is not a kd-tree point cloud.");
+  }
+  progressive_options_ = options;
+  progressive_options_.SetGlobalInt("kd_tree_max_depth", max_depth);
+  progressive_ = true;
+  const Status status =
+      Decode(progressive_options_, in_buffer, out_point_cloud);
+  progressive_ = false;
+  if (!status.ok()) {
+    kd_tree_decoder_ = nullptr;
+  }
+  return status;
+}
+
+Status PointCloudKdTreeDecoder::DecodeMoreLevels(int max_depth,
+                                                 DecoderBuffer *in_buffer) {
+  KdTreeAttributesDecoder *const kd_tree_decoder = progressive_decoder();
+  if (kd_tree_decoder == nullptr) {
+    return Status(Status::DRACO_ERROR,
+                  "Progressive decoding was not started.");
+  }
+  if (!kd_tree_decoder->DecodeMoreLevels(max_depth, in_buffer)) {
+    return Status(Status::DRACO_ERROR, "Failed to decode kd-tree levels.");
+  }
+  return OkStatus();
+}
+
+int PointCloudKdTreeDecoder::num_levels() const {
+  const KdTreeAttributesDecoder *const kd_tree_decoder = progressive_decoder();
+  return kd_tree_decoder ? kd_tree_decoder->num_levels() : 0;
+}
+
+int PointCloudKdTreeDecoder::num_decoded_levels() const {
+  const KdTreeAttributesDecoder *const kd_tree_decoder = progressive_decoder();
+  return kd_tree_decoder ? kd_tree_decoder->num_decoded_levels() : 0;
+}
+
+KdTreeAttributesDecoder *PointCloudKdTreeDecoder::progressive_decoder() const {
+  // Decode() destroys all attribute decoders before it starts decoding, so
+  // |kd_tree_decoder_| is valid only while some attribute decoder exists. A
+  // new attribute decoder resets |kd_tree_decoder_| when it is created.
+  if (num_attributes_decoders() == 0) {
+    return nullptr;
+  }
+  return kd_tree_decoder_;
+}
+
 bool PointCloudKdTreeDecoder::DecodeGeometryData() {
   int32_t num_points;
   if (!buffer()->Decode(&num_points)) {
@@ -32,9 +94,14 @@ bool PointCloudKdTreeDecoder::DecodeGeometryData() {
 
 bool PointCloudKdTreeDecoder::CreateAttributesDecoder(int32_t att_decoder_id) {
   // Always create the basic attribute decoder.
-  return SetAttributesDecoder(
-      att_decoder_id,
-      std::unique_ptr<AttributesDecoder>(new KdTreeAttributesDecoder()));
+  std::unique_ptr<KdTreeAttributesDecoder> decoder(
+      new KdTreeAttributesDecoder());
+  kd_tree_decoder_ = nullptr;
+  if (progressive_) {
+    decoder->EnableProgressiveDecoding();
+    kd_tree_decoder_ = decoder.get();
+  }
+  return SetAttributesDecoder(att_decoder_id, std::move(decoder));
 }
 
 }  // namespace draco
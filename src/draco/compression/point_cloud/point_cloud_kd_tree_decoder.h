@@ -15,15 +15,57 @@
 #ifndef DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_KD_TREE_DECODER_H_
 #define DRACO_COMPRESSION_POINT_CLOUD_POINT_CLOUD_KD_TREE_DECODER_H_
 
+#include "draco/compression/attributes/kd_tree_attributes_decoder.h"
+#include "draco/compression/config/decoder_options.h"
 #include "draco/compression/point_cloud/point_cloud_decoder.h"
 
 namespace draco {
 
 // Decodes PointCloud encoded with the PointCloudKdTreeEncoder.
 class PointCloudKdTreeDecoder : public PointCloudDecoder {
+ public:
+  PointCloudKdTreeDecoder();
+
+  // Decodes a point cloud encoded with the progressive kd-tree layout (see
+  // EncoderBase::SetKdTreeProgressiveEncoding()) up to depth |max_depth| of
+  // the kd-tree (-1 for all levels). Each node of the tree at |max_depth| is
+  // represented by a single point. Levels whose data is not fully contained
+  // in |in_buffer| are not decoded, so a coarse point cloud can be decoded
+  // from a partially received buffer. The decoding can be continued later
+  // with DecodeMoreLevels(). |out_point_cloud| must outlive the decoder.
+  Status DecodeProgressive(const DecoderOptions &options, int max_depth,
+                           DecoderBuffer *in_buffer,
+                           PointCloud *out_point_cloud);
+
+  // Continues decoding of the point cloud passed to DecodeProgressive() up to
+  // depth |max_depth|. The decoded points of the point cloud are replaced by
+  // the finer version. |in_buffer| must start at the first byte that was not
+  // consumed by the previous call, i.e., at the position of the buffer passed
+  // to the previous call after it returned.
+  Status DecodeMoreLevels(int max_depth, DecoderBuffer *in_buffer);
+
+  // Returns the number of encoded levels of the kd-tree and the number of
+  // levels decoded so far. Valid only after DecodeProgressive().
+  int num_levels() const;
+  int num_decoded_levels() const;
+
  protected:
   bool DecodeGeometryData() override;
   bool CreateAttributesDecoder(int32_t att_decoder_id) override;
+
+ private:
+  // Returns the attributes decoder of the last successful DecodeProgressive()
+  // or nullptr when there is no progressive decoding to continue.
+  KdTreeAttributesDecoder *progressive_decoder() const;
+
+  // Copy of the options passed to DecodeProgressive() that stays valid for
+  // the subsequent calls to DecodeMoreLevels().
+  DecoderOptions progressive_options_;
+  // True while DecodeProgressive() is decoding the initial levels.
+  bool progressive_;
+  // Progressive attributes decoder owned by the base class. See
+  // progressive_decoder().
+  KdTreeAttributesDecoder *kd_tree_decoder_;
 };
 
 }  // namespace draco
@@ -12,6 +12,8 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include "draco/compression/decode.h"
+#include "draco/compression/encode.h"
 #include "draco/compression/point_cloud/point_cloud_kd_tree_decoder.h"
 #include "draco/compression/point_cloud/point_cloud_kd_tree_encoder.h"
 #include "draco/core/draco_test_base.h"
@@ -59,11 +61,14 @@ class PointCloudKdTreeEncodingTest : public ::testing::Test {
     }
   }
 
-  void TestKdTreeEncoding(const PointCloud &pc) {
+  void TestKdTreeEncoding(const PointCloud &pc, int index_depth = 0,
+                          bool progressive = false) {
     EncoderBuffer buffer;
     PointCloudKdTreeEncoder encoder;
     EncoderOptions options = EncoderOptions::CreateDefaultOptions();
     options.SetGlobalInt("quantization_bits", 16);
+    options.SetGlobalInt("kd_tree_index_depth", index_depth);
+    options.SetGlobalBool("kd_tree_progressive", progressive);
     for (int compression_level = 0; compression_level <= 6;
          ++compression_level) {
       options.SetSpeed(10 - compression_level, 10 - compression_level);
@@ -88,6 +93,25 @@ class PointCloudKdTreeEncodingTest : public ::testing::Test {
 
     TestKdTreeEncoding(*pc);
   }
+
+  // Encodes |pc| using the kd-tree method with a subtree index.
+  void EncodeWithIndex(const PointCloud &pc, int index_depth,
+                       EncoderBuffer *buffer) {
+    Encoder encoder;
+    encoder.SetEncodingMethod(POINT_CLOUD_KD_TREE_ENCODING);
+    encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 14);
+    encoder.SetKdTreeIndexDepth(index_depth);
+    DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(pc, buffer));
+  }
+
+  // Encodes |pc| using the kd-tree method with the progressive layout.
+  void EncodeProgressive(const PointCloud &pc, EncoderBuffer *buffer) {
+    Encoder encoder;
+    encoder.SetEncodingMethod(POINT_CLOUD_KD_TREE_ENCODING);
+    encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 14);
+    encoder.SetKdTreeProgressiveEncoding(true);
+    DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(pc, buffer));
+  }
 };
 
 TEST_F(PointCloudKdTreeEncodingTest, TestFloatKdTreeEncoding) {
@@ -455,4 +479,357 @@ TEST_F(PointCloudKdTreeEncodingTest, TestIntKdTreeEncodingHighDimensional) {
   TestKdTreeEncoding(*pc);
 }
 
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeEncodingWithIndex) {
+  // Decoding of all subtrees must produce the same points as decoding of
+  // data without the index.
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("cube_subd.obj");
+  ASSERT_NE(pc, nullptr);
+  TestKdTreeEncoding(*pc, 1);
+  TestKdTreeEncoding(*pc, 5);
+  TestKdTreeEncoding(*pc, 40);
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeBitstreamVersion) {
+  // The default depth-first layout must be encoded in the format readable by
+  // older decoders. Only the subtree index and the progressive layout require
+  // bitstream version 2.5.
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("cube_subd.obj");
+  ASSERT_NE(pc, nullptr);
+  const auto get_version_minor = [](const EncoderBuffer &buffer) {
+    // The version follows the "DRACO" string.
+    return static_cast<int>(buffer.data()[6]);
+  };
+
+  EncoderBuffer buffer;
+  Encoder encoder;
+  encoder.SetEncodingMethod(POINT_CLOUD_KD_TREE_ENCODING);
+  encoder.SetAttributeQuantization(GeometryAttribute::POSITION, 14);
+  DRACO_ASSERT_OK(encoder.EncodePointCloudToBuffer(*pc, &buffer));
+  ASSERT_EQ(buffer.data()[5], 2);
+  ASSERT_EQ(get_version_minor(buffer), 3);
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> out_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ComparePointClouds(*pc, *out_pc);
+
+  EncoderBuffer index_buffer;
+  EncodeWithIndex(*pc, 4, &index_buffer);
+  ASSERT_EQ(get_version_minor(index_buffer), 5);
+
+  EncoderBuffer progressive_buffer;
+  EncodeProgressive(*pc, &progressive_buffer);
+  ASSERT_EQ(get_version_minor(progressive_buffer), 5);
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeQueryBox) {
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("bun_zipper.ply");
+  ASSERT_NE(pc, nullptr);
+  EncoderBuffer buffer;
+  EncodeWithIndex(*pc, 6, &buffer);
+
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  Decoder decoder;
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> full_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ASSERT_EQ(full_pc->num_points(), pc->num_points());
+
+  // Query a box around the minimum corner of the point cloud. Options store
+  // the box with a limited precision so the points are tested against the box
+  // stored in the options.
+  const BoundingBox bbox = full_pc->ComputeBoundingBox();
+  decoder.SetKdTreeQueryBox(BoundingBox(
+      bbox.GetMinPoint(), bbox.GetMinPoint() + bbox.Size() * 0.5f));
+  float query_box[6];
+  ASSERT_TRUE(
+      decoder.options()->GetGlobalVector("kd_tree_query_box", 6, query_box));
+  const auto is_inside = [&query_box](const std::array<float, 3> &pos) {
+    for (int c = 0; c < 3; ++c) {
+      if (pos[c] < query_box[c] || pos[c] > query_box[3 + c]) {
+        return false;
+      }
+    }
+    return true;
+  };
+  const PointAttribute *const full_pos_att =
+      full_pc->GetNamedAttribute(GeometryAttribute::POSITION);
+  int num_expected_points = 0;
+  for (PointIndex pi(0); pi < full_pc->num_points(); ++pi) {
+    const std::array<float, 3> pos =
+        full_pos_att->GetValue<float, 3>(full_pos_att->mapped_index(pi));
+    if (is_inside(pos)) {
+      ++num_expected_points;
+    }
+  }
+  ASSERT_GT(num_expected_points, 0);
+  ASSERT_LT(num_expected_points, full_pc->num_points());
+
+  dec_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> query_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ASSERT_EQ(query_pc->num_points(), num_expected_points);
+  const PointAttribute *const pos_att =
+      query_pc->GetNamedAttribute(GeometryAttribute::POSITION);
+  ASSERT_EQ(pos_att->size(), num_expected_points);
+  for (PointIndex pi(0); pi < query_pc->num_points(); ++pi) {
+    ASSERT_TRUE(
+        is_inside(pos_att->GetValue<float, 3>(pos_att->mapped_index(pi))));
+  }
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeQueryBoxOutsideOfRange) {
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("bun_zipper.ply");
+  ASSERT_NE(pc, nullptr);
+  EncoderBuffer buffer;
+  EncodeWithIndex(*pc, 6, &buffer);
+  DecoderBuffer dec_buffer;
+  Decoder decoder;
+
+  // Boxes far outside of the data select no points.
+  const Vector3f far_point(1e30f, 1e30f, 1e30f);
+  decoder.SetKdTreeQueryBox(BoundingBox(far_point, far_point * 2.f));
+  dec_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> out_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ASSERT_EQ(out_pc->num_points(), 0);
+  decoder.SetKdTreeQueryBox(BoundingBox(far_point * -2.f, -far_point));
+  dec_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(out_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ASSERT_EQ(out_pc->num_points(), 0);
+
+  // A box enclosing the data from far away selects all points.
+  decoder.SetKdTreeQueryBox(BoundingBox(-far_point, far_point));
+  dec_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSIGN_OR_ASSERT(out_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ASSERT_EQ(out_pc->num_points(), pc->num_points());
+
+  // Boxes with non-finite coordinates are rejected.
+  const float kInf = std::numeric_limits<float>::infinity();
+  const float kNaN = std::numeric_limits<float>::quiet_NaN();
+  for (const float value : {kInf, -kInf, kNaN}) {
+    decoder.SetKdTreeQueryBox(
+        BoundingBox(Vector3f(0.f, value, 0.f), Vector3f(1.f, 1.f, 1.f)));
+    dec_buffer.Init(buffer.data(), buffer.size());
+    ASSERT_FALSE(decoder.DecodePointCloudFromBuffer(&dec_buffer).ok());
+  }
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeMaxDepth) {
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("bun_zipper.ply");
+  ASSERT_NE(pc, nullptr);
+  EncoderBuffer buffer;
+  EncodeWithIndex(*pc, 6, &buffer);
+
+  // Each subtree is represented by a single point.
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  Decoder decoder;
+  decoder.SetKdTreeMaxDepth(6);
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> coarse_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ASSERT_GT(coarse_pc->num_points(), 0);
+  ASSERT_LE(coarse_pc->num_points(), 1 << 6);
+
+  // Subtrees cannot be truncated below the depth of the index.
+  dec_buffer.Init(buffer.data(), buffer.size());
+  decoder.SetKdTreeMaxDepth(7);
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<PointCloud> full_pc,
+                         decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ASSERT_EQ(full_pc->num_points(), pc->num_points());
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeProgressiveEncoding) {
+  // Decoding of all levels must produce the same points as decoding of data
+  // encoded in the depth-first order.
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("cube_subd.obj");
+  ASSERT_NE(pc, nullptr);
+  TestKdTreeEncoding(*pc, 0, true);
+
+  // The progressive layout cannot be combined with the subtree index.
+  PointCloudKdTreeEncoder encoder;
+  EncoderOptions options = EncoderOptions::CreateDefaultOptions();
+  options.SetGlobalInt("quantization_bits", 16);
+  options.SetGlobalInt("kd_tree_index_depth", 4);
+  options.SetGlobalBool("kd_tree_progressive", true);
+  encoder.SetPointCloud(*pc);
+  EncoderBuffer buffer;
+  ASSERT_FALSE(encoder.Encode(options, &buffer).ok());
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeProgressiveDecoding) {
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("bun_zipper.ply");
+  ASSERT_NE(pc, nullptr);
+  EncoderBuffer buffer;
+  EncodeProgressive(*pc, &buffer);
+
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  PointCloudKdTreeDecoder decoder;
+  PointCloud out_pc;
+  DRACO_ASSERT_OK(
+      decoder.DecodeProgressive(DecoderOptions(), 4, &dec_buffer, &out_pc));
+  ASSERT_EQ(decoder.num_decoded_levels(), 4);
+  ASSERT_GT(decoder.num_levels(), 4);
+  ASSERT_GT(out_pc.num_points(), 0);
+  ASSERT_LE(out_pc.num_points(), 1 << 4);
+
+  // Points representing the nodes must lie within the original point cloud.
+  const BoundingBox bbox = pc->ComputeBoundingBox();
+  const BoundingBox coarse_bbox = out_pc.ComputeBoundingBox();
+  for (int c = 0; c < 3; ++c) {
+    ASSERT_GE(coarse_bbox.GetMinPoint()[c], bbox.GetMinPoint()[c] - 1e-3f);
+    ASSERT_LE(coarse_bbox.GetMaxPoint()[c], bbox.GetMaxPoint()[c] + 1e-3f);
+  }
+
+  // Refine the point cloud without decoding the first levels again.
+  const int num_coarse_points = out_pc.num_points();
+  DRACO_ASSERT_OK(decoder.DecodeMoreLevels(12, &dec_buffer));
+  ASSERT_EQ(decoder.num_decoded_levels(), 12);
+  ASSERT_GT(out_pc.num_points(), num_coarse_points);
+  DRACO_ASSERT_OK(decoder.DecodeMoreLevels(-1, &dec_buffer));
+  ASSERT_EQ(decoder.num_decoded_levels(), decoder.num_levels());
+  ComparePointClouds(*pc, out_pc);
+
+  // The regular decoder honors the maximum depth as well.
+  dec_buffer.Init(buffer.data(), buffer.size());
+  Decoder regular_decoder;
+  regular_decoder.SetKdTreeMaxDepth(4);
+  DRACO_ASSIGN_OR_ASSERT(
+      std::unique_ptr<PointCloud> regular_pc,
+      regular_decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ASSERT_EQ(regular_pc->num_points(), num_coarse_points);
+}
+
+TEST_F(PointCloudKdTreeEncodingTest,
+       TestKdTreeProgressiveDecodingSkipTransform) {
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("bun_zipper.ply");
+  ASSERT_NE(pc, nullptr);
+  EncoderBuffer buffer;
+  EncodeProgressive(*pc, &buffer);
+
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  DecoderOptions options;
+  options.SetAttributeBool(GeometryAttribute::POSITION,
+                           "skip_attribute_transform", true);
+  PointCloudKdTreeDecoder decoder;
+  PointCloud out_pc;
+  DRACO_ASSERT_OK(decoder.DecodeProgressive(options, 4, &dec_buffer, &out_pc));
+  const PointAttribute *pos_att =
+      out_pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  ASSERT_NE(pos_att, nullptr);
+  ASSERT_TRUE(pos_att->data_type() == DT_INT32 ||
+              pos_att->data_type() == DT_UINT32);
+  ASSERT_NE(pos_att->GetAttributeTransformData(), nullptr);
+
+  // The quantization data must be available after each refinement.
+  DRACO_ASSERT_OK(decoder.DecodeMoreLevels(12, &dec_buffer));
+  pos_att = out_pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  ASSERT_NE(pos_att->GetAttributeTransformData(), nullptr);
+  DRACO_ASSERT_OK(decoder.DecodeMoreLevels(-1, &dec_buffer));
+  pos_att = out_pc.GetNamedAttribute(GeometryAttribute::POSITION);
+  ASSERT_NE(pos_att->GetAttributeTransformData(), nullptr);
+  ASSERT_EQ(pos_att->GetAttributeTransformData()->transform_type(),
+            ATTRIBUTE_QUANTIZATION_TRANSFORM);
+
+  // The refined quantized values must match the values of regular decoding.
+  dec_buffer.Init(buffer.data(), buffer.size());
+  Decoder regular_decoder;
+  regular_decoder.SetSkipAttributeTransform(GeometryAttribute::POSITION);
+  DRACO_ASSIGN_OR_ASSERT(
+      std::unique_ptr<PointCloud> regular_pc,
+      regular_decoder.DecodePointCloudFromBuffer(&dec_buffer));
+  ComparePointClouds(*regular_pc, out_pc);
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeProgressivePartialData) {
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("bun_zipper.ply");
+  ASSERT_NE(pc, nullptr);
+  EncoderBuffer buffer;
+  EncodeProgressive(*pc, &buffer);
+
+  // Only a part of the data is available. The regular decoder fails.
+  const size_t num_received_bytes = buffer.size() / 2;
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), num_received_bytes);
+  Decoder regular_decoder;
+  ASSERT_FALSE(regular_decoder.DecodePointCloudFromBuffer(&dec_buffer).ok());
+
+  // The progressive decoder decodes all levels that were received.
+  dec_buffer.Init(buffer.data(), num_received_bytes);
+  PointCloudKdTreeDecoder decoder;
+  PointCloud out_pc;
+  DRACO_ASSERT_OK(
+      decoder.DecodeProgressive(DecoderOptions(), -1, &dec_buffer, &out_pc));
+  ASSERT_GT(decoder.num_decoded_levels(), 0);
+  ASSERT_LT(decoder.num_decoded_levels(), decoder.num_levels());
+  ASSERT_GT(out_pc.num_points(), 0);
+  ASSERT_LT(out_pc.num_points(), pc->num_points());
+
+  // Continue with the rest of the data.
+  const size_t num_consumed_bytes = dec_buffer.data_head() - buffer.data();
+  DecoderBuffer rest_buffer;
+  rest_buffer.Init(buffer.data() + num_consumed_bytes,
+                   buffer.size() - num_consumed_bytes);
+  DRACO_ASSERT_OK(decoder.DecodeMoreLevels(-1, &rest_buffer));
+  ASSERT_EQ(decoder.num_decoded_levels(), decoder.num_levels());
+  ComparePointClouds(*pc, out_pc);
+}
+
+TEST_F(PointCloudKdTreeEncodingTest, TestKdTreeProgressiveDecodingRestart) {
+  std::unique_ptr<PointCloud> pc =
+      ReadPointCloudFromTestFile("bun_zipper.ply");
+  ASSERT_NE(pc, nullptr);
+  EncoderBuffer buffer;
+  EncodeProgressive(*pc, &buffer);
+
+  // Truncated buffers that end within the header and right after it.
+  for (const size_t truncated_size : {size_t{4}, size_t{16}}) {
+    PointCloudKdTreeDecoder decoder;
+    PointCloud out_pc;
+    DecoderBuffer dec_buffer;
+    dec_buffer.Init(buffer.data(), buffer.size());
+    DRACO_ASSERT_OK(
+        decoder.DecodeProgressive(DecoderOptions(), 4, &dec_buffer, &out_pc));
+
+    // A failed restart must not leave the previous decoding in a state that
+    // can be continued.
+    DecoderBuffer truncated_buffer;
+    truncated_buffer.Init(buffer.data(), truncated_size);
+    ASSERT_FALSE(decoder
+                     .DecodeProgressive(DecoderOptions(), 4,
+                                        &truncated_buffer, &out_pc)
+                     .ok());
+    ASSERT_FALSE(decoder.DecodeMoreLevels(-1, &dec_buffer).ok());
+    ASSERT_EQ(decoder.num_levels(), 0);
+  }
+
+  // Regular decoding with the same decoder is not progressive.
+  PointCloudKdTreeDecoder decoder;
+  PointCloud out_pc;
+  DecoderBuffer dec_buffer;
+  dec_buffer.Init(buffer.data(), buffer.size());
+  DRACO_ASSERT_OK(
+      decoder.DecodeProgressive(DecoderOptions(), 4, &dec_buffer, &out_pc));
+  dec_buffer.Init(buffer.data(), buffer.size());
+  PointCloud regular_pc;
+  const DecoderOptions options;
+  DRACO_ASSERT_OK(decoder.Decode(options, &dec_buffer, &regular_pc));
+  ComparePointClouds(*pc, regular_pc);
+  ASSERT_FALSE(decoder.DecodeMoreLevels(-1, &dec_buffer).ok());
+}
+
 }  // namespace draco
@@ -0,0 +1,298 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/compression/vertex_buffer_layout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+#include "draco/attributes/attribute_octahedron_transform.h"
+#include "draco/attributes/attribute_quantization_transform.h"
+#include "draco/attributes/attribute_transform_kernels.h"
+#include "draco/compression/attributes/normal_compression_utils.h"
+#include "draco/core/quantization_utils.h"
+
+namespace draco {
+
+namespace {
+
+// Converts a floating point |value| to OutT. See VertexElement::normalized.
+template <typename OutT>
+OutT ConvertFloatComponent(float value, bool normalized) {
+  if (std::is_floating_point<OutT>::value) {
+    return static_cast<OutT>(value);
+  }
+  double out_value = value;
+  if (normalized) {
+    const double min_value = std::is_signed<OutT>::value ? -1.0 : 0.0;
+    out_value = std::max(min_value, std::min(1.0, out_value)) *
+                static_cast<double>(std::numeric_limits<OutT>::max());
+  }
+  // Round and clamp the value to the range of OutT. NaNs are mapped to the
+  // maximum value of OutT.
+  out_value = std::floor(out_value + 0.5);
+  out_value = std::max(
+      static_cast<double>(std::numeric_limits<OutT>::lowest()),
+      std::min(static_cast<double>(std::numeric_limits<OutT>::max()),
+               out_value));
+  return static_cast<OutT>(out_value);
+}
+
+// Number of points whose values are converted at once.
+constexpr int kBlockSize = 256;
+
+// Writes |num_points| values with |num_value_components| components each
+// stored in |values| into |element| of consecutive vertices starting at
+// |out_address|. Missing components are set to zero.
+template <typename OutT>
+void WriteFloatValues(const float *values, int num_points,
+                      int num_value_components, const VertexElement &element,
+                      int stride, uint8_t *out_address) {
+  // ValidateVertexBufferLayout() rejects elements with more than 4
+  // components.
+  const int num_components = std::min<int>(element.num_components, 4);
+  OutT out_value[4];
+  for (int i = 0; i < num_points; ++i) {
+    for (int c = 0; c < num_components; ++c) {
+      out_value[c] = ConvertFloatComponent<OutT>(
+          c < num_value_components ? values[c] : 0.f, element.normalized);
+    }
+    std::memcpy(out_address, out_value, sizeof(OutT) * num_components);
+    values += num_value_components;
+    out_address += stride;
+  }
+}
+
+// Writes the values of |att| for the first |num_points| points into
+// |element| of all vertices in |vertex_data|. The values are converted in
+// blocks of kBlockSize points using the bulk conversion functions.
+template <typename OutT>
+Status WriteVertexElement(const PointAttribute &att, int num_points,
+                          const VertexElement &element, int stride,
+                          uint8_t *vertex_data) {
+  const int num_components = element.num_components;
+  const size_t out_value_size = sizeof(OutT) * num_components;
+  uint8_t *out_address = vertex_data + element.offset;
+  const AttributeTransformData *const transform_data =
+      att.GetAttributeTransformData();
+
+  if (transform_data == nullptr) {
+    // Floating point values stored in integer elements use the conversion
+    // rules of the vertex element. All other values are converted directly.
+    const bool convert_floats =
+        (att.data_type() == DT_FLOAT32 || att.data_type() == DT_FLOAT64) &&
+        std::is_integral<OutT>::value;
+    if (!convert_floats && stride == static_cast<int>(out_value_size) &&
+        reinterpret_cast<uintptr_t>(out_address) % alignof(OutT) == 0) {
+      // The element values of all vertices are tightly packed.
+      if (!att.ConvertMappedValues(PointIndex(0), num_points, num_components,
+                                   reinterpret_cast<OutT *>(out_address))) {
+        return Status(Status::DRACO_ERROR, "Failed to convert values.");
+      }
+      return OkStatus();
+    }
+    std::vector<float> float_values;
+    std::vector<OutT> out_values;
+    if (convert_floats) {
+      float_values.resize(kBlockSize * num_components);
+    } else {
+      out_values.resize(kBlockSize * num_components);
+    }
+    for (int first = 0; first < num_points; first += kBlockSize) {
+      const int block_size = std::min(kBlockSize, num_points - first);
+      if (convert_floats) {
+        if (!att.ConvertMappedValues(PointIndex(first), block_size,
+                                     num_components, float_values.data())) {
+          return Status(Status::DRACO_ERROR, "Failed to convert values.");
+        }
+        WriteFloatValues<OutT>(float_values.data(), block_size,
+                               num_components, element, stride, out_address);
+        out_address += static_cast<size_t>(stride) * block_size;
+        continue;
+      }
+      if (!att.ConvertMappedValues(PointIndex(first), block_size,
+                                   num_components, out_values.data())) {
+        return Status(Status::DRACO_ERROR, "Failed to convert values.");
+      }
+      for (int i = 0; i < block_size; ++i) {
+        std::memcpy(out_address, out_values.data() + i * num_components,
+                    out_value_size);
+        out_address += stride;
+      }
+    }
+    return OkStatus();
+  }
+
+  // The attribute contains transformed values. Revert the transform and store
+  // the original values.
+  if (att.data_type() != DT_INT32 && att.data_type() != DT_UINT32) {
+    return Status(Status::DRACO_ERROR, "Invalid transformed attribute.");
+  }
+  const int num_att_components = att.num_components();
+  std::vector<int32_t> transformed_values(kBlockSize * num_att_components);
+  if (transform_data->transform_type() == ATTRIBUTE_QUANTIZATION_TRANSFORM) {
+    AttributeQuantizationTransform transform;
+    if (!transform.InitFromAttribute(att)) {
+      return Status(Status::DRACO_ERROR, "Invalid quantization transform.");
+    }
+    const int32_t max_quantized_value =
+        (1u << static_cast<uint32_t>(transform.quantization_bits())) - 1;
+    Dequantizer dequantizer;
+    if (!dequantizer.Init(transform.range(), max_quantized_value) ||
+        static_cast<int>(transform.min_values().size()) < num_att_components) {
+      return Status(Status::DRACO_ERROR, "Invalid quantization transform.");
+    }
+    const float delta = dequantizer.DequantizeFloat(1);
+    std::vector<float> values(kBlockSize * num_att_components);
+    for (int first = 0; first < num_points; first += kBlockSize) {
+      const int block_size = std::min(kBlockSize, num_points - first);
+      if (!att.ConvertMappedValues(PointIndex(first), block_size,
+                                   num_att_components,
+                                   transformed_values.data())) {
+        return Status(Status::DRACO_ERROR, "Invalid attribute value index.");
+      }
+      DequantizeFloatValues(transformed_values.data(), block_size,
+                            num_att_components, delta,
+                            transform.min_values().data(), values.data());
+      WriteFloatValues<OutT>(values.data(), block_size, num_att_components,
+                             element, stride, out_address);
+      out_address += static_cast<size_t>(stride) * block_size;
+    }
+    return OkStatus();
+  }
+  if (transform_data->transform_type() == ATTRIBUTE_OCTAHEDRON_TRANSFORM) {
+    AttributeOctahedronTransform transform;
+    OctahedronToolBox octahedron_tool_box;
+    if (!transform.InitFromAttribute(att) || num_att_components != 2 ||
+        !octahedron_tool_box.SetQuantizationBits(
+            transform.quantization_bits())) {
+      return Status(Status::DRACO_ERROR, "Invalid octahedron transform.");
+    }
+    std::vector<float> vectors(kBlockSize * 3);
+    for (int first = 0; first < num_points; first += kBlockSize) {
+      const int block_size = std::min(kBlockSize, num_points - first);
+      if (!att.ConvertMappedValues(PointIndex(first), block_size, 2,
+                                   transformed_values.data())) {
+        return Status(Status::DRACO_ERROR, "Invalid attribute value index.");
+      }
+      QuantizedOctahedralCoordsToUnitVectors(octahedron_tool_box,
+                                             transformed_values.data(),
+                                             block_size, vectors.data());
+      WriteFloatValues<OutT>(vectors.data(), block_size, 3, element, stride,
+                             out_address);
+      out_address += static_cast<size_t>(stride) * block_size;
+    }
+    return OkStatus();
+  }
+  return Status(Status::DRACO_ERROR, "Unsupported attribute transform.");
+}
+
+}  // namespace
+
+Status ValidateVertexBufferLayout(const Mesh &mesh,
+                                  const VertexBufferLayout &layout) {
+  for (const VertexElement &element : layout.elements) {
+    if (mesh.GetNamedAttribute(element.attribute_type,
+                               element.attribute_index) == nullptr) {
+      return Status(Status::DRACO_ERROR, "Missing vertex element attribute.");
+    }
+    switch (element.data_type) {
+      case DT_INT8:
+      case DT_UINT8:
+      case DT_INT16:
+      case DT_UINT16:
+      case DT_INT32:
+      case DT_UINT32:
+      case DT_FLOAT32:
+        break;
+      default:
+        return Status(Status::DRACO_ERROR,
+                      "Unsupported vertex element data type.");
+    }
+    if (element.num_components < 1 || element.num_components > 4 ||
+        element.offset < 0 ||
+        element.offset + element.num_components *
+                             DataTypeLength(element.data_type) >
+            layout.stride) {
+      return Status(Status::DRACO_ERROR, "Invalid vertex element.");
+    }
+  }
+  return OkStatus();
+}
+
+Status WriteMeshToVertexBuffer(const Mesh &mesh,
+                               const VertexBufferLayout &layout,
+                               uint8_t *vertex_data, uint32_t *indices) {
+  DRACO_RETURN_IF_ERROR(ValidateVertexBufferLayout(mesh, layout))
+  const int num_points = mesh.num_points();
+  if (num_points > 0 && !layout.elements.empty() && vertex_data == nullptr) {
+    return Status(Status::DRACO_ERROR, "Missing vertex data.");
+  }
+  for (const VertexElement &element : layout.elements) {
+    const PointAttribute *const att =
+        mesh.GetNamedAttribute(element.attribute_type, element.attribute_index);
+    Status status;
+    switch (element.data_type) {
+      case DT_INT8:
+        status = WriteVertexElement<int8_t>(*att, num_points, element,
+                                            layout.stride, vertex_data);
+        break;
+      case DT_UINT8:
+        status = WriteVertexElement<uint8_t>(*att, num_points, element,
+                                             layout.stride, vertex_data);
+        break;
+      case DT_INT16:
+        status = WriteVertexElement<int16_t>(*att, num_points, element,
+                                             layout.stride, vertex_data);
+        break;
+      case DT_UINT16:
+        status = WriteVertexElement<uint16_t>(*att, num_points, element,
+                                              layout.stride, vertex_data);
+        break;
+      case DT_INT32:
+        status = WriteVertexElement<int32_t>(*att, num_points, element,
+                                             layout.stride, vertex_data);
+        break;
+      case DT_UINT32:
+        status = WriteVertexElement<uint32_t>(*att, num_points, element,
+                                              layout.stride, vertex_data);
+        break;
+      case DT_FLOAT32:
+        status = WriteVertexElement<float>(*att, num_points, element,
+                                           layout.stride, vertex_data);
+        break;
+      default:
+        return Status(Status::DRACO_ERROR,
+                      "Unsupported vertex element data type.");
+    }
+    DRACO_RETURN_IF_ERROR(status)
+  }
+
+  if (indices != nullptr) {
+    for (FaceIndex fi(0); fi < mesh.num_faces(); ++fi) {
+      const Mesh::Face &face = mesh.face(fi);
+      for (int c = 0; c < 3; ++c) {
+        *indices++ = face[c].value();
+      }
+    }
+  }
+  return OkStatus();
+}
+
+}  // namespace draco
@@ -0,0 +1,100 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_COMPRESSION_VERTEX_BUFFER_LAYOUT_H_
+#define DRACO_COMPRESSION_VERTEX_BUFFER_LAYOUT_H_
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "draco/attributes/geometry_attribute.h"
+#include "draco/core/draco_types.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Element of an interleaved vertex buffer that stores values of one mesh
+// attribute.
+struct VertexElement {
+  VertexElement()
+      : attribute_type(GeometryAttribute::INVALID),
+        attribute_index(0),
+        data_type(DT_FLOAT32),
+        num_components(0),
+        normalized(false),
+        offset(0) {}
+
+  // The stored attribute given by its type and by its index among the
+  // attributes of the same type (see PointCloud::GetNamedAttribute()).
+  GeometryAttribute::Type attribute_type;
+  int attribute_index;
+
+  // Format of the stored values with 1 to 4 components. When the attribute has
+  // fewer components than |num_components|, the remaining components are set
+  // to zero. Supported types are 8, 16 and 32 bit integers and DT_FLOAT32.
+  DataType data_type;
+  int num_components;
+
+  // Used when floating point values (including dequantized values) are
+  // stored in an integer |data_type|. When true, the integer range
+  // represents values in range [0, 1] for unsigned types and [-1, 1] for
+  // signed types. Otherwise the values are rounded to the nearest integer.
+  // Integer attribute values are converted using
+  // GeometryAttribute::ConvertValue().
+  bool normalized;
+
+  // Offset of the element in bytes from the start of each vertex.
+  int offset;
+};
+
+// Description of an interleaved vertex buffer, such as a GPU staging buffer.
+struct VertexBufferLayout {
+  VertexBufferLayout() : stride(0) {}
+
+  std::vector<VertexElement> elements;
+
+  // Distance in bytes between the starts of two consecutive vertices.
+  int stride;
+};
+
+// Function that returns memory for the vertex and index buffers of a decoded
+// mesh once the size of the mesh is known. |out_vertex_data| must be able to
+// store |num_vertices| * VertexBufferLayout::stride bytes and |out_indices|
+// must be able to store 3 * |num_faces| indices. |out_indices| can be set to
+// nullptr when the indices are not needed.
+typedef std::function<Status(int num_vertices, int num_faces,
+                             uint8_t **out_vertex_data, uint32_t **out_indices)>
+    VertexBufferAllocator;
+
+// Returns an error when |layout| can't be used to store the points of |mesh|,
+// e.g., when any element refers to a missing attribute or when it does not fit
+// into the vertex stride.
+Status ValidateVertexBufferLayout(const Mesh &mesh,
+                                  const VertexBufferLayout &layout);
+
+// Writes all points of |mesh| into |vertex_data| laid out according to
+// |layout| and the point indices of all faces into |indices| (can be
+// nullptr). Attributes with quantization or octahedron transform data, such as
+// attributes decoded with the "skip_attribute_transform" option, are written
+// in their original format, i.e., the transforms are reverted directly into
+// |vertex_data|.
+Status WriteMeshToVertexBuffer(const Mesh &mesh,
+                               const VertexBufferLayout &layout,
+                               uint8_t *vertex_data, uint32_t *indices);
+
+}  // namespace draco
+
+#endif  // DRACO_COMPRESSION_VERTEX_BUFFER_LAYOUT_H_
@@ -62,6 +62,18 @@ class BoundingBox {
     Update(other.GetMaxPoint());
   }
 
+  // Returns true when this bounding box and the |other| bounding box share at
+  // least one point (touching boxes are considered to be intersecting).
+  bool Intersects(const BoundingBox &other) const {
+    for (int i = 0; i < 3; i++) {
+      if (other.GetMinPoint()[i] > max_point_[i] ||
+          other.GetMaxPoint()[i] < min_point_[i]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   // Returns the size of the bounding box along each axis.
   Vector3f Size() const { return max_point_ - min_point_; }
 
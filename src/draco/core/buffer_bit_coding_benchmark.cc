@@ -0,0 +1,89 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <utility>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+
+namespace draco {
+namespace {
+
+constexpr int kNumBenchmarkValues = 1 << 20;
+
+// Returns pseudo-random values of |num_bits| bits each. A |num_bits| of zero
+// generates a mix of 1 and 2 bit values that resembles the edgebreaker
+// symbol stream.
+std::vector<std::pair<uint32_t, int>> GenerateValues(int num_bits) {
+  std::vector<std::pair<uint32_t, int>> values(kNumBenchmarkValues);
+  uint32_t state = 0x5eed;
+  for (auto &value : values) {
+    state = state * 1664525 + 1013904223;
+    const int bits = num_bits > 0 ? num_bits : 1 + (state >> 31);
+    value.first = bits == 32 ? state : (state >> 7) & ((1u << bits) - 1);
+    value.second = bits;
+  }
+  return values;
+}
+
+void EncodeValues(const std::vector<std::pair<uint32_t, int>> &values,
+                  EncoderBuffer *buffer) {
+  buffer->Clear();
+  buffer->StartBitEncoding(static_cast<int64_t>(values.size()) * 32, false);
+  for (const auto &value : values) {
+    buffer->EncodeLeastSignificantBits32(value.second, value.first);
+  }
+  buffer->EndBitEncoding();
+}
+
+void BM_PutBits(benchmark::State &state) {
+  const std::vector<std::pair<uint32_t, int>> values =
+      GenerateValues(state.range(0));
+  EncoderBuffer buffer;
+  for (auto _ : state) {
+    EncodeValues(values, &buffer);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          values.size());
+}
+BENCHMARK(BM_PutBits)->Arg(0)->Arg(1)->Arg(8)->Arg(19)->Arg(32)->ArgName("bits");
+
+void BM_GetBits(benchmark::State &state) {
+  const std::vector<std::pair<uint32_t, int>> values =
+      GenerateValues(state.range(0));
+  EncoderBuffer encoded;
+  EncodeValues(values, &encoded);
+  for (auto _ : state) {
+    DecoderBuffer buffer;
+    buffer.Init(encoded.data(), encoded.size());
+    buffer.StartBitDecoding(false, nullptr);
+    uint32_t sum = 0;
+    for (const auto &value : values) {
+      uint32_t x;
+      buffer.DecodeLeastSignificantBits32(value.second, &x);
+      sum += x;
+    }
+    buffer.EndBitDecoding();
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          values.size());
+}
+BENCHMARK(BM_GetBits)->Arg(0)->Arg(1)->Arg(8)->Arg(19)->Arg(32)->ArgName("bits");
+
+}  // namespace
+}  // namespace draco
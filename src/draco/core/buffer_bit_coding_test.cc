@@ -12,6 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <utility>
+#include <vector>
+
 #include "draco/core/decoder_buffer.h"
 #include "draco/core/draco_test_base.h"
 #include "draco/core/encoder_buffer.h"
@@ -112,4 +115,52 @@ TEST_F(BufferBitCodingTest, TestMultipleBits) {
   }
 }
 
+TEST_F(BufferBitCodingTest, TestMixedBitLengths) {
+  // Encodes values of all bit lengths between 0 and 32 at all possible bit
+  // offsets and verifies that they are decoded back.
+  constexpr int buffer_size = 1024;
+  char buffer[buffer_size];
+  BitEncoder encoder(buffer);
+  std::vector<std::pair<uint32_t, int>> values;
+  uint32_t value = 0x12345678;
+  for (int i = 0; i < 200; ++i) {
+    const int num_bits = i % 33;
+    value = value * 1664525 + 1013904223;
+    const uint32_t masked_value =
+        num_bits == 32 ? value : value & ((1u << num_bits) - 1);
+    // Unused high bits of |value| must be ignored by the encoder.
+    encoder.PutBits(value, num_bits);
+    values.push_back(std::make_pair(masked_value, num_bits));
+  }
+
+  BitDecoder decoder;
+  decoder.reset(static_cast<const void *>(buffer), (encoder.Bits() + 7) / 8);
+  for (const auto &entry : values) {
+    uint32_t x = 0;
+    ASSERT_TRUE(decoder.GetBits(entry.second, &x));
+    ASSERT_EQ(x, entry.first);
+  }
+  ASSERT_EQ(encoder.Bits(), decoder.BitsDecoded());
+}
+
+TEST_F(BufferBitCodingTest, TestDecodingPastEnd) {
+  // Bits past the end of the buffer are decoded as zeros and the number of
+  // decoded bits never exceeds the size of the buffer.
+  const uint8_t data[] = {0xff, 0xff, 0xff};
+
+  BitDecoder decoder;
+  decoder.reset(static_cast<const void *>(data), sizeof(data));
+
+  uint32_t x = 0;
+  ASSERT_TRUE(decoder.GetBits(20, &x));
+  ASSERT_EQ(x, 0xfffffu);
+  ASSERT_TRUE(decoder.GetBits(8, &x));
+  ASSERT_EQ(x, 0xfu);
+  ASSERT_EQ(24u, decoder.BitsDecoded());
+  ASSERT_TRUE(decoder.GetBits(32, &x));
+  ASSERT_EQ(x, 0u);
+  ASSERT_EQ(24u, decoder.BitsDecoded());
+  ASSERT_FALSE(decoder.GetBits(33, &x));
+}
+
 }  // namespace draco
@@ -17,6 +17,8 @@
 
 #include <stdint.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
 #include <memory>
 
@@ -146,12 +148,7 @@ class DecoderBuffer {
     inline uint32_t EnsureBits(int k) {
       DRACO_DCHECK_LE(k, 24);
       DRACO_DCHECK_LE(static_cast<uint64_t>(k), AvailBits());
-
-      uint32_t buf = 0;
-      for (int i = 0; i < k; ++i) {
-        buf |= PeekBit(i) << i;
-      }
-      return buf;  // Okay to return extra bits
+      return static_cast<uint32_t>(PeekWord() & ((1u << k) - 1));
     }
 
     inline void ConsumeBits(int k) { bit_offset_ += k; }
@@ -161,38 +158,33 @@ class DecoderBuffer {
       if (nbits > 32) {
         return false;
       }
-      uint32_t value = 0;
-      for (uint32_t bit = 0; bit < nbits; ++bit) {
-        value |= GetBit() << bit;
-      }
-      *x = value;
+      const uint64_t mask = (static_cast<uint64_t>(1) << nbits) - 1;
+      *x = static_cast<uint32_t>(PeekWord() & mask);
+      // Bits past the end of the buffer are decoded as zeros and they do not
+      // advance the decoding position.
+      const size_t num_bits = (bit_buffer_end_ - bit_buffer_) * 8;
+      bit_offset_ = std::min(bit_offset_ + nbits, num_bits);
       return true;
     }
 
    private:
+    // Returns the bits starting at the current bit offset. At least 57 bits
+    // are valid and bits past the end of the buffer are set to zero. Whenever
+    // there are at least eight bytes left, the whole word is loaded with a
+    // single bounds check.
     // TODO(fgalligan): Add support for error reporting on range check.
-    // Returns one bit from the bit buffer.
-    inline int GetBit() {
-      const size_t off = bit_offset_;
-      const size_t byte_offset = off >> 3;
-      const int bit_shift = static_cast<int>(off & 0x7);
-      if (bit_buffer_ + byte_offset < bit_buffer_end_) {
-        const int bit = (bit_buffer_[byte_offset] >> bit_shift) & 1;
-        bit_offset_ = off + 1;
-        return bit;
-      }
-      return 0;
-    }
-
-    inline int PeekBit(int offset) {
-      const size_t off = bit_offset_ + offset;
-      const size_t byte_offset = off >> 3;
-      const int bit_shift = static_cast<int>(off & 0x7);
-      if (bit_buffer_ + byte_offset < bit_buffer_end_) {
-        const int bit = (bit_buffer_[byte_offset] >> bit_shift) & 1;
-        return bit;
+    inline uint64_t PeekWord() const {
+      const uint8_t *const src = bit_buffer_ + (bit_offset_ >> 3);
+      const int bit_shift = static_cast<int>(bit_offset_ & 0x7);
+      uint64_t word = 0;
+      if (bit_buffer_end_ - src >= static_cast<ptrdiff_t>(sizeof(word))) {
+        memcpy(&word, src, sizeof(word));
+      } else {
+        for (int i = 0; src + i < bit_buffer_end_; ++i) {
+          word |= static_cast<uint64_t>(src[i]) << (8 * i);
+        }
       }
-      return 0;
+      return word >> bit_shift;
     }
 
     const uint8_t *bit_buffer_;
@@ -0,0 +1,127 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/draco_benchmark_utils.h"
+
+#include <map>
+#include <memory>
+
+#include "draco/compression/encode.h"
+#include "draco/draco_features.h"
+#include "draco/io/mesh_io.h"
+#include "testing/draco_test_config.h"
+
+namespace draco {
+
+namespace {
+static constexpr char kBenchmarkDataDir[] = DRACO_TEST_DATA_DIR;
+
+// Quantization bits used by the benchmarks. The values cover the low, default
+// and high precision settings of the draco_encoder tool.
+static constexpr int kBenchmarkQuantizationBits[] = {8, 11, 14};
+}  // namespace
+
+std::string GetBenchmarkFileFullPath(const std::string &file_name) {
+  return std::string(kBenchmarkDataDir) + std::string("/") + file_name;
+}
+
+const std::vector<std::string> &GetBenchmarkMeshFileNames() {
+  static const std::vector<std::string> file_names = {
+    "bun_zipper.ply",
+    "car.drc",
+#ifdef DRACO_TRANSCODER_SUPPORTED
+    "CesiumMilkTruck/glTF/CesiumMilkTruck.gltf",
+    "Lantern/glTF/Lantern.gltf",
+#endif
+  };
+  return file_names;
+}
+
+const Mesh *GetBenchmarkMesh(int mesh_index) {
+  static std::map<int, std::unique_ptr<Mesh>> meshes;
+  const auto it = meshes.find(mesh_index);
+  if (it != meshes.end()) {
+    return it->second.get();
+  }
+  const std::vector<std::string> &file_names = GetBenchmarkMeshFileNames();
+  if (mesh_index < 0 || mesh_index >= static_cast<int>(file_names.size())) {
+    return nullptr;
+  }
+  auto statusor =
+      ReadMeshFromFile(GetBenchmarkFileFullPath(file_names[mesh_index]));
+  if (!statusor.ok()) {
+    return nullptr;
+  }
+  return (meshes[mesh_index] = std::move(statusor).value()).get();
+}
+
+int64_t GetMeshDataSize(const Mesh &mesh) {
+  int64_t size = static_cast<int64_t>(mesh.num_faces()) * sizeof(Mesh::Face);
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    size += mesh.attribute(i)->buffer()->data_size();
+  }
+  return size;
+}
+
+Status EncodeBenchmarkMesh(const Mesh &mesh, int speed, int quantization_bits,
+                           EncoderBuffer *out_buffer) {
+  Encoder encoder;
+  encoder.SetSpeedOptions(speed, speed);
+  encoder.SetAttributeQuantization(GeometryAttribute::POSITION,
+                                   quantization_bits);
+  encoder.SetAttributeQuantization(GeometryAttribute::NORMAL,
+                                   quantization_bits);
+  encoder.SetAttributeQuantization(GeometryAttribute::TEX_COORD,
+                                   quantization_bits);
+  encoder.SetAttributeQuantization(GeometryAttribute::COLOR,
+                                   quantization_bits);
+  encoder.SetAttributeQuantization(GeometryAttribute::GENERIC,
+                                   quantization_bits);
+  encoder.SetEncodingMethod(MESH_EDGEBREAKER_ENCODING);
+  out_buffer->Clear();
+  return encoder.EncodeMeshToBuffer(mesh, out_buffer);
+}
+
+void ApplyMeshSpeedQuantizationArgs(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"mesh", "speed", "qbits"});
+  const int num_meshes = static_cast<int>(GetBenchmarkMeshFileNames().size());
+  for (int mesh = 0; mesh < num_meshes; ++mesh) {
+    for (int speed = 0; speed <= 10; ++speed) {
+      for (const int bits : kBenchmarkQuantizationBits) {
+        b->Args({mesh, speed, bits});
+      }
+    }
+  }
+}
+
+void ApplyMeshSpeedArgs(benchmark::internal::Benchmark *b) {
+  b->ArgNames({"mesh", "speed"});
+  const int num_meshes = static_cast<int>(GetBenchmarkMeshFileNames().size());
+  for (int mesh = 0; mesh < num_meshes; ++mesh) {
+    for (int speed = 0; speed <= 10; ++speed) {
+      b->Args({mesh, speed});
+    }
+  }
+}
+
+void SetMeshThroughputCounters(const Mesh &mesh, int64_t bytes_per_iteration,
+                               benchmark::State &state) {
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          bytes_per_iteration);
+  state.counters["triangles"] = benchmark::Counter(
+      static_cast<double>(mesh.num_faces()),
+      benchmark::Counter::kIsIterationInvariantRate);
+}
+
+}  // namespace draco
@@ -0,0 +1,71 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_DRACO_BENCHMARK_UTILS_H_
+#define DRACO_CORE_DRACO_BENCHMARK_UTILS_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/core/status.h"
+#include "draco/mesh/mesh.h"
+
+namespace draco {
+
+// Benchmarks that run over the standard mesh inputs take their parameters in
+// the following order: index of the input mesh in
+// GetBenchmarkMeshFileNames(), encoding/decoding speed and quantization bits.
+constexpr int kBenchmarkMeshArg = 0;
+constexpr int kBenchmarkSpeedArg = 1;
+constexpr int kBenchmarkQuantizationArg = 2;
+
+std::string GetBenchmarkFileFullPath(const std::string &file_name);
+
+// Returns the testdata files that are used as inputs of the mesh benchmarks.
+const std::vector<std::string> &GetBenchmarkMeshFileNames();
+
+// Returns the mesh at |mesh_index| in GetBenchmarkMeshFileNames(). Meshes are
+// loaded only once and kept alive for the lifetime of the process so that the
+// loading time is not included in the measurements. Returns nullptr when the
+// mesh could not be loaded.
+const Mesh *GetBenchmarkMesh(int mesh_index);
+
+// Returns the size in bytes of the uncompressed geometry data of |mesh|, i.e.,
+// the size of all attribute values and of the triangle indices.
+int64_t GetMeshDataSize(const Mesh &mesh);
+
+// Encodes |mesh| with the edgebreaker method at the given |speed| while
+// quantizing all attributes to |quantization_bits|.
+Status EncodeBenchmarkMesh(const Mesh &mesh, int speed, int quantization_bits,
+                           EncoderBuffer *out_buffer);
+
+// Registers the product of all benchmark meshes, all speeds (0 - 10) and a
+// representative set of quantization bits as arguments of |b|.
+void ApplyMeshSpeedQuantizationArgs(benchmark::internal::Benchmark *b);
+
+// Same as above but without the quantization argument for benchmarks that do
+// not depend on attribute values.
+void ApplyMeshSpeedArgs(benchmark::internal::Benchmark *b);
+
+// Reports MB/s for |bytes_per_iteration| bytes and triangles/s for the faces of
+// |mesh| processed by each iteration of |state|.
+void SetMeshThroughputCounters(const Mesh &mesh, int64_t bytes_per_iteration,
+                               benchmark::State &state);
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_DRACO_BENCHMARK_UTILS_H_
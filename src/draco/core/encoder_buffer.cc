@@ -15,21 +15,48 @@
 #include "draco/core/encoder_buffer.h"
 
 #include <cstring>  // for memcpy
+#include <utility>
 
 #include "draco/core/varint_encoding.h"
 
 namespace draco {
 
 EncoderBuffer::EncoderBuffer()
-    : bit_encoder_reserved_bytes_(false), encode_bit_sequence_size_(false) {}
+    : bit_encoder_reserved_bytes_(false),
+      encode_bit_sequence_size_(false),
+      num_flushed_bytes_(0) {}
 
 void EncoderBuffer::Clear() {
   buffer_.clear();
   bit_encoder_reserved_bytes_ = 0;
+  num_flushed_bytes_ = 0;
 }
 
 void EncoderBuffer::Resize(int64_t nbytes) { buffer_.resize(nbytes); }
 
+void EncoderBuffer::SetOutputFunction(OutputFunction output_function) {
+  output_function_ = std::move(output_function);
+}
+
+bool EncoderBuffer::Flush() {
+  if (!output_function_) {
+    return true;
+  }
+  if (bit_encoder_active()) {
+    return false;
+  }
+  if (buffer_.empty()) {
+    return true;
+  }
+  if (!output_function_(buffer_.data(), buffer_.size())) {
+    return false;
+  }
+  num_flushed_bytes_ += buffer_.size();
+  // The capacity is kept so that the memory can be reused by the next section.
+  buffer_.clear();
+  return true;
+}
+
 bool EncoderBuffer::StartBitEncoding(int64_t required_bits, bool encode_size) {
   if (bit_encoder_active()) {
     return false;  // Bit encoding mode already active.
@@ -15,6 +15,7 @@
 #ifndef DRACO_CORE_ENCODER_BUFFER_H_
 #define DRACO_CORE_ENCODER_BUFFER_H_
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -26,12 +27,29 @@ namespace draco {
 // Class representing a buffer that can be used for either for byte-aligned
 // encoding of arbitrary data structures or for encoding of variable-length
 // bit data.
+// The buffer can optionally stream its content to an output function. In this
+// mode, the encoders periodically call Flush() to pass all data encoded so far
+// to the output, which limits the memory held by the buffer to the data
+// encoded since the last flush.
 class EncoderBuffer {
  public:
+  // Function that receives data flushed from the buffer. Returns false when the
+  // data could not be written.
+  typedef std::function<bool(const char *data, size_t size)> OutputFunction;
+
   EncoderBuffer();
   void Clear();
   void Resize(int64_t nbytes);
 
+  // Sets the function that receives the encoded data on each Flush() call.
+  void SetOutputFunction(OutputFunction output_function);
+
+  // Passes all data encoded since the previous flush to the output function
+  // and clears the buffer. Does nothing when no output function is set. Must
+  // not be called while a bit sequence is being encoded. Returns false on
+  // error.
+  bool Flush();
+
   // Start encoding a bit sequence. A maximum size of the sequence needs to
   // be known upfront.
   // If encode_size is true, the size of encoded bit sequence is stored before
@@ -79,6 +97,9 @@ class EncoderBuffer {
   size_t size() const { return buffer_.size(); }
   std::vector<char> *buffer() { return &buffer_; }
 
+  // Returns the number of bytes that were passed to the output function.
+  size_t num_flushed_bytes() const { return num_flushed_bytes_; }
+
  private:
   // Internal helper class to encode bits to a bit buffer.
   class BitEncoder {
@@ -86,13 +107,26 @@ class EncoderBuffer {
     // |data| is the buffer to write the bits into.
     explicit BitEncoder(char *data) : bit_buffer_(data), bit_offset_(0) {}
 
-    // Write |nbits| of |data| into the bit buffer.
+    // Write |nbits| of |data| into the bit buffer. The bits are merged with
+    // the partially filled byte at the current position and the remaining
+    // bytes are stored directly, instead of writing the value bit by bit.
     void PutBits(uint32_t data, int32_t nbits) {
       DRACO_DCHECK_GE(nbits, 0);
       DRACO_DCHECK_LE(nbits, 32);
-      for (int32_t bit = 0; bit < nbits; ++bit) {
-        PutBit((data >> bit) & 1);
+      if (nbits == 0) {
+        return;
+      }
+      const uint64_t off = static_cast<uint64_t>(bit_offset_);
+      uint8_t *const dst = reinterpret_cast<uint8_t *>(bit_buffer_) + off / 8;
+      const int bit_shift = off % 8;
+      const uint64_t mask = (static_cast<uint64_t>(1) << nbits) - 1;
+      uint64_t value = (static_cast<uint64_t>(data) & mask) << bit_shift;
+      value |= dst[0] & ((1 << bit_shift) - 1);
+      const int num_bytes = (bit_shift + nbits + 7) / 8;
+      for (int i = 0; i < num_bytes; ++i) {
+        dst[i] = static_cast<uint8_t>(value >> (8 * i));
       }
+      bit_offset_ += nbits;
     }
 
     // Return number of bits encoded so far.
@@ -109,21 +143,6 @@ class EncoderBuffer {
     }
 
    private:
-    void PutBit(uint8_t value) {
-      const int byte_size = 8;
-      const uint64_t off = static_cast<uint64_t>(bit_offset_);
-      const uint64_t byte_offset = off / byte_size;
-      const int bit_shift = off % byte_size;
-
-      // TODO(fgalligan): Check performance if we add a branch and only do one
-      // memory write if bit_shift is 7. Also try using a temporary variable to
-      // hold the bits before writing to the buffer.
-
-      bit_buffer_[byte_offset] &= ~(1 << bit_shift);
-      bit_buffer_[byte_offset] |= value << bit_shift;
-      bit_offset_++;
-    }
-
     char *bit_buffer_;
     size_t bit_offset_;
   };
@@ -145,6 +164,10 @@ class EncoderBuffer {
   // Flag used indicating that we need to store the length of the currently
   // processed bit sequence.
   bool encode_bit_sequence_size_;
+
+  // Optional function receiving the data on Flush().
+  OutputFunction output_function_;
+  size_t num_flushed_bytes_;
 };
 
 }  // namespace draco
@@ -0,0 +1,118 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_INDEX_HASH_SET_H_
+#define DRACO_CORE_INDEX_HASH_SET_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace draco {
+
+// Hash set of indices of keys that are stored outside of the set, such as
+// points of a point cloud identified by their attribute value indices. The
+// keys are accessed only through the |HashT| and |EqualT| functors that take
+// the stored indices as their arguments. The set uses open addressing with
+// linear probing in a single flat array of indices, so no memory is allocated
+// for individual entries.
+// IndexT is one of the draco index types (see draco_index_type.h). The
+// maximum value of the index type is reserved for empty slots.
+template <typename IndexT, typename HashT, typename EqualT>
+class IndexHashSet {
+ public:
+  // Creates a set that can store |expected_size| indices without growing.
+  IndexHashSet(size_t expected_size, HashT hash, EqualT equal)
+      : num_entries_(0), hash_(std::move(hash)), equal_(std::move(equal)) {
+    size_t num_slots = 16;
+    while (num_slots < 2 * expected_size) {
+      num_slots *= 2;
+    }
+    slots_.assign(num_slots, kEmptySlot);
+  }
+
+  // Returns the stored index whose key is equal to the key of |index|. If
+  // there is no such index, |index| is inserted into the set and returned.
+  IndexT FindOrInsert(IndexT index) {
+    if (2 * (num_entries_ + 1) > slots_.size()) {
+      Grow();
+    }
+    const size_t mask = slots_.size() - 1;
+    for (size_t slot = GetFirstSlot(index);; slot = (slot + 1) & mask) {
+      const IndexT stored_index = slots_[slot];
+      if (stored_index == kEmptySlot) {
+        slots_[slot] = index;
+        ++num_entries_;
+        return index;
+      }
+      if (equal_(stored_index, index)) {
+        return stored_index;
+      }
+    }
+  }
+
+  size_t size() const { return num_entries_; }
+
+ private:
+  static constexpr IndexT kEmptySlot =
+      IndexT(std::numeric_limits<typename IndexT::ValueType>::max());
+
+  size_t GetFirstSlot(IndexT index) const {
+    // Scramble the bits of the user hash to make sure that the slots are
+    // distributed evenly even for weak hash functions.
+    const uint64_t hash =
+        static_cast<uint64_t>(hash_(index)) * 0x9E3779B97F4A7C15ull;
+    return static_cast<size_t>(hash >> 32) & (slots_.size() - 1);
+  }
+
+  // Doubles the number of slots and re-inserts all stored indices.
+  void Grow() {
+    std::vector<IndexT> old_slots(slots_.size() * 2, kEmptySlot);
+    slots_.swap(old_slots);
+    const size_t mask = slots_.size() - 1;
+    for (const IndexT index : old_slots) {
+      if (index == kEmptySlot) {
+        continue;
+      }
+      size_t slot = GetFirstSlot(index);
+      while (slots_[slot] != kEmptySlot) {
+        slot = (slot + 1) & mask;
+      }
+      slots_[slot] = index;
+    }
+  }
+
+  std::vector<IndexT> slots_;
+  size_t num_entries_;
+  HashT hash_;
+  EqualT equal_;
+};
+
+template <typename IndexT, typename HashT, typename EqualT>
+constexpr IndexT IndexHashSet<IndexT, HashT, EqualT>::kEmptySlot;
+
+// Helper function for creating an IndexHashSet with deduced functor types.
+template <typename IndexT, typename HashT, typename EqualT>
+IndexHashSet<IndexT, HashT, EqualT> CreateIndexHashSet(size_t expected_size,
+                                                       HashT hash,
+                                                       EqualT equal) {
+  return IndexHashSet<IndexT, HashT, EqualT>(expected_size, std::move(hash),
+                                             std::move(equal));
+}
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_INDEX_HASH_SET_H_
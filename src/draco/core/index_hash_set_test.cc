@@ -0,0 +1,60 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/index_hash_set.h"
+
+#include <vector>
+
+#include "draco/attributes/geometry_indices.h"
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+TEST(IndexHashSetTest, TestFindOrInsert) {
+  // Keys with many duplicates. The set must return the first index of each
+  // key, also after it grows beyond its initial size.
+  std::vector<int> keys;
+  for (int i = 0; i < 1000; ++i) {
+    keys.push_back((i * 7) % 300);
+  }
+  auto hash = [&keys](draco::PointIndex pi) { return keys[pi.value()]; };
+  auto equal = [&keys](draco::PointIndex p0, draco::PointIndex p1) {
+    return keys[p0.value()] == keys[p1.value()];
+  };
+  auto set = draco::CreateIndexHashSet<draco::PointIndex>(0, hash, equal);
+  std::vector<int> first_index(300, -1);
+  for (int i = 0; i < static_cast<int>(keys.size()); ++i) {
+    if (first_index[keys[i]] == -1) {
+      first_index[keys[i]] = i;
+    }
+    ASSERT_EQ(set.FindOrInsert(draco::PointIndex(i)).value(),
+              first_index[keys[i]]);
+  }
+  ASSERT_EQ(set.size(), 300);
+}
+
+TEST(IndexHashSetTest, TestConstantHash) {
+  // All keys collide so the set must fall back to comparing the keys.
+  auto hash = [](draco::PointIndex) { return 0; };
+  auto equal = [](draco::PointIndex p0, draco::PointIndex p1) {
+    return p0.value() / 2 == p1.value() / 2;
+  };
+  auto set = draco::CreateIndexHashSet<draco::PointIndex>(10, hash, equal);
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_EQ(set.FindOrInsert(draco::PointIndex(i)).value(), i - i % 2);
+  }
+  ASSERT_EQ(set.size(), 50);
+}
+
+}  // namespace
@@ -0,0 +1,68 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef DRACO_CORE_THREAD_POOL_H_
+#define DRACO_CORE_THREAD_POOL_H_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace draco {
+
+// Simple pool of worker threads executing scheduled tasks in FIFO order.
+// A pool with less than two threads does not spawn any workers and it runs
+// each task directly in the Schedule() call, which allows callers to use the
+// same code path for both serial and parallel execution.
+class ThreadPool {
+ public:
+  explicit ThreadPool(int num_threads);
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  // Waits for all scheduled tasks to finish and joins the worker threads.
+  ~ThreadPool();
+
+  // Schedules |task| for execution on one of the worker threads.
+  void Schedule(std::function<void()> task);
+
+  // Blocks until all tasks scheduled so far are finished.
+  void Wait();
+
+  // Returns the number of threads that execute the scheduled tasks.
+  int num_threads() const {
+    return workers_.empty() ? 1 : static_cast<int>(workers_.size());
+  }
+
+ private:
+  void WorkerLoop();
+
+  std::vector<std::thread> workers_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  // Signaled when a new task is scheduled or when the pool is being destroyed.
+  std::condition_variable task_available_;
+  // Signaled when the last pending task is finished.
+  std::condition_variable tasks_finished_;
+  // Number of tasks that were scheduled but are not finished yet.
+  int num_pending_tasks_;
+  bool stopping_;
+};
+
+}  // namespace draco
+
+#endif  // DRACO_CORE_THREAD_POOL_H_
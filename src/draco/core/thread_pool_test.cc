@@ -0,0 +1,61 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/core/thread_pool.h"
+
+#include <atomic>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+
+namespace {
+
+TEST(ThreadPoolTest, TestAllTasksAreExecuted) {
+  for (const int num_threads : {0, 1, 2, 4}) {
+    draco::ThreadPool thread_pool(num_threads);
+    std::vector<int> values(100, 0);
+    for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+      thread_pool.Schedule([&values, i]() { values[i] = i + 1; });
+    }
+    thread_pool.Wait();
+    for (int i = 0; i < static_cast<int>(values.size()); ++i) {
+      ASSERT_EQ(values[i], i + 1);
+    }
+  }
+}
+
+TEST(ThreadPoolTest, TestWaitCanBeCalledRepeatedly) {
+  draco::ThreadPool thread_pool(3);
+  std::atomic<int> counter(0);
+  for (int round = 1; round <= 5; ++round) {
+    for (int i = 0; i < 10; ++i) {
+      thread_pool.Schedule([&counter]() { ++counter; });
+    }
+    thread_pool.Wait();
+    ASSERT_EQ(counter.load(), 10 * round);
+  }
+}
+
+TEST(ThreadPoolTest, TestDestructorFinishesScheduledTasks) {
+  std::atomic<int> counter(0);
+  {
+    draco::ThreadPool thread_pool(2);
+    for (int i = 0; i < 20; ++i) {
+      thread_pool.Schedule([&counter]() { ++counter; });
+    }
+  }
+  ASSERT_EQ(counter.load(), 20);
+}
+
+}  // namespace
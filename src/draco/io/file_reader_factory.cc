@@ -42,4 +42,16 @@ std::unique_ptr<FileReaderInterface> FileReaderFactory::OpenReader(
   return nullptr;
 }
 
+std::unique_ptr<FileReaderInterface> FileReaderFactory::OpenMappedReader(
+    const std::string &file_name) {
+  for (auto open_function : *GetFileReaderOpenFunctions()) {
+    auto reader = open_function(file_name);
+    if (reader == nullptr || reader->GetFileData() == nullptr) {
+      continue;
+    }
+    return reader;
+  }
+  return nullptr;
+}
+
 }  // namespace draco
@@ -27,6 +27,12 @@ class FileReaderFactory {
   // returned.
   static std::unique_ptr<FileReaderInterface> OpenReader(
       const std::string &file_name);
+
+  // Same as OpenReader() but skips readers that do not provide direct access to
+  // the file contents through FileReaderInterface::GetFileData(). Returns
+  // nullptr when no such reader is found for |file_name|.
+  static std::unique_ptr<FileReaderInterface> OpenMappedReader(
+      const std::string &file_name);
 };
 
 }  // namespace draco
@@ -81,5 +81,11 @@ TEST(FileReaderFactoryTest, OpenReader) {
   EXPECT_TRUE(reader->ReadFileToBuffer(buffer));
 }
 
+TEST(FileReaderFactoryTest, OpenMappedReader) {
+  // AlwaysOkFileReader does not provide direct access to the file data so it
+  // must be skipped.
+  EXPECT_EQ(FileReaderFactory::OpenMappedReader("fake file"), nullptr);
+}
+
 }  // namespace
 }  // namespace draco
@@ -25,6 +25,13 @@ class FileReaderInterface {
 
   // Returns the size of the file.
   virtual size_t GetFileSize() = 0;
+
+  // Returns a pointer to the entire contents of the input file when the reader
+  // can provide direct read-only access to them (e.g. through a memory
+  // mapping). The data is GetFileSize() bytes long and it stays valid for the
+  // lifetime of the reader. Returns nullptr when direct access is not
+  // supported, in which case ReadFileToBuffer() must be used instead.
+  virtual const char *GetFileData() { return nullptr; }
 };
 
 }  // namespace draco
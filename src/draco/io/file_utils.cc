@@ -94,6 +94,27 @@ bool ReadFileToBuffer(const std::string &file_name,
   return file_reader->ReadFileToBuffer(buffer);
 }
 
+bool ReadFileToDecoderBuffer(const std::string &file_name,
+                             std::unique_ptr<FileReaderInterface> *file_reader,
+                             std::vector<char> *file_data,
+                             DecoderBuffer *decoder_buffer) {
+  if (file_reader == nullptr || file_data == nullptr ||
+      decoder_buffer == nullptr) {
+    return false;
+  }
+  *file_reader = FileReaderFactory::OpenMappedReader(file_name);
+  if (*file_reader != nullptr) {
+    decoder_buffer->Init((*file_reader)->GetFileData(),
+                         (*file_reader)->GetFileSize());
+    return true;
+  }
+  if (!ReadFileToBuffer(file_name, file_data)) {
+    return false;
+  }
+  decoder_buffer->Init(file_data->data(), file_data->size());
+  return true;
+}
+
 bool ReadFileToString(const std::string &file_name, std::string *contents) {
   if (!contents) {
     return false;
@@ -133,6 +154,13 @@ bool WriteBufferToFile(const void *buffer, size_t buffer_size,
                            file_name);
 }
 
+void SetEncoderBufferOutput(FileWriterInterface *file_writer,
+                            EncoderBuffer *buffer) {
+  buffer->SetOutputFunction([file_writer](const char *data, size_t size) {
+    return file_writer->Write(data, size);
+  });
+}
+
 size_t GetFileSize(const std::string &file_name) {
   std::unique_ptr<FileReaderInterface> file_reader =
       FileReaderFactory::OpenReader(file_name);
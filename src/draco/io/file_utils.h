@@ -16,9 +16,15 @@
 #define DRACO_IO_FILE_UTILS_H_
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include "draco/core/decoder_buffer.h"
+#include "draco/core/encoder_buffer.h"
+#include "draco/io/file_reader_interface.h"
+#include "draco/io/file_writer_interface.h"
+
 namespace draco {
 
 // Splits full path to a file into a folder path + file name.
@@ -61,6 +67,18 @@ bool ReadFileToBuffer(const std::string &file_name, std::vector<char> *buffer);
 bool ReadFileToBuffer(const std::string &file_name,
                       std::vector<uint8_t> *buffer);
 
+// Convenience method. Uses draco::FileReaderFactory internally. Initializes
+// |decoder_buffer| with the contents of file referenced by |file_name|. When a
+// registered reader provides direct access to the file data (see
+// FileReaderInterface::GetFileData()), |decoder_buffer| wraps that data without
+// copying it and |file_reader| takes ownership of the reader. Otherwise the
+// file is read into |file_data|. Both |file_reader| and |file_data| must
+// outlive |decoder_buffer|. Returns true upon success.
+bool ReadFileToDecoderBuffer(const std::string &file_name,
+                             std::unique_ptr<FileReaderInterface> *file_reader,
+                             std::vector<char> *file_data,
+                             DecoderBuffer *decoder_buffer);
+
 // Convenience method for reading a file into a std::string. Reads contents
 // of file referenced by |file_name| into |contents| and returns true upon
 // success.
@@ -76,6 +94,12 @@ bool WriteBufferToFile(const unsigned char *buffer, size_t buffer_size,
 bool WriteBufferToFile(const void *buffer, size_t buffer_size,
                        const std::string &file_name);
 
+// Convenience method. Sets the output function of |buffer| so that all data
+// flushed from the buffer is written to |file_writer| (see
+// EncoderBuffer::SetOutputFunction()). |file_writer| must outlive |buffer|.
+void SetEncoderBufferOutput(FileWriterInterface *file_writer,
+                            EncoderBuffer *buffer);
+
 // Convenience method. Uses draco::FileReaderFactory internally. Returns size of
 // file referenced by |file_name|. Returns 0 when referenced file is empty or
 // does not exist.
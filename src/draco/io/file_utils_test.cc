@@ -14,10 +14,15 @@
 //
 #include "draco/io/file_utils.h"
 
+#include <cstring>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
+#include "draco/io/file_reader_test_common.h"
+#include "draco/io/file_writer_factory.h"
 
 namespace {
 
@@ -68,4 +73,58 @@ TEST(FileUtilsTest, GetFullPath) {
   ASSERT_EQ(draco::GetFullPath("xo.mtl", "xo.obj"), "xo.mtl");
 }
 
+TEST(FileUtilsTest, ReadFileToDecoderBuffer) {
+  // Tests that the decoder buffer exposes the whole file regardless of whether
+  // the data is mapped or copied.
+  const std::string file_name = draco::GetTestFileFullPath("car.drc");
+  std::vector<char> expected_data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(file_name, &expected_data));
+  ASSERT_EQ(expected_data.size(), draco::kFileSizeCarDrc);
+
+  std::unique_ptr<draco::FileReaderInterface> file_reader;
+  std::vector<char> file_data;
+  draco::DecoderBuffer buffer;
+  ASSERT_TRUE(draco::ReadFileToDecoderBuffer(file_name, &file_reader,
+                                             &file_data, &buffer));
+  ASSERT_EQ(buffer.remaining_size(), expected_data.size());
+  ASSERT_EQ(memcmp(buffer.data_head(), expected_data.data(),
+                   expected_data.size()),
+            0);
+  if (file_reader != nullptr) {
+    // No copy of the data should be made when the file is mapped.
+    ASSERT_TRUE(file_data.empty());
+    ASSERT_EQ(buffer.data_head(), file_reader->GetFileData());
+  }
+
+  ASSERT_FALSE(draco::ReadFileToDecoderBuffer("fake file", &file_reader,
+                                              &file_data, &buffer));
+}
+
+TEST(FileUtilsTest, SetEncoderBufferOutput) {
+  // Tests that data flushed from an encoder buffer is written to the file.
+  const std::string file_name =
+      draco::GetTestTempFileFullPath("encoder_buffer_output.bin");
+  std::unique_ptr<draco::FileWriterInterface> file_writer =
+      draco::FileWriterFactory::OpenWriter(file_name);
+  ASSERT_NE(file_writer, nullptr);
+
+  draco::EncoderBuffer buffer;
+  draco::SetEncoderBufferOutput(file_writer.get(), &buffer);
+  ASSERT_TRUE(buffer.Encode("DRACO", 5));
+  ASSERT_TRUE(buffer.Flush());
+  ASSERT_EQ(buffer.size(), 0);
+  ASSERT_TRUE(buffer.Encode(static_cast<uint32_t>(7)));
+  ASSERT_TRUE(buffer.Flush());
+  ASSERT_EQ(buffer.num_flushed_bytes(), 9);
+  file_writer.reset();
+
+  std::vector<char> file_data;
+  ASSERT_TRUE(draco::ReadFileToBuffer(file_name, &file_data));
+  ASSERT_EQ(file_data.size(), 9);
+  ASSERT_EQ(memcmp(file_data.data(), "DRACO", 5), 0);
+  uint32_t value;
+  memcpy(&value, file_data.data() + 5, sizeof(value));
+  ASSERT_EQ(value, 7);
+}
+
 }  // namespace
@@ -19,6 +19,10 @@ class FileWriterInterface {
 
   // Writes |size| bytes from |buffer| to file.
   virtual bool Write(const char *buffer, size_t size) = 0;
+
+  // Flushes all written data and closes the file. Returns false when the data
+  // could not be written. No data can be written after the file is closed.
+  virtual bool Close() { return true; }
 };
 
 }  // namespace draco
@@ -15,6 +15,7 @@
 #include "draco/io/gltf_decoder.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <map>
@@ -30,6 +31,7 @@
 #include "draco/core/hash_utils.h"
 #include "draco/core/status.h"
 #include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/texture_io.h"
 #include "draco/io/tiny_gltf_utils.h"
@@ -187,111 +189,166 @@ StatusOr<std::vector<uint32_t>> CopyDataAsUint32(
   return output;
 }
 
-// Specialization for arithmetic types.
-template <
-    typename TypeT,
-    typename std::enable_if<std::is_arithmetic<TypeT>::value>::type * = nullptr>
-StatusOr<std::vector<TypeT>> CopyDataAs(const tinygltf::Model &model,
-                                        const tinygltf::Accessor &accessor) {
-  if (std::is_same<TypeT, uint8_t>::value) {
+// Read-only view of the elements of a glTF accessor. The elements are read in
+// place from the buffer data of the model using the byte stride of the
+// accessor, so the accessor data does not need to be copied into a temporary
+// vector before it is added to a Draco builder. |TypeT| is either an
+// arithmetic type or draco::VectorD. The components are converted by copying
+// the bytes of each component into a zero initialized |TypeT| component.
+template <typename TypeT>
+class AccessorDataView {
+ public:
+  AccessorDataView()
+      : data_(nullptr), byte_stride_(0), component_size_(0), count_(0) {}
+  AccessorDataView(const uint8_t *data, int byte_stride, int component_size,
+                   int count)
+      : data_(data),
+        byte_stride_(byte_stride),
+        component_size_(component_size),
+        count_(count) {}
+
+  // Returns the element at |index|. |index| must be smaller than size().
+  TypeT operator[](int index) const {
+    return ReadElement(data_ + static_cast<size_t>(index) * byte_stride_,
+                       std::is_arithmetic<TypeT>());
+  }
+
+  int size() const { return count_; }
+
+ private:
+  TypeT ReadElement(const uint8_t *address,
+                    std::true_type /* is_arithmetic */) const {
+    TypeT value = 0;
+    memcpy(&value, address, component_size_);
+    return value;
+  }
+
+  TypeT ReadElement(const uint8_t *address,
+                    std::false_type /* is_arithmetic */) const {
+    TypeT values;
+    for (int c = 0; c < TypeT::dimension; ++c) {
+      typename TypeT::Scalar value = 0;
+      memcpy(&value, address + c * component_size_, component_size_);
+      values[c] = value;
+    }
+    return values;
+  }
+
+  const uint8_t *data_;
+  int byte_stride_;
+  int component_size_;
+  int count_;
+};
+
+// Component type and number of components of accessor elements of type
+// |TypeT|.
+template <typename TypeT, bool = std::is_arithmetic<TypeT>::value>
+struct AccessorElementTraits {
+  typedef TypeT ComponentType;
+  static constexpr int kNumComponents = 1;
+};
+
+template <typename TypeT>
+struct AccessorElementTraits<TypeT, false> {
+  typedef typename TypeT::Scalar ComponentType;
+  static constexpr int kNumComponents = TypeT::dimension;
+};
+
+// Returns a view of the data of |accessor| that reads the elements as
+// |TypeT|. The accessor is checked to fit into its buffer.
+template <typename TypeT>
+StatusOr<AccessorDataView<TypeT>> GetAccessorDataView(
+    const tinygltf::Model &model, const tinygltf::Accessor &accessor) {
+  typedef typename AccessorElementTraits<TypeT>::ComponentType ComponentT;
+  if (std::is_same<ComponentT, uint8_t>::value) {
     if (TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE != accessor.componentType) {
       return ErrorStatus("Accessor data cannot be converted to Uint8.");
     }
-  } else if (std::is_same<TypeT, uint16_t>::value) {
+  } else if (std::is_same<ComponentT, uint16_t>::value) {
     if (TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE != accessor.componentType &&
         TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT != accessor.componentType) {
       return ErrorStatus("Accessor data cannot be converted to Uint16.");
     }
-  } else if (std::is_same<TypeT, uint32_t>::value) {
+  } else if (std::is_same<ComponentT, uint32_t>::value) {
     if (TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE != accessor.componentType &&
         TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT != accessor.componentType &&
         TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT != accessor.componentType) {
       return ErrorStatus("Accessor data cannot be converted to Uint32.");
     }
-  } else if (std::is_same<TypeT, float>::value) {
+  } else if (std::is_same<ComponentT, float>::value) {
     if (TINYGLTF_COMPONENT_TYPE_FLOAT != accessor.componentType) {
       return ErrorStatus("Accessor data cannot be converted to Float.");
     }
   }
-  if (accessor.bufferView < 0) {
-    return Status(Status::DRACO_ERROR, "Error CopyDataAs() bufferView < 0.");
-  }
-
-  const tinygltf::BufferView &buffer_view =
-      model.bufferViews[accessor.bufferView];
-  if (buffer_view.buffer < 0) {
-    return Status(Status::DRACO_ERROR, "Error CopyDataAs() buffer < 0.");
-  }
-
-  const tinygltf::Buffer &buffer = model.buffers[buffer_view.buffer];
-
-  const uint8_t *const data_start =
-      buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
-  const int byte_stride = accessor.ByteStride(buffer_view);
-  const int component_size =
-      tinygltf::GetComponentSizeInBytes(accessor.componentType);
-
-  std::vector<TypeT> output;
-  output.resize(accessor.count);
-
-  const int num_components =
-      TinyGltfUtils::GetNumComponentsForType(accessor.type);
-  int out_index = 0;
-  const uint8_t *data = data_start;
-  for (int i = 0; i < accessor.count; ++i) {
-    for (int c = 0; c < num_components; ++c) {
-      TypeT value = 0;
-      memcpy(&value, data + (c * component_size), component_size);
-      output[out_index++] = value;
-    }
-    data += byte_stride;
-  }
-  return output;
-}
-
-// Specialization for remaining types is used for draco::VectorD.
-template <typename TypeT,
-          typename std::enable_if<!std::is_arithmetic<TypeT>::value>::type * =
-              nullptr>
-StatusOr<std::vector<TypeT>> CopyDataAs(const tinygltf::Model &model,
-                                        const tinygltf::Accessor &accessor) {
   const int num_components =
       TinyGltfUtils::GetNumComponentsForType(accessor.type);
-  if (num_components != TypeT::dimension) {
-    return Status(Status::DRACO_ERROR,
-                  "Dimension does not equal num components.");
+  if (num_components != AccessorElementTraits<TypeT>::kNumComponents) {
+    return ErrorStatus("Dimension does not equal num components.");
   }
   if (accessor.bufferView < 0) {
-    return Status(Status::DRACO_ERROR, "Error CopyDataAs() bufferView < 0.");
+    return ErrorStatus("Error GetAccessorDataView() bufferView < 0.");
   }
 
   const tinygltf::BufferView &buffer_view =
       model.bufferViews[accessor.bufferView];
   if (buffer_view.buffer < 0) {
-    return Status(Status::DRACO_ERROR, "Error CopyDataAs() buffer < 0.");
+    return ErrorStatus("Error GetAccessorDataView() buffer < 0.");
   }
 
   const tinygltf::Buffer &buffer = model.buffers[buffer_view.buffer];
-
-  const uint8_t *const data_start =
-      buffer.data.data() + buffer_view.byteOffset + accessor.byteOffset;
   const int byte_stride = accessor.ByteStride(buffer_view);
   const int component_size =
       tinygltf::GetComponentSizeInBytes(accessor.componentType);
+  if (byte_stride < 0 || component_size <= 0 ||
+      component_size > static_cast<int>(sizeof(ComponentT))) {
+    return ErrorStatus("Invalid accessor data layout.");
+  }
+  const size_t start_offset = buffer_view.byteOffset + accessor.byteOffset;
+  if (accessor.count > 0 &&
+      start_offset + (accessor.count - 1) * static_cast<size_t>(byte_stride) +
+              num_components * component_size >
+          buffer.data.size()) {
+    return ErrorStatus("Accessor data is out of buffer bounds.");
+  }
+  return AccessorDataView<TypeT>(buffer.data.data() + start_offset,
+                                 byte_stride, component_size,
+                                 static_cast<int>(accessor.count));
+}
+
+// View of texture coordinates of a glTF accessor that converts them to the
+// Draco convention when they are read. glTF stores texture coordinates flipped
+// on the horizontal axis compared to how Draco stores texture coordinates.
+class FlippedTexCoordDataView {
+ public:
+  explicit FlippedTexCoordDataView(const AccessorDataView<Vector2f> &view)
+      : view_(view) {}
+
+  Vector2f operator[](int index) const {
+    Vector2f uv = view_[index];
+    uv[1] = 1.0 - uv[1];
+    return uv;
+  }
 
-  std::vector<TypeT> output;
-  output.resize(accessor.count);
+  int size() const { return view_.size(); }
 
-  const uint8_t *data = data_start;
-  for (int i = 0; i < accessor.count; ++i) {
-    TypeT values;
-    for (int c = 0; c < num_components; ++c) {
-      memcpy(&values[c], data + (c * component_size), component_size);
-    }
-    output[i] = values;
-    data += byte_stride;
+ private:
+  AccessorDataView<Vector2f> view_;
+};
+
+// Returns an error if any of the primitive indices in |indices_data| does not
+// refer to an element of |accessor|. Attribute values are read directly from
+// the accessor data, so the indices must be checked before they are used.
+Status CheckAccessorIndices(const std::vector<uint32_t> &indices_data,
+                            const tinygltf::Accessor &accessor) {
+  if (indices_data.empty()) {
+    return OkStatus();
   }
-  return output;
+  const uint32_t max_index =
+      *std::max_element(indices_data.begin(), indices_data.end());
+  if (max_index >= accessor.count) {
+    return ErrorStatus("Primitive index is out of accessor bounds.");
+  }
+  return OkStatus();
 }
 
 // Copies the data referenced from |buffer_view_id| into |data|. Currently only
@@ -502,7 +559,27 @@ Status GltfDecoder::LoadFile(const std::string &file_name,
   loader.SetFsCallbacks(fs_callbacks);
 
   if (extension == "glb") {
-    if (!loader.LoadBinaryFromFile(&gltf_model_, &err, &warn, file_name)) {
+    // The glb file is parsed directly from the memory mapped file when
+    // possible, avoiding a copy of the whole file. Note that TinyGLTF still
+    // copies the BIN chunk into the first buffer of |gltf_model_|, which is
+    // where the accessor data views read from.
+    std::unique_ptr<FileReaderInterface> file_reader;
+    std::vector<char> file_data;
+    DecoderBuffer buffer;
+    if (!ReadFileToDecoderBuffer(file_name, &file_reader, &file_data,
+                                 &buffer)) {
+      return Status(Status::DRACO_ERROR, "Unable to read: " + file_name);
+    }
+    if (input_files) {
+      input_files->push_back(file_name);
+    }
+    std::string base_dir;
+    std::string glb_file_name;
+    SplitPath(file_name, &base_dir, &glb_file_name);
+    if (!loader.LoadBinaryFromMemory(
+            &gltf_model_, &err, &warn,
+            reinterpret_cast<const unsigned char *>(buffer.data_head()),
+            static_cast<unsigned int>(buffer.remaining_size()), base_dir)) {
       return Status(Status::DRACO_ERROR,
                     "TinyGLTF failed to load glb file: " + err);
     }
@@ -743,15 +820,16 @@ Status GltfDecoder::DecodePrimitive(const tinygltf::Primitive &primitive,
     if (att_id == -1) {
       continue;
     }
+    DRACO_RETURN_IF_ERROR(CheckAccessorIndices(indices_data, accessor));
 
     if (primitive.mode == TINYGLTF_MODE_TRIANGLES) {
       DRACO_RETURN_IF_ERROR(AddAttributeValuesToBuilder(
           attribute.first, accessor, indices_data, att_id, number_of_faces,
-          transform_matrix, &mb_));
+          transform_matrix, &feature_id_attribute_indices_, &mb_));
     } else {
       DRACO_RETURN_IF_ERROR(AddAttributeValuesToBuilder(
           attribute.first, accessor, indices_data, att_id, number_of_points,
-          transform_matrix, &pb_));
+          transform_matrix, &feature_id_attribute_indices_, &pb_));
     }
   }
 
@@ -923,6 +1001,7 @@ Status GltfDecoder::AddAttributeValuesToBuilder(
     const std::string &attribute_name, const tinygltf::Accessor &accessor,
     const std::vector<uint32_t> &indices_data, int att_id,
     int number_of_elements, const Eigen::Matrix4d &transform_matrix,
+    std::unordered_map<int, int> *feature_id_attribute_indices,
     BuilderT *builder) {
   const bool reverse_winding = Determinant(transform_matrix) < 0;
   if (attribute_name == "TEXCOORD_0" || attribute_name == "TEXCOORD_1") {
@@ -949,7 +1028,7 @@ Status GltfDecoder::AddAttributeValuesToBuilder(
     // Populate map from the index in attribute name like _FEATURE_ID_5 to the
     // attribute index in the builder.
     const int index = GetIndexFromFeatureIdAttributeName(attribute_name);
-    feature_id_attribute_indices_[index] = att_id;
+    (*feature_id_attribute_indices)[index] = att_id;
   } else if (attribute_name.rfind('_', 0) == 0) {
     // This is a structural metadata property attribute with a name like
     // _DIRECTION that begins with an underscore.
@@ -971,11 +1050,15 @@ Status GltfDecoder::AddTangentToBuilder(
     int number_of_elements, const Eigen::Matrix4d &transform_matrix,
     bool reverse_winding, BuilderT *builder) {
   DRACO_ASSIGN_OR_RETURN(
-      std::vector<Vector4f> data,
-      TinyGltfUtils::CopyDataAsFloat<Vector4f>(gltf_model_, accessor));
-
-  for (int v = 0; v < data.size(); ++v) {
-    Eigen::Vector4d vec4(data[v][0], data[v][1], data[v][2], 1);
+      const AccessorDataView<Vector4f> input,
+      GetAccessorDataView<Vector4f>(gltf_model_, accessor));
+
+  // The transformation is applied once per vertex rather than once per corner,
+  // so the transformed values are stored.
+  std::vector<Vector4f> data(input.size());
+  for (int v = 0; v < input.size(); ++v) {
+    const Vector4f value = input[v];
+    Eigen::Vector4d vec4(value[0], value[1], value[2], 1);
     vec4 = transform_matrix * vec4;
 
     // Normalize the data.
@@ -986,7 +1069,7 @@ Status GltfDecoder::AddTangentToBuilder(
     }
 
     // Add back the original w component.
-    vec4[3] = data[v][3];
+    vec4[3] = value[3];
     for (int i = 0; i < 4; ++i) {
       data[v][i] = vec4[i];
     }
@@ -1003,15 +1086,9 @@ Status GltfDecoder::AddTexCoordToBuilder(
     const std::vector<uint32_t> &indices_data, int att_id,
     int number_of_elements, bool reverse_winding, BuilderT *builder) {
   DRACO_ASSIGN_OR_RETURN(
-      std::vector<Vector2f> data,
-      TinyGltfUtils::CopyDataAsFloat<Vector2f>(gltf_model_, accessor));
-
-  // glTF stores texture coordinates flipped on the horizontal axis compared to
-  // how Draco stores texture coordinates.
-  for (auto &uv : data) {
-    uv[1] = 1.0 - uv[1];
-  }
-
+      const AccessorDataView<Vector2f> input,
+      GetAccessorDataView<Vector2f>(gltf_model_, accessor));
+  const FlippedTexCoordDataView data(input);
   SetValuesForBuilder<Vector2f>(indices_data, att_id, number_of_elements, data,
                                 reverse_winding, builder);
   return OkStatus();
@@ -1066,11 +1143,19 @@ Status GltfDecoder::AddTransformedDataToBuilder(
     int number_of_elements, const Eigen::Matrix4d &transform_matrix,
     bool normalize, bool reverse_winding, BuilderT *builder) {
   DRACO_ASSIGN_OR_RETURN(
-      std::vector<Vector3f> data,
-      TinyGltfUtils::CopyDataAsFloat<Vector3f>(gltf_model_, accessor));
+      const AccessorDataView<Vector3f> input,
+      GetAccessorDataView<Vector3f>(gltf_model_, accessor));
+  if (!normalize && transform_matrix == Eigen::Matrix4d::Identity()) {
+    // The values are not modified so they can be read in place.
+    SetValuesForBuilder<Vector3f>(indices_data, att_id, number_of_elements,
+                                  input, reverse_winding, builder);
+    return OkStatus();
+  }
 
-  for (int v = 0; v < data.size(); ++v) {
-    Eigen::Vector4d vec4(data[v][0], data[v][1], data[v][2], 1);
+  std::vector<Vector3f> data(input.size());
+  for (int v = 0; v < input.size(); ++v) {
+    const Vector3f value = input[v];
+    Eigen::Vector4d vec4(value[0], value[1], value[2], 1);
     vec4 = transform_matrix * vec4;
     Eigen::Vector3d vec3(vec4[0], vec4[1], vec4[2]);
     if (normalize) {
@@ -1086,35 +1171,33 @@ Status GltfDecoder::AddTransformedDataToBuilder(
   return OkStatus();
 }
 
-template <typename T>
+template <typename T, typename DataT>
 void GltfDecoder::SetValuesForBuilder(const std::vector<uint32_t> &indices_data,
                                       int att_id, int number_of_elements,
-                                      const std::vector<T> &data,
-                                      bool reverse_winding,
+                                      const DataT &data, bool reverse_winding,
                                       TriangleSoupMeshBuilder *builder) {
-  SetValuesPerFace(indices_data, att_id, number_of_elements, data,
-                   reverse_winding, builder);
+  SetValuesPerFace<T>(indices_data, att_id, number_of_elements, data,
+                      reverse_winding, builder);
 }
 
-template <typename T>
+template <typename T, typename DataT>
 void GltfDecoder::SetValuesForBuilder(const std::vector<uint32_t> &indices_data,
                                       int att_id, int number_of_elements,
-                                      const std::vector<T> &data,
-                                      bool reverse_winding,
+                                      const DataT &data, bool reverse_winding,
                                       PointCloudBuilder *builder) {
   for (int i = 0; i < number_of_elements; ++i) {
     const uint32_t v_id = indices_data[i];
     const PointIndex pi(v_id + next_point_id_);
+    const T value = data[v_id];
     builder->SetAttributeValueForPoint(att_id, pi,
-                                       GetDataContentAddress(data[v_id]));
+                                       GetDataContentAddress(value));
   }
 }
 
-template <typename T>
+template <typename T, typename DataT>
 void GltfDecoder::SetValuesPerFace(const std::vector<uint32_t> &indices_data,
                                    int att_id, int number_of_faces,
-                                   const std::vector<T> &data,
-                                   bool reverse_winding,
+                                   const DataT &data, bool reverse_winding,
                                    TriangleSoupMeshBuilder *mb) {
   for (int f = 0; f < number_of_faces; ++f) {
     const int base_corner = f * 3;
@@ -1125,10 +1208,13 @@ void GltfDecoder::SetValuesPerFace(const std::vector<uint32_t> &indices_data,
     const uint32_t v_prev_id = indices_data[base_corner + prev_offset];
 
     const FaceIndex face_index(f + next_face_id_);
+    const T value = data[v_id];
+    const T next_value = data[v_next_id];
+    const T prev_value = data[v_prev_id];
     mb->SetAttributeValuesForFace(att_id, face_index,
-                                  GetDataContentAddress(data[v_id]),
-                                  GetDataContentAddress(data[v_next_id]),
-                                  GetDataContentAddress(data[v_prev_id]));
+                                  GetDataContentAddress(value),
+                                  GetDataContentAddress(next_value),
+                                  GetDataContentAddress(prev_value));
   }
 }
 
@@ -1166,28 +1252,32 @@ Status GltfDecoder::AddAttributeDataByTypes(
     case TINYGLTF_TYPE_SCALAR:
       switch (accessor.componentType) {
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-          DRACO_ASSIGN_OR_RETURN(std::vector<uint8_t> data,
-                                 CopyDataAs<uint8_t>(gltf_model_, accessor));
+          DRACO_ASSIGN_OR_RETURN(
+              const AccessorDataView<uint8_t> data,
+              GetAccessorDataView<uint8_t>(gltf_model_, accessor));
           SetValuesForBuilder<uint8_t>(indices_data, att_id, number_of_elements,
                                        data, reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
-          DRACO_ASSIGN_OR_RETURN(std::vector<uint16_t> data,
-                                 CopyDataAs<uint16_t>(gltf_model_, accessor));
+          DRACO_ASSIGN_OR_RETURN(
+              const AccessorDataView<uint16_t> data,
+              GetAccessorDataView<uint16_t>(gltf_model_, accessor));
           SetValuesForBuilder<uint16_t>(indices_data, att_id,
                                         number_of_elements, data,
                                         reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_INT: {
-          DRACO_ASSIGN_OR_RETURN(std::vector<uint32_t> data,
-                                 CopyDataAs<uint32_t>(gltf_model_, accessor));
+          DRACO_ASSIGN_OR_RETURN(
+              const AccessorDataView<uint32_t> data,
+              GetAccessorDataView<uint32_t>(gltf_model_, accessor));
           SetValuesForBuilder<uint32_t>(indices_data, att_id,
                                         number_of_elements, data,
                                         reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_FLOAT: {
-          DRACO_ASSIGN_OR_RETURN(std::vector<float> data,
-                                 CopyDataAs<float>(gltf_model_, accessor));
+          DRACO_ASSIGN_OR_RETURN(
+              const AccessorDataView<float> data,
+              GetAccessorDataView<float>(gltf_model_, accessor));
           SetValuesForBuilder<float>(indices_data, att_id, number_of_elements,
                                      data, reverse_winding, builder);
         } break;
@@ -1198,24 +1288,25 @@ Status GltfDecoder::AddAttributeDataByTypes(
     case TINYGLTF_TYPE_VEC2:
       switch (accessor.componentType) {
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-          DRACO_ASSIGN_OR_RETURN(std::vector<Vector2u8i> data,
-                                 CopyDataAs<Vector2u8i>(gltf_model_, accessor));
+          DRACO_ASSIGN_OR_RETURN(
+              const AccessorDataView<Vector2u8i> data,
+              GetAccessorDataView<Vector2u8i>(gltf_model_, accessor));
           SetValuesForBuilder<Vector2u8i>(indices_data, att_id,
                                           number_of_elements, data,
                                           reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
           DRACO_ASSIGN_OR_RETURN(
-              std::vector<Vector2u16i> data,
-              CopyDataAs<Vector2u16i>(gltf_model_, accessor));
+              const AccessorDataView<Vector2u16i> data,
+              GetAccessorDataView<Vector2u16i>(gltf_model_, accessor));
           SetValuesForBuilder<Vector2u16i>(indices_data, att_id,
                                            number_of_elements, data,
                                            reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_FLOAT: {
           DRACO_ASSIGN_OR_RETURN(
-              std::vector<Vector2f> data,
-              TinyGltfUtils::CopyDataAsFloat<Vector2f>(gltf_model_, accessor));
+              const AccessorDataView<Vector2f> data,
+              GetAccessorDataView<Vector2f>(gltf_model_, accessor));
           SetValuesForBuilder<Vector2f>(indices_data, att_id,
                                         number_of_elements, data,
                                         reverse_winding, builder);
@@ -1228,24 +1319,25 @@ Status GltfDecoder::AddAttributeDataByTypes(
     case TINYGLTF_TYPE_VEC3:
       switch (accessor.componentType) {
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-          DRACO_ASSIGN_OR_RETURN(std::vector<Vector3u8i> data,
-                                 CopyDataAs<Vector3u8i>(gltf_model_, accessor));
+          DRACO_ASSIGN_OR_RETURN(
+              const AccessorDataView<Vector3u8i> data,
+              GetAccessorDataView<Vector3u8i>(gltf_model_, accessor));
           SetValuesForBuilder<Vector3u8i>(indices_data, att_id,
                                           number_of_elements, data,
                                           reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
           DRACO_ASSIGN_OR_RETURN(
-              std::vector<Vector3u16i> data,
-              CopyDataAs<Vector3u16i>(gltf_model_, accessor));
+              const AccessorDataView<Vector3u16i> data,
+              GetAccessorDataView<Vector3u16i>(gltf_model_, accessor));
           SetValuesForBuilder<Vector3u16i>(indices_data, att_id,
                                            number_of_elements, data,
                                            reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_FLOAT: {
           DRACO_ASSIGN_OR_RETURN(
-              std::vector<Vector3f> data,
-              TinyGltfUtils::CopyDataAsFloat<Vector3f>(gltf_model_, accessor));
+              const AccessorDataView<Vector3f> data,
+              GetAccessorDataView<Vector3f>(gltf_model_, accessor));
           SetValuesForBuilder<Vector3f>(indices_data, att_id,
                                         number_of_elements, data,
                                         reverse_winding, builder);
@@ -1258,24 +1350,25 @@ Status GltfDecoder::AddAttributeDataByTypes(
     case TINYGLTF_TYPE_VEC4:
       switch (accessor.componentType) {
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE: {
-          DRACO_ASSIGN_OR_RETURN(std::vector<Vector4u8i> data,
-                                 CopyDataAs<Vector4u8i>(gltf_model_, accessor));
+          DRACO_ASSIGN_OR_RETURN(
+              const AccessorDataView<Vector4u8i> data,
+              GetAccessorDataView<Vector4u8i>(gltf_model_, accessor));
           SetValuesForBuilder<Vector4u8i>(indices_data, att_id,
                                           number_of_elements, data,
                                           reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT: {
           DRACO_ASSIGN_OR_RETURN(
-              std::vector<Vector4u16i> data,
-              CopyDataAs<Vector4u16i>(gltf_model_, accessor));
+              const AccessorDataView<Vector4u16i> data,
+              GetAccessorDataView<Vector4u16i>(gltf_model_, accessor));
           SetValuesForBuilder<Vector4u16i>(indices_data, att_id,
                                            number_of_elements, data,
                                            reverse_winding, builder);
         } break;
         case TINYGLTF_COMPONENT_TYPE_FLOAT: {
           DRACO_ASSIGN_OR_RETURN(
-              std::vector<Vector4f> data,
-              TinyGltfUtils::CopyDataAsFloat<Vector4f>(gltf_model_, accessor));
+              const AccessorDataView<Vector4f> data,
+              GetAccessorDataView<Vector4f>(gltf_model_, accessor));
           SetValuesForBuilder<Vector4f>(indices_data, att_id,
                                         number_of_elements, data,
                                         reverse_winding, builder);
@@ -1478,6 +1571,7 @@ Status GltfDecoder::DecodeGltfToScene() {
       scene_->AddRootNodeIndex(gltf_node_to_scenenode_index_[scene.nodes[i]]);
     }
   }
+  DRACO_RETURN_IF_ERROR(DecodePrimitiveMeshesForScene());
 
   DRACO_RETURN_IF_ERROR(AddAnimationsToScene());
   DRACO_RETURN_IF_ERROR(AddMaterialsToScene());
@@ -2001,6 +2095,63 @@ Status GltfDecoder::DecodePrimitiveForScene(
     return OkStatus();
   }
 
+  // The Draco mesh is built later by DecodePrimitiveMeshesForScene(), which
+  // adds the meshes to the scene in the order in which they are requested
+  // here. The index of the mesh is therefore already known.
+  const MeshIndex mesh_index(scene_->NumMeshes() +
+                             static_cast<int>(primitive_meshes_.size()));
+  primitive_meshes_.emplace_back();
+  primitive_meshes_.back().primitive = &primitive;
+  mesh_group->AddMeshInstance({mesh_index, primitive.material, mappings});
+
+  gltf_primitive_to_draco_mesh_index_[signature] = mesh_index;
+  return OkStatus();
+}
+
+Status GltfDecoder::DecodePrimitiveMeshesForScene() {
+  // Build the meshes of all primitives. The meshes are independent of each
+  // other so they can be built concurrently.
+  {
+    ThreadPool thread_pool(
+        std::min(num_decoding_threads_,
+                 static_cast<int>(primitive_meshes_.size())));
+    for (PrimitiveMesh &primitive_mesh : primitive_meshes_) {
+      PrimitiveMesh *const primitive_mesh_ptr = &primitive_mesh;
+      thread_pool.Schedule([this, primitive_mesh_ptr]() {
+        auto mesh_or = DecodePrimitiveMesh(
+            *primitive_mesh_ptr->primitive,
+            &primitive_mesh_ptr->feature_id_attribute_indices);
+        if (!mesh_or.ok()) {
+          primitive_mesh_ptr->status = mesh_or.status();
+          return;
+        }
+        primitive_mesh_ptr->mesh = std::move(mesh_or).value();
+      });
+    }
+    thread_pool.Wait();
+  }
+
+  // Decode the primitive extensions and add the meshes to the scene in the
+  // original order of the primitives.
+  for (PrimitiveMesh &primitive_mesh : primitive_meshes_) {
+    DRACO_RETURN_IF_ERROR(primitive_mesh.status);
+    feature_id_attribute_indices_ =
+        std::move(primitive_mesh.feature_id_attribute_indices);
+    DRACO_RETURN_IF_ERROR(AddPrimitiveExtensionsToDracoMesh(
+        *primitive_mesh.primitive,
+        &scene_->GetMaterialLibrary().MutableTextureLibrary(),
+        primitive_mesh.mesh.get()));
+    if (scene_->AddMesh(std::move(primitive_mesh.mesh)) == kInvalidMeshIndex) {
+      return Status(Status::DRACO_ERROR, "Could not add Draco mesh to scene.");
+    }
+  }
+  primitive_meshes_.clear();
+  return OkStatus();
+}
+
+StatusOr<std::unique_ptr<Mesh>> GltfDecoder::DecodePrimitiveMesh(
+    const tinygltf::Primitive &primitive,
+    std::unordered_map<int, int> *feature_id_attribute_indices) {
   // Handle indices first.
   DRACO_ASSIGN_OR_RETURN(const std::vector<uint32_t> indices_data,
                          DecodePrimitiveIndices(primitive));
@@ -2016,9 +2167,6 @@ Status GltfDecoder::DecodePrimitiveForScene(
     pb.Start(number_of_points);
   }
 
-  // Clear attribute indices before populating attributes in |mb| or |pb|.
-  feature_id_attribute_indices_.clear();
-
   std::set<int32_t> normalized_attributes;
   for (const auto &attribute : primitive.attributes) {
     if (attribute.second >= gltf_model_.accessors.size()) {
@@ -2043,20 +2191,19 @@ Status GltfDecoder::DecodePrimitiveForScene(
     if (normalized) {
       normalized_attributes.insert(att_id);
     }
+    DRACO_RETURN_IF_ERROR(CheckAccessorIndices(indices_data, accessor));
 
     if (primitive.mode == TINYGLTF_MODE_TRIANGLES) {
       DRACO_RETURN_IF_ERROR(AddAttributeValuesToBuilder(
           attribute.first, accessor, indices_data, att_id, number_of_faces,
-          Eigen::Matrix4d::Identity(), &mb));
+          Eigen::Matrix4d::Identity(), feature_id_attribute_indices, &mb));
     } else {
       DRACO_RETURN_IF_ERROR(AddAttributeValuesToBuilder(
           attribute.first, accessor, indices_data, att_id, number_of_points,
-          Eigen::Matrix4d::Identity(), &pb));
+          Eigen::Matrix4d::Identity(), feature_id_attribute_indices, &pb));
     }
   }
 
-  int material_index = primitive.material;
-
   DRACO_ASSIGN_OR_RETURN(
       std::unique_ptr<Mesh> mesh,
       BuildMeshFromBuilder(primitive.mode == TINYGLTF_MODE_TRIANGLES, &mb, &pb,
@@ -2066,20 +2213,7 @@ Status GltfDecoder::DecodePrimitiveForScene(
   for (const int32_t att_id : normalized_attributes) {
     mesh->attribute(att_id)->set_normalized(true);
   }
-
-  // Decode extensions present in this primitive.
-  DRACO_RETURN_IF_ERROR(AddPrimitiveExtensionsToDracoMesh(
-      primitive, &scene_->GetMaterialLibrary().MutableTextureLibrary(),
-      mesh.get()));
-
-  const MeshIndex mesh_index = scene_->AddMesh(std::move(mesh));
-  if (mesh_index == kInvalidMeshIndex) {
-    return Status(Status::DRACO_ERROR, "Could not add Draco mesh to scene.");
-  }
-  mesh_group->AddMeshInstance({mesh_index, material_index, mappings});
-
-  gltf_primitive_to_draco_mesh_index_[signature] = mesh_index;
-  return OkStatus();
+  return mesh;
 }
 
 Status GltfDecoder::DecodeMaterialsVariantsMappings(
@@ -83,6 +83,13 @@ class GltfDecoder {
     deduplicate_vertices_ = deduplicate_vertices;
   }
 
+  // Sets the maximum number of threads used for building the meshes of the
+  // glTF primitives when decoding a scene. The decoded scene does not depend
+  // on the number of threads. Default is 1.
+  void SetNumDecodingThreads(int num_threads) {
+    num_decoding_threads_ = num_threads;
+  }
+
  private:
   // Loads |file_name| into |gltf_model_|. Fills |input_files| with paths to all
   // input files when non-null.
@@ -155,13 +162,16 @@ class GltfDecoder {
   Status AddAttributesToDracoMesh(BuilderT *builder);
 
   // Copies attribute data from |accessor| and adds it to a Draco mesh using the
-  // geometry builder |builder|.
+  // geometry builder |builder|. Indices of feature ID attributes are stored in
+  // |feature_id_attribute_indices|.
   template <typename BuilderT>
   Status AddAttributeValuesToBuilder(const std::string &attribute_name,
                                      const tinygltf::Accessor &accessor,
                                      const std::vector<uint32_t> &indices_data,
                                      int att_id, int number_of_elements,
                                      const Eigen::Matrix4d &transform_matrix,
+                                     std::unordered_map<int, int>
+                                         *feature_id_attribute_indices,
                                      BuilderT *builder);
 
   // Copies the tangent attribute data from |accessor| and adds it to a Draco
@@ -232,16 +242,18 @@ class GltfDecoder {
                                      bool normalize, bool reverse_winding,
                                      BuilderT *builder);
 
-  // Sets values in |data| into the builder |builder| for |att_id|.
-  template <typename T>
+  // Sets values in |data| into the builder |builder| for |att_id|. |data| is
+  // any container that returns values of type |T| from operator[], such as
+  // std::vector<T> or a view of the accessor data.
+  template <typename T, typename DataT>
   void SetValuesForBuilder(const std::vector<uint32_t> &indices_data,
                            int att_id, int number_of_elements,
-                           const std::vector<T> &data, bool reverse_winding,
+                           const DataT &data, bool reverse_winding,
                            TriangleSoupMeshBuilder *builder);
-  template <typename T>
+  template <typename T, typename DataT>
   void SetValuesForBuilder(const std::vector<uint32_t> &indices_data,
                            int att_id, int number_of_elements,
-                           const std::vector<T> &data, bool reverse_winding,
+                           const DataT &data, bool reverse_winding,
                            PointCloudBuilder *builder);
 
   // Sets colors of for all vertices to white.
@@ -256,9 +268,9 @@ class GltfDecoder {
 
   // Sets values in |data| into the mesh builder |mb| for |att_id|.
   // |reverse_winding| if set will change the orientation of the data.
-  template <typename T>
+  template <typename T, typename DataT>
   void SetValuesPerFace(const std::vector<uint32_t> &indices_data, int att_id,
-                        int number_of_faces, const std::vector<T> &data,
+                        int number_of_faces, const DataT &data,
                         bool reverse_winding, TriangleSoupMeshBuilder *mb);
 
   // Returns an address pointing to the content stored in |data|. This is used
@@ -329,10 +341,24 @@ class GltfDecoder {
   // before this function is called.
   Status DecodeNodeForScene(int node_index, SceneNodeIndex parent_index);
 
-  // Decode glTF primitive into a Draco scene.
+  // Decode glTF primitive into a Draco scene. The Draco mesh of a primitive
+  // that was not decoded yet is only requested here and it is built by
+  // DecodePrimitiveMeshesForScene().
   Status DecodePrimitiveForScene(const tinygltf::Primitive &primitive,
                                  MeshGroup *mesh_group);
 
+  // Builds the meshes requested by DecodePrimitiveForScene() on up to
+  // |num_decoding_threads_| threads and adds them to the scene.
+  Status DecodePrimitiveMeshesForScene();
+
+  // Builds a Draco mesh from the geometry of |primitive|. Indices of feature
+  // ID attributes are stored in |feature_id_attribute_indices|. The function
+  // only reads the decoder state, so it can be called concurrently for
+  // different primitives.
+  StatusOr<std::unique_ptr<Mesh>> DecodePrimitiveMesh(
+      const tinygltf::Primitive &primitive,
+      std::unordered_map<int, int> *feature_id_attribute_indices);
+
   // Decodes glTF materials variants from |extension| and adds it into materials
   // variants |mappings|. Before calling this function, all materials variants
   // names must be decoded by calling AddMaterialsVariantsNamesToScene().
@@ -577,6 +603,20 @@ class GltfDecoder {
   // Whether vertices should be deduplicated after loading.
   bool deduplicate_vertices_ = true;
 
+  // Maximum number of threads used for building the meshes of a scene.
+  int num_decoding_threads_ = 1;
+
+  // Mesh of a glTF primitive that is built by DecodePrimitiveMeshesForScene().
+  struct PrimitiveMesh {
+    const tinygltf::Primitive *primitive = nullptr;
+    Status status;
+    std::unique_ptr<Mesh> mesh;
+    std::unordered_map<int, int> feature_id_attribute_indices;
+  };
+
+  // Primitive meshes in the order in which they are added to the scene.
+  std::vector<PrimitiveMesh> primitive_meshes_;
+
   // Functionality for deduping primitives on decode.
   struct PrimitiveSignature {
     const tinygltf::Primitive &primitive;
@@ -16,6 +16,7 @@
 
 #include <array>
 #include <cmath>
+#include <cstring>
 #include <iostream>
 #include <limits>
 #include <memory>
@@ -36,6 +37,7 @@
 #include "draco/io/texture_io.h"
 #include "draco/mesh/mesh_are_equivalent.h"
 #include "draco/mesh/mesh_utils.h"
+#include "draco/scene/scene_are_equivalent.h"
 #include "draco/scene/scene_indices.h"
 #include "draco/scene/scene_utils.h"
 #include "draco/texture/texture_utils.h"
@@ -1077,6 +1079,82 @@ TEST(GltfDecoderTest, SimpleSkin) {
   ASSERT_EQ(weights, expected_weights);
 }
 
+TEST(GltfDecoderTest, InterleavedAndStridedAccessors) {
+  // Positions, joints, and weights of the test quad are interleaved in one
+  // buffer view with a byte stride of 36. Colors are stored in another buffer
+  // view with a byte stride of 8, where the last four bytes of each element
+  // are padding filled with garbage.
+  const std::string file_name =
+      "InterleavedAccessors/InterleavedAccessors.gltf";
+  const std::unique_ptr<Mesh> mesh(DecodeGltfFile(file_name));
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_EQ(mesh->num_faces(), 2);
+  ASSERT_EQ(mesh->num_points(), 4);
+
+  const PointAttribute *const pos_att =
+      mesh->GetNamedAttribute(GeometryAttribute::POSITION);
+  const PointAttribute *const joints_att =
+      mesh->GetNamedAttribute(GeometryAttribute::JOINTS);
+  const PointAttribute *const weights_att =
+      mesh->GetNamedAttribute(GeometryAttribute::WEIGHTS);
+  const PointAttribute *const color_att =
+      mesh->GetNamedAttribute(GeometryAttribute::COLOR);
+  ASSERT_NE(pos_att, nullptr);
+  ASSERT_NE(joints_att, nullptr);
+  ASSERT_NE(weights_att, nullptr);
+  ASSERT_NE(color_att, nullptr);
+  ASSERT_EQ(joints_att->data_type(), DT_UINT16);
+  ASSERT_EQ(weights_att->data_type(), DT_FLOAT32);
+  ASSERT_EQ(color_att->data_type(), DT_UINT8);
+  ASSERT_EQ(color_att->num_components(), 4);
+
+  // clang-format off
+  const std::array<Vector3f, 4> expected_positions = {
+      Vector3f(0.f, 0.f, 0.f), Vector3f(1.f, 0.f, 0.f),
+      Vector3f(1.f, 1.f, 0.f), Vector3f(0.f, 1.f, 0.f)};
+  const std::array<std::array<uint16_t, 4>, 4> expected_joints = {{
+      {0, 1, 2, 3},
+      {4, 5, 6, 7},
+      {8, 9, 10, 11},
+      {12, 13, 14, 15}}};
+  const std::array<std::array<float, 4>, 4> expected_weights = {{
+      {1.00f, 0.00f, 0.00f, 0.00f},
+      {0.50f, 0.50f, 0.00f, 0.00f},
+      {0.25f, 0.25f, 0.50f, 0.00f},
+      {0.25f, 0.25f, 0.25f, 0.25f}}};
+  const std::array<std::array<uint8_t, 4>, 4> expected_colors = {{
+      {255, 0, 0, 255},
+      {0, 255, 0, 255},
+      {0, 0, 255, 255},
+      {255, 255, 255, 128}}};
+  // clang-format on
+
+  // The decoder may reorder the points, so each point is matched with the
+  // source vertex by its position.
+  std::set<int> found_vertices;
+  for (PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+    Vector3f pos;
+    pos_att->GetMappedValue(pi, &pos[0]);
+    int v = 0;
+    while (v < 4 && expected_positions[v] != pos) {
+      ++v;
+    }
+    ASSERT_LT(v, 4) << "Unexpected position of point " << pi.value();
+    found_vertices.insert(v);
+
+    std::array<uint16_t, 4> joints;
+    joints_att->GetMappedValue(pi, &joints[0]);
+    ASSERT_EQ(joints, expected_joints[v]);
+    std::array<float, 4> weights;
+    weights_att->GetMappedValue(pi, &weights[0]);
+    ASSERT_EQ(weights, expected_weights[v]);
+    std::array<uint8_t, 4> color;
+    color_att->GetMappedValue(pi, &color[0]);
+    ASSERT_EQ(color, expected_colors[v]);
+  }
+  ASSERT_EQ(found_vertices.size(), 4);
+}
+
 TEST(GltfDecoderTest, DecodeMeshWithImplicitPrimitiveIndices) {
   // Check that glTF primitives with implicit indices can be loaded as a mesh.
   const std::string file_name = "Fox/glTF/Fox.gltf";
@@ -1516,5 +1594,72 @@ TEST(GltfDecoderTest, DecodePointCloudToMeshWithDeduplicationDisabled) {
             462);
 }
 
+TEST(GltfDecoderTest, DecodeSceneWithMultipleThreads) {
+  // Checks that the decoded scene does not depend on the number of threads
+  // used for building the meshes of the glTF primitives. The scenes must be
+  // identical, including the order of the base meshes, their points, and the
+  // mesh instances referencing them.
+  const std::vector<std::string> file_names = {
+      "CesiumMilkTruck/glTF/CesiumMilkTruck.gltf",
+      "three_meshes_two_materials_one_no_material/"
+      "three_meshes_two_materials_one_no_material.gltf"};
+  for (const std::string &file_name : file_names) {
+    SCOPED_TRACE(file_name);
+    std::unique_ptr<Scene> scenes[2];
+    const int num_threads[2] = {1, 4};
+    for (int i = 0; i < 2; ++i) {
+      GltfDecoder decoder;
+      decoder.SetNumDecodingThreads(num_threads[i]);
+      DRACO_ASSIGN_OR_ASSERT(
+          scenes[i],
+          decoder.DecodeFromFileToScene(GetTestFileFullPath(file_name)));
+    }
+    const Scene &scene0 = *scenes[0];
+    const Scene &scene1 = *scenes[1];
+    ASSERT_GT(scene0.NumMeshes(), 1);
+    ASSERT_TRUE(SceneAreEquivalent()(scene0, scene1));
+
+    // Check that the base meshes are identical.
+    for (MeshIndex mi(0); mi < scene0.NumMeshes(); ++mi) {
+      const Mesh &mesh0 = scene0.GetMesh(mi);
+      const Mesh &mesh1 = scene1.GetMesh(mi);
+      ASSERT_EQ(mesh0.num_faces(), mesh1.num_faces());
+      ASSERT_EQ(mesh0.num_points(), mesh1.num_points());
+      for (FaceIndex fi(0); fi < mesh0.num_faces(); ++fi) {
+        ASSERT_EQ(mesh0.face(fi), mesh1.face(fi));
+      }
+      ASSERT_EQ(mesh0.num_attributes(), mesh1.num_attributes());
+      for (int ai = 0; ai < mesh0.num_attributes(); ++ai) {
+        const PointAttribute &att0 = *mesh0.attribute(ai);
+        const PointAttribute &att1 = *mesh1.attribute(ai);
+        ASSERT_EQ(att0.attribute_type(), att1.attribute_type());
+        ASSERT_EQ(att0.data_type(), att1.data_type());
+        ASSERT_EQ(att0.num_components(), att1.num_components());
+        ASSERT_EQ(att0.size(), att1.size());
+        for (PointIndex pi(0); pi < mesh0.num_points(); ++pi) {
+          ASSERT_EQ(att0.mapped_index(pi), att1.mapped_index(pi));
+        }
+        for (AttributeValueIndex avi(0); avi < att0.size(); ++avi) {
+          ASSERT_EQ(std::memcmp(att0.GetAddress(avi), att1.GetAddress(avi),
+                                att0.byte_stride()),
+                    0);
+        }
+      }
+    }
+
+    // Check that the mesh instances reference the same base meshes.
+    for (MeshGroupIndex mgi(0); mgi < scene0.NumMeshGroups(); ++mgi) {
+      const MeshGroup &mesh_group0 = *scene0.GetMeshGroup(mgi);
+      const MeshGroup &mesh_group1 = *scene1.GetMeshGroup(mgi);
+      ASSERT_EQ(mesh_group0.GetName(), mesh_group1.GetName());
+      ASSERT_EQ(mesh_group0.NumMeshInstances(), mesh_group1.NumMeshInstances());
+      for (int i = 0; i < mesh_group0.NumMeshInstances(); ++i) {
+        ASSERT_TRUE(mesh_group0.GetMeshInstance(i) ==
+                    mesh_group1.GetMeshInstance(i));
+      }
+    }
+  }
+}
+
 }  // namespace draco
 #endif  // DRACO_TRANSCODER_SUPPORTED
@@ -37,6 +37,7 @@
 #include "draco/compression/draco_compression_options.h"
 #include "draco/compression/expert_encode.h"
 #include "draco/core/draco_types.h"
+#include "draco/core/thread_pool.h"
 #include "draco/core/vector_d.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/file_writer_utils.h"
@@ -309,8 +310,19 @@ class GltfAsset {
   void set_output_type(GltfEncoder::OutputType type) { output_type_ = type; }
   GltfEncoder::OutputType output_type() const { return output_type_; }
   void set_json_output_mode(JsonWriter::Mode mode) { gltf_json_.SetMode(mode); }
+  void set_num_compression_threads(int num_threads) {
+    num_compression_threads_ = num_threads;
+  }
 
  private:
+  // Result of a Draco compression of a single mesh.
+  struct DracoCompressedMesh {
+    Status status;
+    EncoderBuffer buffer;
+    int64_t num_encoded_points = 0;
+    int64_t num_encoded_faces = 0;
+  };
+
   // Pad |buffer_| to 4 byte boundary.
   bool PadBuffer();
 
@@ -322,8 +334,26 @@ class GltfAsset {
       const Mesh &mesh, GeometryAttribute::Type type, int index,
       const std::string &name, GltfDracoCompressedMesh *compressed_mesh_info);
 
-  // Compresses |mesh| using Draco. On success returns the buffer_view in
-  // |primitive| and number of encoded points and faces.
+  // Encodes |mesh| using Draco into |buffer|. The function does not access
+  // the asset so it can be called concurrently for different meshes.
+  static Status EncodeMeshWithDraco(const Mesh &mesh,
+                                    const Eigen::Matrix4d &transform,
+                                    EncoderBuffer *buffer,
+                                    int64_t *num_encoded_points,
+                                    int64_t *num_encoded_faces);
+
+  // Compresses those of |meshes| that are going to be compressed with Draco
+  // concurrently on up to |num_compression_threads_| threads. Each mesh is
+  // given with the transform that is later passed to
+  // CompressMeshWithDraco(), which picks up the results. The compressed data is
+  // therefore still added to |buffer_| in the same order as when the meshes
+  // are compressed one by one. Does nothing when only one thread is allowed.
+  void PrecompressMeshes(
+      const std::vector<std::pair<const Mesh *, Eigen::Matrix4d>> &meshes);
+
+  // Compresses |mesh| using Draco, unless it was already compressed by
+  // PrecompressMeshes(). On success returns the buffer_view in |primitive|
+  // and number of encoded points and faces.
   Status CompressMeshWithDraco(const Mesh &mesh,
                                const Eigen::Matrix4d &transform,
                                GltfPrimitive *primitive,
@@ -692,6 +722,14 @@ class GltfAsset {
   std::vector<std::unique_ptr<Mesh>> local_meshes_;
 
   std::vector<double> cesium_rtc_;
+
+  // Maximum number of threads used for compressing meshes with Draco.
+  int num_compression_threads_;
+
+  // Meshes compressed by PrecompressMeshes() that were not yet added to
+  // |buffer_|.
+  std::unordered_map<const Mesh *, std::unique_ptr<DracoCompressedMesh>>
+      precompressed_meshes_;
 };
 
 int GltfAsset::UnsignedIntComponentSize(unsigned int max_value) {
@@ -728,7 +766,8 @@ GltfAsset::GltfAsset()
       structural_metadata_used_(false),
       mesh_features_texture_index_(0),
       add_images_to_buffer_(false),
-      output_type_(GltfEncoder::COMPACT) {}
+      output_type_(GltfEncoder::COMPACT),
+      num_compression_threads_(1) {}
 
 bool GltfAsset::AddDracoMesh(const Mesh &mesh) {
   const int scene_index = AddScene();
@@ -761,6 +800,8 @@ bool GltfAsset::AddDracoMesh(const Mesh &mesh) {
       return false;
     }
     auto split_meshes = std::move(split_maybe).value();
+    std::vector<std::pair<const Mesh *, Eigen::Matrix4d>> meshes_to_compress;
+    std::vector<uint32_t> material_indices;
     for (int i = 0; i < split_meshes.size(); ++i) {
       if (split_meshes[i] == nullptr) {
         continue;  // Empty mesh. Ignore.
@@ -780,10 +821,16 @@ bool GltfAsset::AddDracoMesh(const Mesh &mesh) {
       // do this because the split mesh may contain mesh features data that are
       // used later in the encoding process.
       local_meshes_.push_back(std::move(split_meshes[i]));
+      meshes_to_compress.push_back(std::make_pair(
+          local_meshes_.back().get(), Eigen::Matrix4d::Identity()));
+      material_indices.push_back(mat_index);
+    }
+    PrecompressMeshes(meshes_to_compress);
 
+    for (int i = 0; i < meshes_to_compress.size(); ++i) {
       // The material index in the glTF file corresponds to the index of the
       // split mesh.
-      if (!AddDracoMesh(*(local_meshes_.back().get()), mat_index, {},
+      if (!AddDracoMesh(*meshes_to_compress[i].first, material_indices[i], {},
                         Eigen::Matrix4d::Identity())) {
         return false;
       }
@@ -880,11 +927,11 @@ void GltfAsset::AddAttributeToDracoExtension(
   }
 }
 
-Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
-                                        const Eigen::Matrix4d &transform,
-                                        GltfPrimitive *primitive,
-                                        int64_t *num_encoded_points,
-                                        int64_t *num_encoded_faces) {
+Status GltfAsset::EncodeMeshWithDraco(const Mesh &mesh,
+                                      const Eigen::Matrix4d &transform,
+                                      EncoderBuffer *buffer,
+                                      int64_t *num_encoded_points,
+                                      int64_t *num_encoded_faces) {
   // Check that geometry comression options are valid.
   DracoCompressionOptions compression_options = mesh.GetCompressionOptions();
   DRACO_RETURN_IF_ERROR(compression_options.Check());
@@ -908,7 +955,6 @@ Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
   }
 
   // Create Draco encoder.
-  EncoderBuffer buffer;
   std::unique_ptr<ExpertEncoder> encoder;
   if (mesh_copy->num_faces() > 0) {
     // Encode mesh.
@@ -1016,15 +1062,80 @@ Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
   // |compression_options| may have been modified and we need to update them
   // before we start the encoding.
   mesh_copy->SetCompressionOptions(compression_options);
-  DRACO_RETURN_IF_ERROR(encoder->EncodeToBuffer(&buffer));
+  DRACO_RETURN_IF_ERROR(encoder->EncodeToBuffer(buffer));
   *num_encoded_points = encoder->num_encoded_points();
   if (mesh_copy->num_faces() > 0) {
     *num_encoded_faces = encoder->num_encoded_faces();
   } else {
     *num_encoded_faces = 0;
   }
+  return OkStatus();
+}
+
+void GltfAsset::PrecompressMeshes(
+    const std::vector<std::pair<const Mesh *, Eigen::Matrix4d>> &meshes) {
+  if (num_compression_threads_ <= 1) {
+    return;
+  }
+  // Create the results for all meshes before the compression starts, so that
+  // |precompressed_meshes_| is not modified by the worker threads.
+  std::vector<std::pair<int, DracoCompressedMesh *>> tasks;
+  for (int i = 0; i < meshes.size(); ++i) {
+    const Mesh &mesh = *meshes[i].first;
+    if (mesh.num_faces() == 0 || !mesh.IsCompressionEnabled() ||
+        precompressed_meshes_.count(&mesh) > 0) {
+      continue;
+    }
+    std::unique_ptr<DracoCompressedMesh> &compressed_mesh =
+        precompressed_meshes_[&mesh];
+    compressed_mesh.reset(new DracoCompressedMesh());
+    tasks.push_back(std::make_pair(i, compressed_mesh.get()));
+  }
+  if (tasks.size() <= 1) {
+    // Nothing to parallelize. Leave the mesh to CompressMeshWithDraco().
+    for (const auto &task : tasks) {
+      precompressed_meshes_.erase(meshes[task.first].first);
+    }
+    return;
+  }
+  ThreadPool thread_pool(
+      std::min(num_compression_threads_, static_cast<int>(tasks.size())));
+  for (const auto &task : tasks) {
+    const std::pair<const Mesh *, Eigen::Matrix4d> &mesh = meshes[task.first];
+    DracoCompressedMesh *const compressed_mesh = task.second;
+    thread_pool.Schedule([&mesh, compressed_mesh]() {
+      compressed_mesh->status = EncodeMeshWithDraco(
+          *mesh.first, mesh.second, &compressed_mesh->buffer,
+          &compressed_mesh->num_encoded_points,
+          &compressed_mesh->num_encoded_faces);
+    });
+  }
+  thread_pool.Wait();
+}
+
+Status GltfAsset::CompressMeshWithDraco(const Mesh &mesh,
+                                        const Eigen::Matrix4d &transform,
+                                        GltfPrimitive *primitive,
+                                        int64_t *num_encoded_points,
+                                        int64_t *num_encoded_faces) {
+  EncoderBuffer local_buffer;
+  const EncoderBuffer *buffer = &local_buffer;
+  std::unique_ptr<DracoCompressedMesh> compressed_mesh;
+  const auto it = precompressed_meshes_.find(&mesh);
+  if (it != precompressed_meshes_.end()) {
+    compressed_mesh = std::move(it->second);
+    precompressed_meshes_.erase(it);
+    DRACO_RETURN_IF_ERROR(compressed_mesh->status);
+    buffer = &compressed_mesh->buffer;
+    *num_encoded_points = compressed_mesh->num_encoded_points;
+    *num_encoded_faces = compressed_mesh->num_encoded_faces;
+  } else {
+    DRACO_RETURN_IF_ERROR(EncodeMeshWithDraco(mesh, transform, &local_buffer,
+                                              num_encoded_points,
+                                              num_encoded_faces));
+  }
   const size_t buffer_start_offset = buffer_.size();
-  if (!buffer_.Encode(buffer.data(), buffer.size())) {
+  if (!buffer_.Encode(buffer->data(), buffer->size())) {
     return Status(Status::DRACO_ERROR, "Could not copy Draco compressed data.");
   }
   if (!PadBuffer()) {
@@ -1593,6 +1704,30 @@ Status GltfAsset::AddScene(const Scene &scene) {
   // Initialize base mesh transforms that may be needed when the base meshes are
   // compressed with Draco.
   base_mesh_transforms_ = SceneUtils::FindLargestBaseMeshTransforms(scene);
+  if (num_compression_threads_ > 1) {
+    // Compress all base meshes referenced by the scene nodes up front. The
+    // compressed data is added to the buffer later in the same order as
+    // without the precompression.
+    std::vector<std::pair<const Mesh *, Eigen::Matrix4d>> meshes_to_compress;
+    std::unordered_set<int> added_meshes;
+    for (SceneNodeIndex i(0); i < scene.NumNodes(); ++i) {
+      const MeshGroupIndex mesh_group_index =
+          scene.GetNode(i)->GetMeshGroupIndex();
+      if (mesh_group_index == kInvalidMeshGroupIndex) {
+        continue;
+      }
+      const MeshGroup *const mesh_group = scene.GetMeshGroup(mesh_group_index);
+      for (int j = 0; j < mesh_group->NumMeshInstances(); ++j) {
+        const MeshIndex mesh_index =
+            mesh_group->GetMeshInstance(j).mesh_index;
+        if (added_meshes.insert(mesh_index.value()).second) {
+          meshes_to_compress.push_back(std::make_pair(
+              &scene.GetMesh(mesh_index), base_mesh_transforms_[mesh_index]));
+        }
+      }
+    }
+    PrecompressMeshes(meshes_to_compress);
+  }
   for (SceneNodeIndex i(0); i < scene.NumNodes(); ++i) {
     DRACO_RETURN_IF_ERROR(AddSceneNode(scene, i));
   }
@@ -3494,16 +3629,12 @@ int GltfAsset::AddAttribute(const PointAttribute &att, int num_points,
   GltfAccessor accessor;
   if (!compress) {
     const size_t buffer_start_offset = buffer_.size();
-    for (PointIndex v(0); v < num_points; ++v) {
-      if (!att.ConvertValue<att_data_t, att_components_t>(att.mapped_index(v),
-                                                          &value[0])) {
-        return -1;
-      }
-
-      for (int j = 0; j < att_components_t; ++j) {
-        buffer_.Encode(&value[j], kComponentSize);
-      }
+    std::vector<att_data_t> values(num_points * att_components_t);
+    if (!att.ConvertMappedValues<att_data_t>(PointIndex(0), num_points,
+                                             att_components_t, values.data())) {
+      return -1;
     }
+    buffer_.Encode(values.data(), values.size() * kComponentSize);
 
     if (!PadBuffer()) {
       return -1;
@@ -3549,7 +3680,10 @@ void GltfAsset::SetCopyrightFromMesh(const Mesh &mesh) {
 const char GltfEncoder::kDracoMetadataGltfAttributeName[] =
     "//GLTF/ApplicationSpecificAttributeName";
 
-GltfEncoder::GltfEncoder() : out_buffer_(nullptr), output_type_(COMPACT) {}
+GltfEncoder::GltfEncoder()
+    : out_buffer_(nullptr),
+      output_type_(COMPACT),
+      num_compression_threads_(1) {}
 
 template <typename T>
 bool GltfEncoder::EncodeToFile(const T &geometry, const std::string &file_name,
@@ -3601,6 +3735,7 @@ Status GltfEncoder::EncodeFile(const T &geometry, const std::string &filename,
   GltfAsset gltf_asset;
   gltf_asset.set_copyright(copyright_);
   gltf_asset.set_output_type(output_type_);
+  gltf_asset.set_num_compression_threads(num_compression_threads_);
 
   if (extension == "gltf") {
     std::string bin_path;
@@ -3630,6 +3765,7 @@ Status GltfEncoder::EncodeToBuffer(const T &geometry,
   gltf_asset.buffer_name("");
   gltf_asset.set_add_images_to_buffer(true);
   gltf_asset.set_copyright(copyright_);
+  gltf_asset.set_num_compression_threads(num_compression_threads_);
 
   // Encode the geometry into a buffer.
   EncoderBuffer buffer;
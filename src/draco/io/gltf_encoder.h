@@ -87,6 +87,15 @@ class GltfEncoder {
   void set_copyright(const std::string &copyright) { copyright_ = copyright; }
   std::string copyright() const { return copyright_; }
 
+  // Sets the maximum number of threads used for compressing the meshes with
+  // Draco. When greater than one, all base meshes of the encoded geometry are
+  // compressed concurrently before they are added to the output. The encoded
+  // output does not depend on the number of threads. Default is 1.
+  void set_num_compression_threads(int num_threads) {
+    num_compression_threads_ = num_threads;
+  }
+  int num_compression_threads() const { return num_compression_threads_; }
+
   // The name of the attribute metadata that contains the glTF attribute
   // name. For application-specific generic attributes, if the metadata for
   // an attribute contains this key, then the value will be used as the
@@ -130,6 +139,7 @@ class GltfEncoder {
   EncoderBuffer *out_buffer_;
   OutputType output_type_;
   std::string copyright_;
+  int num_compression_threads_;
 };
 
 }  // namespace draco
@@ -1500,6 +1500,51 @@ TEST_F(GltfEncoderTest, EncodeToBuffer) {
   ASSERT_EQ(std::memcmp(file_data.data(), buffer.data(), buffer.size()), 0);
 }
 
+// Tests that the encoded output does not depend on the number of threads used
+// for compressing the meshes with Draco.
+TEST_F(GltfEncoderTest, EncodeWithMultipleCompressionThreads) {
+  // The milk truck contains multiple meshes when loaded as a scene and
+  // multiple materials when loaded as a single mesh.
+  const std::string file_name = "CesiumMilkTruck/glTF/CesiumMilkTruck.gltf";
+  const std::unique_ptr<Scene> scene = ReadSceneFromTestFile(file_name);
+  ASSERT_NE(scene, nullptr);
+  ASSERT_GT(scene->NumMeshes(), 1);
+  const std::unique_ptr<Mesh> mesh = ReadMeshFromTestFile(file_name);
+  ASSERT_NE(mesh, nullptr);
+  const PointAttribute *const material_att =
+      mesh->GetNamedAttribute(GeometryAttribute::MATERIAL);
+  ASSERT_NE(material_att, nullptr);
+  ASSERT_GT(material_att->size(), 1);
+
+  const DracoCompressionOptions options;
+  SceneUtils::SetDracoCompressionOptions(&options, scene.get());
+  mesh->SetCompressionEnabled(true);
+  mesh->SetCompressionOptions(options);
+
+  // Encode both geometries with a single thread and with multiple threads.
+  EncoderBuffer scene_buffers[2];
+  EncoderBuffer mesh_buffers[2];
+  const int num_threads[2] = {1, 4};
+  for (int i = 0; i < 2; ++i) {
+    GltfEncoder encoder;
+    encoder.set_num_compression_threads(num_threads[i]);
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(*scene, &scene_buffers[i]));
+    DRACO_ASSERT_OK(encoder.EncodeToBuffer(*mesh, &mesh_buffers[i]));
+  }
+
+  // Check that the encoded data is identical.
+  ASSERT_NE(scene_buffers[0].size(), 0);
+  ASSERT_EQ(scene_buffers[0].size(), scene_buffers[1].size());
+  ASSERT_EQ(std::memcmp(scene_buffers[0].data(), scene_buffers[1].data(),
+                        scene_buffers[0].size()),
+            0);
+  ASSERT_NE(mesh_buffers[0].size(), 0);
+  ASSERT_EQ(mesh_buffers[0].size(), mesh_buffers[1].size());
+  ASSERT_EQ(std::memcmp(mesh_buffers[0].data(), mesh_buffers[1].data(),
+                        mesh_buffers[0].size()),
+            0);
+}
+
 TEST_F(GltfEncoderTest, CopyrightAssetIsEncoded) {
   // Load scene from file.
   const std::string file_name = "CesiumMilkTruck/glTF/CesiumMilkTruck.gltf";
@@ -66,6 +66,8 @@ StatusOr<std::unique_ptr<Mesh>> ReadMeshFromFile(
     ObjDecoder obj_decoder;
     obj_decoder.set_use_metadata(options.GetBool("use_metadata", false));
     obj_decoder.set_preserve_polygons(options.GetBool("preserve_polygons"));
+    obj_decoder.set_num_deduplication_threads(
+        options.GetInt("num_deduplication_threads", 1));
     const Status obj_status =
         obj_decoder.DecodeFromFile(file_name, mesh.get(), mesh_files);
     if (!obj_status.ok()) {
@@ -76,6 +78,8 @@ StatusOr<std::unique_ptr<Mesh>> ReadMeshFromFile(
   if (extension == "ply") {
     // Stanford PLY file format.
     PlyDecoder ply_decoder;
+    ply_decoder.set_num_deduplication_threads(
+        options.GetInt("num_deduplication_threads", 1));
     DRACO_RETURN_IF_ERROR(ply_decoder.DecodeFromFile(file_name, mesh.get()));
     return std::move(mesh);
   }
@@ -93,12 +97,12 @@ StatusOr<std::unique_ptr<Mesh>> ReadMeshFromFile(
 
   // Otherwise not an obj file. Assume the file was encoded with one of the
   // draco encoding methods.
+  std::unique_ptr<FileReaderInterface> file_reader;
   std::vector<char> file_data;
-  if (!ReadFileToBuffer(file_name, &file_data)) {
+  DecoderBuffer buffer;
+  if (!ReadFileToDecoderBuffer(file_name, &file_reader, &file_data, &buffer)) {
     return Status(Status::DRACO_ERROR, "Unable to read input file.");
   }
-  DecoderBuffer buffer;
-  buffer.Init(file_data.data(), file_data.size());
   Decoder decoder;
   auto statusor = decoder.DecodeMeshFromBuffer(&buffer);
   if (!statusor.ok() || statusor.value() == nullptr) {
@@ -93,6 +93,8 @@ StatusOr<std::unique_ptr<Mesh>> ReadMeshFromFile(const std::string &file_name,
 // Reads a mesh from a file. Reading is configured with |options|:
 // use_metadata  : Read obj file info like material names and object names into
 // metadata. Default is false.
+// num_deduplication_threads : Number of threads used to deduplicate attribute
+// values of obj and ply files. Default is 1.
 // The second form returns the files associated with the mesh via the
 // |mesh_files| argument.
 // Returns nullptr with an error status if the decoding failed.
@@ -0,0 +1,82 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/io/mmap_file_reader.h"
+
+#include <cstring>
+#include <vector>
+
+#include "draco/core/draco_test_base.h"
+#include "draco/core/draco_test_utils.h"
+#include "draco/io/file_reader_test_common.h"
+#include "draco/io/stdio_file_reader.h"
+
+namespace draco {
+namespace {
+
+TEST(MmapFileReaderTest, FailOpen) {
+  EXPECT_EQ(MmapFileReader::Open(""), nullptr);
+  EXPECT_EQ(MmapFileReader::Open("mmap reader fake file"), nullptr);
+}
+
+// Memory mapping is only supported on POSIX platforms.
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(__EMSCRIPTEN__)
+TEST(MmapFileReaderTest, FailRead) {
+  auto reader = MmapFileReader::Open(GetTestFileFullPath("car.drc"));
+  ASSERT_NE(reader, nullptr);
+  std::vector<char> *buffer = nullptr;
+  EXPECT_FALSE(reader->ReadFileToBuffer(buffer));
+}
+
+TEST(MmapFileReaderTest, ReadFile) {
+  std::vector<char> buffer;
+
+  auto reader = MmapFileReader::Open(GetTestFileFullPath("car.drc"));
+  ASSERT_NE(reader, nullptr);
+  EXPECT_TRUE(reader->ReadFileToBuffer(&buffer));
+  EXPECT_EQ(buffer.size(), kFileSizeCarDrc);
+
+  reader = MmapFileReader::Open(GetTestFileFullPath("cube_pc.drc"));
+  ASSERT_NE(reader, nullptr);
+  EXPECT_TRUE(reader->ReadFileToBuffer(&buffer));
+  EXPECT_EQ(buffer.size(), kFileSizeCubePcDrc);
+}
+
+TEST(MmapFileReaderTest, GetFileSize) {
+  auto reader = MmapFileReader::Open(GetTestFileFullPath("car.drc"));
+  ASSERT_EQ(reader->GetFileSize(), kFileSizeCarDrc);
+  reader = MmapFileReader::Open(GetTestFileFullPath("cube_pc.drc"));
+  ASSERT_EQ(reader->GetFileSize(), kFileSizeCubePcDrc);
+}
+
+TEST(MmapFileReaderTest, GetFileData) {
+  // Tests that the mapped data matches the file contents read by stdio.
+  const std::string file_name = GetTestFileFullPath("car.drc");
+  std::vector<char> expected_data;
+  auto stdio_reader = StdioFileReader::Open(file_name);
+  ASSERT_NE(stdio_reader, nullptr);
+  ASSERT_TRUE(stdio_reader->ReadFileToBuffer(&expected_data));
+
+  auto reader = MmapFileReader::Open(file_name);
+  ASSERT_NE(reader, nullptr);
+  ASSERT_NE(reader->GetFileData(), nullptr);
+  ASSERT_EQ(reader->GetFileSize(), expected_data.size());
+  EXPECT_EQ(memcmp(reader->GetFileData(), expected_data.data(),
+                   expected_data.size()),
+            0);
+}
+#endif
+
+}  // namespace
+}  // namespace draco
@@ -40,6 +40,7 @@ ObjDecoder::ObjDecoder()
       sub_obj_att_id_(-1),
       added_edge_att_id_(-1),
       deduplicate_input_values_(true),
+      num_deduplication_threads_(1),
       last_material_id_(0),
       use_metadata_(false),
       preserve_polygons_(false),
@@ -62,11 +63,11 @@ Status ObjDecoder::DecodeFromFile(const std::string &file_name, Mesh *out_mesh,
 
 Status ObjDecoder::DecodeFromFile(const std::string &file_name,
                                   PointCloud *out_point_cloud) {
+  std::unique_ptr<FileReaderInterface> file_reader;
   std::vector<char> buffer;
-  if (!ReadFileToBuffer(file_name, &buffer)) {
+  if (!ReadFileToDecoderBuffer(file_name, &file_reader, &buffer, &buffer_)) {
     return Status(Status::DRACO_ERROR, "Unable to read input file.");
   }
-  buffer_.Init(buffer.data(), buffer.size());
 
   out_point_cloud_ = out_point_cloud;
   input_file_name_ = file_name;
@@ -271,7 +272,8 @@ Status ObjDecoder::DecodeInternal() {
 
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
   if (deduplicate_input_values_) {
-    out_point_cloud_->DeduplicateAttributeValues();
+    out_point_cloud_->DeduplicateAttributeValuesInParallel(
+        num_deduplication_threads_);
   }
 #endif
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
@@ -51,6 +51,11 @@ class ObjDecoder {
   // contain any duplicate entries.
   // Default: true
   void set_deduplicate_input_values(bool v) { deduplicate_input_values_ = v; }
+  // Sets the number of threads used for the deduplication of input values.
+  // Default: 1
+  void set_num_deduplication_threads(int num_threads) {
+    num_deduplication_threads_ = num_threads;
+  }
   // Flag for whether using metadata to record other information in the obj
   // file, e.g. material names, object names.
   void set_use_metadata(bool flag) { use_metadata_ = flag; }
@@ -117,6 +122,7 @@ class ObjDecoder {
   int added_edge_att_id_;  // Attribute id for polygon reconstruction.
 
   bool deduplicate_input_values_;
+  int num_deduplication_threads_;
 
   int last_material_id_;
   std::string material_file_name_;
@@ -14,7 +14,9 @@
 //
 #include "draco/io/obj_encoder.h"
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "draco/attributes/geometry_attribute.h"
 #include "draco/io/file_writer_factory.h"
@@ -218,14 +220,8 @@ bool ObjEncoder::EncodePositions() {
   if (att == nullptr || att->size() == 0) {
     return false;  // Position attribute must be valid.
   }
-  std::array<float, 3> value;
-  for (AttributeValueIndex i(0); i < static_cast<uint32_t>(att->size()); ++i) {
-    if (!att->ConvertValue<float, 3>(i, &value[0])) {
-      return false;
-    }
-    buffer()->Encode("v ", 2);
-    EncodeFloatList(&value[0], 3);
-    buffer()->Encode("\n", 1);
+  if (!EncodeFloatValues(*att, 3, "v ")) {
+    return false;
   }
   pos_att_ = att;
   return true;
@@ -237,14 +233,8 @@ bool ObjEncoder::EncodeTextureCoordinates() {
   if (att == nullptr || att->size() == 0) {
     return true;  // It's OK if we don't have texture coordinates.
   }
-  std::array<float, 2> value;
-  for (AttributeValueIndex i(0); i < static_cast<uint32_t>(att->size()); ++i) {
-    if (!att->ConvertValue<float, 2>(i, &value[0])) {
-      return false;
-    }
-    buffer()->Encode("vt ", 3);
-    EncodeFloatList(&value[0], 2);
-    buffer()->Encode("\n", 1);
+  if (!EncodeFloatValues(*att, 2, "vt ")) {
+    return false;
   }
   tex_coord_att_ = att;
   return true;
@@ -256,16 +246,33 @@ bool ObjEncoder::EncodeNormals() {
   if (att == nullptr || att->size() == 0) {
     return true;  // It's OK if we don't have normals.
   }
-  std::array<float, 3> value;
-  for (AttributeValueIndex i(0); i < static_cast<uint32_t>(att->size()); ++i) {
-    if (!att->ConvertValue<float, 3>(i, &value[0])) {
+  if (!EncodeFloatValues(*att, 3, "vn ")) {
+    return false;
+  }
+  normal_att_ = att;
+  return true;
+}
+
+bool ObjEncoder::EncodeFloatValues(const PointAttribute &att,
+                                   int num_components, const char *prefix) {
+  // Convert the values in blocks to limit the size of the temporary buffer.
+  constexpr int kMaxBlockSize = 1024;
+  const int num_values = static_cast<int>(att.size());
+  const int prefix_length = static_cast<int>(strlen(prefix));
+  std::vector<float> values(std::min(num_values, kMaxBlockSize) *
+                            num_components);
+  for (int first = 0; first < num_values; first += kMaxBlockSize) {
+    const int block_size = std::min(kMaxBlockSize, num_values - first);
+    if (!att.ConvertValues<float>(AttributeValueIndex(first), block_size,
+                                  num_components, values.data())) {
       return false;
     }
-    buffer()->Encode("vn ", 3);
-    EncodeFloatList(&value[0], 3);
-    buffer()->Encode("\n", 1);
+    for (int i = 0; i < block_size; ++i) {
+      buffer()->Encode(prefix, prefix_length);
+      EncodeFloatList(&values[i * num_components], num_components);
+      buffer()->Encode("\n", 1);
+    }
   }
-  normal_att_ = att;
   return true;
 }
 
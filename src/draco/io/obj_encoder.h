@@ -53,6 +53,10 @@ class ObjEncoder {
   bool EncodePositions();
   bool EncodeTextureCoordinates();
   bool EncodeNormals();
+  // Encodes all values of |att| converted to |num_components| floats, one
+  // value per line starting with |prefix|.
+  bool EncodeFloatValues(const PointAttribute &att, int num_components,
+                         const char *prefix);
   bool EncodeFaces();
   bool EncodePolygonalFaces();
   bool EncodeFaceAttributes(FaceIndex face_id);
@@ -36,7 +36,10 @@ int64_t CountNumTriangles(const PlyElement &face_element,
 }
 }  // namespace
 
-PlyDecoder::PlyDecoder() : out_mesh_(nullptr), out_point_cloud_(nullptr) {}
+PlyDecoder::PlyDecoder()
+    : out_mesh_(nullptr),
+      out_point_cloud_(nullptr),
+      num_deduplication_threads_(1) {}
 
 Status PlyDecoder::DecodeFromFile(const std::string &file_name,
                                   Mesh *out_mesh) {
@@ -46,11 +49,11 @@ Status PlyDecoder::DecodeFromFile(const std::string &file_name,
 
 Status PlyDecoder::DecodeFromFile(const std::string &file_name,
                                   PointCloud *out_point_cloud) {
+  std::unique_ptr<FileReaderInterface> file_reader;
   std::vector<char> data;
-  if (!ReadFileToBuffer(file_name, &data)) {
+  if (!ReadFileToDecoderBuffer(file_name, &file_reader, &data, &buffer_)) {
     return Status(Status::DRACO_ERROR, "Unable to read input file.");
   }
-  buffer_.Init(data.data(), data.size());
   return DecodeFromBuffer(&buffer_, out_point_cloud);
 }
 
@@ -79,7 +82,8 @@ Status PlyDecoder::DecodeInternal() {
   // not require deduplication.
   if (out_mesh_ && out_mesh_->num_faces() != 0) {
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
-    if (!out_point_cloud_->DeduplicateAttributeValues()) {
+    if (!out_point_cloud_->DeduplicateAttributeValuesInParallel(
+            num_deduplication_threads_)) {
       return Status(Status::DRACO_ERROR,
                     "Could not deduplicate attribute values");
     }
@@ -43,6 +43,12 @@ class PlyDecoder {
   Status DecodeFromBuffer(DecoderBuffer *buffer, Mesh *out_mesh);
   Status DecodeFromBuffer(DecoderBuffer *buffer, PointCloud *out_point_cloud);
 
+  // Sets the number of threads used for the deduplication of attribute values
+  // of decoded meshes. Default: 1
+  void set_num_deduplication_threads(int num_threads) {
+    num_deduplication_threads_ = num_threads;
+  }
+
  protected:
   Status DecodeInternal();
   DecoderBuffer *buffer() { return &buffer_; }
@@ -62,6 +68,7 @@ class PlyDecoder {
   // always set but |out_mesh_| is optional.
   Mesh *out_mesh_;
   PointCloud *out_point_cloud_;
+  int num_deduplication_threads_;
 };
 
 }  // namespace draco
@@ -44,12 +44,13 @@ StatusOr<std::unique_ptr<PointCloud>> ReadPointCloudFromFile(
     return std::move(pc);
   }
 
+  std::unique_ptr<FileReaderInterface> file_reader;
   std::vector<char> buffer;
-  if (!ReadFileToBuffer(file_name, &buffer)) {
+  DecoderBuffer decoder_buffer;
+  if (!ReadFileToDecoderBuffer(file_name, &file_reader, &buffer,
+                               &decoder_buffer)) {
     return Status(Status::DRACO_ERROR, "Unable to read input file.");
   }
-  DecoderBuffer decoder_buffer;
-  decoder_buffer.Init(buffer.data(), buffer.size());
   Decoder decoder;
   auto status_or = decoder.DecodePointCloudFromBuffer(&decoder_buffer);
   return std::move(status_or).value();
@@ -52,10 +52,23 @@ StatusOr<std::unique_ptr<Scene>> ReadSceneFromFile(
 
 StatusOr<std::unique_ptr<Scene>> ReadSceneFromFile(
     const std::string &file_name, std::vector<std::string> *scene_files) {
+  const Options options;
+  return ReadSceneFromFile(file_name, options, scene_files);
+}
+
+StatusOr<std::unique_ptr<Scene>> ReadSceneFromFile(const std::string &file_name,
+                                                   const Options &options) {
+  return ReadSceneFromFile(file_name, options, nullptr);
+}
+
+StatusOr<std::unique_ptr<Scene>> ReadSceneFromFile(
+    const std::string &file_name, const Options &options,
+    std::vector<std::string> *scene_files) {
   std::unique_ptr<Scene> scene(new Scene());
   switch (GetSceneFileFormat(file_name)) {
     case GLTF: {
       GltfDecoder decoder;
+      decoder.SetNumDecodingThreads(options.GetInt("num_decoding_threads", 1));
       return decoder.DecodeFromFileToScene(file_name, scene_files);
     }
     case USD: {
@@ -35,6 +35,22 @@ StatusOr<std::unique_ptr<Scene>> ReadSceneFromFile(
 StatusOr<std::unique_ptr<Scene>> ReadSceneFromFile(
     const std::string &file_name, std::vector<std::string> *scene_files);
 
+// Reads a scene from a file, configurable with |options|. The second form
+// returns the files associated with the scene via the |scene_files| argument.
+//
+// Supported options:
+//
+//   num_decoding_threads=<int> - maximum number of threads used for building
+//                                the meshes of glTF primitives. The decoded
+//                                scene does not depend on the number of
+//                                threads (default = 1)
+//
+StatusOr<std::unique_ptr<Scene>> ReadSceneFromFile(const std::string &file_name,
+                                                   const Options &options);
+StatusOr<std::unique_ptr<Scene>> ReadSceneFromFile(
+    const std::string &file_name, const Options &options,
+    std::vector<std::string> *scene_files);
+
 // Writes a scene into a file.
 Status WriteSceneToFile(const std::string &file_name, const Scene &scene);
 
@@ -16,11 +16,13 @@
 
 #include <string>
 #include <utility>
+#include <vector>
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/mesh_io.h"
+#include "draco/scene/scene_are_equivalent.h"
 
 namespace {
 
@@ -48,6 +50,24 @@ TEST(SceneTest, TestSceneIO) {
             0);
 }
 
+TEST(SceneTest, TestReadSceneWithOptions) {
+  // Verifies that the scene read with multiple decoding threads is the same as
+  // the scene read with the default options.
+  const std::string file_name =
+      draco::GetTestFileFullPath("CesiumMilkTruck/glTF/CesiumMilkTruck.gltf");
+  DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::Scene> scene,
+                         draco::ReadSceneFromFile(file_name));
+  draco::Options options;
+  options.SetInt("num_decoding_threads", 4);
+  std::vector<std::string> scene_files;
+  DRACO_ASSIGN_OR_ASSERT(
+      std::unique_ptr<draco::Scene> threaded_scene,
+      draco::ReadSceneFromFile(file_name, options, &scene_files));
+  ASSERT_TRUE(draco::SceneAreEquivalent()(*scene, *threaded_scene));
+  ASSERT_FALSE(scene_files.empty());
+  ASSERT_EQ(scene_files[0], file_name);
+}
+
 TEST(SceneTest, TestSaveToPly) {
   // A simple test that verifies that a loaded scene can be stored in a PLY file
   // format.
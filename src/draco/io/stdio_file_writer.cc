@@ -21,7 +21,11 @@ namespace draco {
 bool StdioFileWriter::registered_in_factory_ =
     FileWriterFactory::RegisterWriter(StdioFileWriter::Open);
 
-StdioFileWriter::~StdioFileWriter() { fclose(file_); }
+StdioFileWriter::~StdioFileWriter() {
+  if (file_ != nullptr) {
+    fclose(file_);
+  }
+}
 
 std::unique_ptr<FileWriterInterface> StdioFileWriter::Open(
     const std::string &file_name) {
@@ -53,7 +57,19 @@ std::unique_ptr<FileWriterInterface> StdioFileWriter::Open(
 }
 
 bool StdioFileWriter::Write(const char *buffer, size_t size) {
+  if (file_ == nullptr) {
+    return false;
+  }
   return fwrite(buffer, 1, size, file_) == size;
 }
 
+bool StdioFileWriter::Close() {
+  if (file_ == nullptr) {
+    return false;
+  }
+  const bool success = fclose(file_) == 0;
+  file_ = nullptr;
+  return success;
+}
+
 }  // namespace draco
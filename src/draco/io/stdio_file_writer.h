@@ -24,12 +24,15 @@ class StdioFileWriter : public FileWriterInterface {
   StdioFileWriter(StdioFileWriter &&) = default;
   StdioFileWriter &operator=(StdioFileWriter &&) = default;
 
-  // Closes |file_|.
+  // Closes |file_| when it was not closed by Close().
   ~StdioFileWriter() override;
 
   // Writes |size| bytes to |file_| from |buffer|. Returns true for success.
   bool Write(const char *buffer, size_t size) override;
 
+  // Closes |file_|. Returns false when the buffered data could not be written.
+  bool Close() override;
+
  private:
   StdioFileWriter(FILE *file) : file_(file) {}
 
@@ -34,5 +34,29 @@ TEST(StdioFileWriterTest, BasicWrite) {
   CheckFileWriter(kWriteString, kTempFilePath);
 }
 
+TEST(StdioFileWriterTest, Close) {
+  const std::string kWriteString = "Hello";
+  const std::string kTempFilePath = GetTestTempFileFullPath("hello_close");
+  auto writer = StdioFileWriter::Open(kTempFilePath);
+  ASSERT_NE(writer, nullptr);
+  ASSERT_TRUE(writer->Write(kWriteString.data(), kWriteString.size()));
+  ASSERT_TRUE(writer->Close());
+  // The file cannot be written or closed again.
+  ASSERT_FALSE(writer->Write(kWriteString.data(), kWriteString.size()));
+  ASSERT_FALSE(writer->Close());
+}
+
+#ifdef __linux__
+TEST(StdioFileWriterTest, FailClose) {
+  // Writes to /dev/full are buffered successfully but fail when the buffer is
+  // flushed.
+  auto writer = StdioFileWriter::Open("/dev/full");
+  ASSERT_NE(writer, nullptr);
+  const std::string kWriteString = "Hello";
+  ASSERT_TRUE(writer->Write(kWriteString.data(), kWriteString.size()));
+  ASSERT_FALSE(writer->Close());
+}
+#endif
+
 }  // namespace
 }  // namespace draco
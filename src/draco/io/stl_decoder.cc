@@ -26,12 +26,12 @@ namespace draco {
 
 StatusOr<std::unique_ptr<Mesh>> StlDecoder::DecodeFromFile(
     const std::string &file_name) {
+  std::unique_ptr<FileReaderInterface> file_reader;
   std::vector<char> data;
-  if (!ReadFileToBuffer(file_name, &data)) {
+  DecoderBuffer buffer;
+  if (!ReadFileToDecoderBuffer(file_name, &file_reader, &data, &buffer)) {
     return Status(Status::IO_ERROR, "Unable to read input file.");
   }
-  DecoderBuffer buffer;
-  buffer.Init(data.data(), data.size());
   return DecodeFromBuffer(&buffer);
 }
 
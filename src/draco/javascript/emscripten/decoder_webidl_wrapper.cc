@@ -25,6 +25,21 @@ using draco::PointAttribute;
 using draco::PointCloud;
 using draco::Status;
 
+void DracoVertexBufferLayout::AddElement(draco_GeometryAttribute_Type type,
+                                         long att_index,
+                                         draco_DataType data_type,
+                                         long num_components, bool normalized,
+                                         long offset) {
+  draco::VertexElement element;
+  element.attribute_type = type;
+  element.attribute_index = att_index;
+  element.data_type = data_type;
+  element.num_components = num_components;
+  element.normalized = normalized;
+  element.offset = offset;
+  layout_.elements.push_back(element);
+}
+
 MetadataQuerier::MetadataQuerier() : entry_names_metadata_(nullptr) {}
 
 bool MetadataQuerier::HasEntry(const Metadata &metadata,
@@ -122,6 +137,24 @@ const draco::Status *Decoder::DecodeArrayToMesh(const char *data,
   return DecodeBufferToMesh(&buffer, out_mesh);
 }
 
+const draco::Status *Decoder::DecodeArrayToVertexBuffer(
+    const char *data, size_t data_size, const DracoVertexBufferLayout &layout,
+    DracoVertexBuffer *out_buffer) {
+  DecoderBuffer buffer;
+  buffer.Init(data, data_size);
+  const int stride = layout.layout().stride;
+  last_status_ = decoder_.DecodeMeshToVertexBuffer(
+      &buffer, layout.layout(),
+      [out_buffer, stride](int num_vertices, int num_faces,
+                           uint8_t **out_vertex_data, uint32_t **out_indices) {
+        out_buffer->Allocate(num_vertices, num_faces, stride);
+        *out_vertex_data = static_cast<uint8_t *>(out_buffer->vertex_data());
+        *out_indices = static_cast<uint32_t *>(out_buffer->indices());
+        return draco::OkStatus();
+      });
+  return &last_status_;
+}
+
 long Decoder::GetAttributeId(const PointCloud &pc,
                              draco_GeometryAttribute_Type type) const {
   return pc.GetNamedAttributeId(type);
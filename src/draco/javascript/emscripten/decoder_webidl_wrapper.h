@@ -21,6 +21,7 @@
 #include "draco/attributes/point_attribute.h"
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/decode.h"
+#include "draco/compression/vertex_buffer_layout.h"
 #include "draco/core/decoder_buffer.h"
 #include "draco/mesh/mesh.h"
 
@@ -94,6 +95,57 @@ class MetadataQuerier {
   std::string last_string_returned_;
 };
 
+// Layout of an interleaved vertex buffer filled by
+// Decoder::DecodeArrayToVertexBuffer(). See draco::VertexBufferLayout.
+class DracoVertexBufferLayout {
+ public:
+  DracoVertexBufferLayout() {}
+
+  // Adds an element storing values of the |att_index|-th attribute of the
+  // given |type| at |offset| bytes from the start of each vertex.
+  void AddElement(draco_GeometryAttribute_Type type, long att_index,
+                  draco_DataType data_type, long num_components,
+                  bool normalized, long offset);
+  void SetStride(long stride) { layout_.stride = stride; }
+
+  const draco::VertexBufferLayout &layout() const { return layout_; }
+
+ private:
+  draco::VertexBufferLayout layout_;
+};
+
+// Vertex and index buffers of a decoded mesh. The buffers are stored on the
+// emscripten heap so they can be accessed from JavaScript without any copies,
+// e.g., using new Float32Array(HEAPF32.buffer, vertex_data(), size).
+class DracoVertexBuffer {
+ public:
+  DracoVertexBuffer() : num_vertices_(0), num_faces_(0) {}
+
+  // Allocates the buffers. Used by Decoder::DecodeArrayToVertexBuffer().
+  void Allocate(int num_vertices, int num_faces, int stride) {
+    num_vertices_ = num_vertices;
+    num_faces_ = num_faces;
+    vertex_data_.resize(static_cast<size_t>(num_vertices) * stride);
+    indices_.resize(3 * static_cast<size_t>(num_faces));
+  }
+
+  long num_vertices() const { return num_vertices_; }
+  long num_faces() const { return num_faces_; }
+
+  // Size of the vertex data in bytes.
+  long vertex_data_size() const { return vertex_data_.size(); }
+  void *vertex_data() { return vertex_data_.data(); }
+
+  // Point indices of all faces stored as 3 * num_faces() uint32 values.
+  void *indices() { return indices_.data(); }
+
+ private:
+  int num_vertices_;
+  int num_faces_;
+  std::vector<uint8_t> vertex_data_;
+  std::vector<uint32_t> indices_;
+};
+
 // Class used by emscripten WebIDL Binder [1] to wrap calls to decode Draco
 // data.
 // [1]http://kripken.github.io/emscripten-site/docs/porting/connecting_cpp_and_javascript/WebIDL-Binder.html
@@ -126,6 +178,13 @@ class Decoder {
   const draco::Status *DecodeArrayToMesh(const char *data, size_t data_size,
                                          draco::Mesh *out_mesh);
 
+  // Decodes a mesh from the provided array directly into the interleaved
+  // vertex buffer described by |layout|. Attribute transforms such as
+  // dequantization are reverted while the vertex buffer is written.
+  const draco::Status *DecodeArrayToVertexBuffer(
+      const char *data, size_t data_size,
+      const DracoVertexBufferLayout &layout, DracoVertexBuffer *out_buffer);
+
   // Returns an attribute id for the first attribute of a given type.
   long GetAttributeId(const draco::PointCloud &pc,
                       draco_GeometryAttribute_Type type) const;
@@ -302,25 +361,10 @@ class Decoder {
       return true;
     }
 
-    // Copy values one by one.
-    std::vector<T> values(components);
-    int entry_id = 0;
-
-    T *const typed_output = reinterpret_cast<T *>(out_values);
-    for (draco::PointIndex i(0); i < num_points; ++i) {
-      const draco::AttributeValueIndex val_index = pa.mapped_index(i);
-      if (requested_type_matches) {
-        pa.GetValue(val_index, values.data());
-      } else {
-        if (!pa.ConvertValue<T>(val_index, values.data())) {
-          return false;
-        }
-      }
-      for (int j = 0; j < components; ++j) {
-        typed_output[entry_id++] = values[j];
-      }
-    }
-    return true;
+    // Convert values of all points.
+    return pa.ConvertMappedValues<T>(draco::PointIndex(0), num_points,
+                                     components,
+                                     reinterpret_cast<T *>(out_values));
   }
 
   draco::Decoder decoder_;
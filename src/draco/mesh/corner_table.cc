@@ -14,10 +14,13 @@
 //
 #include "draco/mesh/corner_table.h"
 
+#include <algorithm>
 #include <limits>
 #include <memory>
+#include <vector>
 
 #include "draco/attributes/geometry_indices.h"
+#include "draco/core/thread_pool.h"
 #include "draco/mesh/corner_table_iterators.h"
 
 namespace draco {
@@ -30,14 +33,24 @@ CornerTable::CornerTable()
 
 std::unique_ptr<CornerTable> CornerTable::Create(
     const IndexTypeVector<FaceIndex, FaceType> &faces) {
+  return Create(faces, 1);
+}
+
+std::unique_ptr<CornerTable> CornerTable::Create(
+    const IndexTypeVector<FaceIndex, FaceType> &faces, int num_threads) {
   std::unique_ptr<CornerTable> ct(new CornerTable());
-  if (!ct->Init(faces)) {
+  if (!ct->Init(faces, num_threads)) {
     return nullptr;
   }
   return ct;
 }
 
 bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces) {
+  return Init(faces, 1);
+}
+
+bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces,
+                       int num_threads) {
   valence_cache_.ClearValenceCache();
   valence_cache_.ClearValenceCacheInaccurate();
   corner_to_vertex_map_.resize(faces.size() * 3);
@@ -47,7 +60,11 @@ bool CornerTable::Init(const IndexTypeVector<FaceIndex, FaceType> &faces) {
     }
   }
   int num_vertices = -1;
-  if (!ComputeOppositeCorners(&num_vertices)) {
+  if (num_threads > 1) {
+    if (!ComputeOppositeCornersInParallel(num_threads, &num_vertices)) {
+      return false;
+    }
+  } else if (!ComputeOppositeCorners(&num_vertices)) {
     return false;
   }
   if (!BreakNonManifoldEdges()) {
@@ -74,7 +91,12 @@ bool CornerTable::Reset(int num_faces, int num_vertices) {
   }
   corner_to_vertex_map_.assign(num_faces_unsigned * 3, kInvalidVertexIndex);
   opposite_corners_.assign(num_faces_unsigned * 3, kInvalidCornerIndex);
+  vertex_corners_.clear();
   vertex_corners_.reserve(num_vertices);
+  non_manifold_vertex_parents_.clear();
+  num_original_vertices_ = 0;
+  num_degenerated_faces_ = 0;
+  num_isolated_vertices_ = 0;
   valence_cache_.ClearValenceCache();
   valence_cache_.ClearValenceCacheInaccurate();
   return true;
@@ -209,6 +231,176 @@ bool CornerTable::ComputeOppositeCorners(int *num_vertices) {
   return true;
 }
 
+bool CornerTable::ComputeOppositeCornersInParallel(int num_threads,
+                                                   int *num_vertices) {
+  DRACO_DCHECK(GetValenceCache().IsCacheEmpty());
+  if (num_vertices == nullptr) {
+    return false;
+  }
+  opposite_corners_.resize(num_corners(), kInvalidCornerIndex);
+
+  // The sequential algorithm in ComputeOppositeCorners() matches each
+  // half-edge only with half-edges of the same undirected edge and the result
+  // depends only on the order in which these half-edges are processed.
+  // Therefore, we can split the half-edges into disjoint partitions based on
+  // their smaller vertex and match each partition independently, as long as
+  // the half-edges of each partition are processed in the order of their
+  // corners.
+  //
+  // In the first step, the faces are split into |num_parts| ranges of
+  // consecutive faces and the half-edges (defined by their opposite corners)
+  // of each range are distributed to the partitions. Each partition is then
+  // formed by the buckets of all face ranges which preserves the order of the
+  // corners.
+  const int num_parts = num_threads;
+  const int num_faces = this->num_faces();
+  std::vector<std::vector<std::vector<CornerIndex>>> buckets(
+      num_parts, std::vector<std::vector<CornerIndex>>(num_parts));
+  std::vector<int> max_vertex_ids(num_parts, -1);
+  std::vector<int> num_degenerated_faces(num_parts, 0);
+  ThreadPool thread_pool(num_threads);
+  for (int r = 0; r < num_parts; ++r) {
+    thread_pool.Schedule([this, r, num_parts, num_faces, &buckets,
+                          &max_vertex_ids, &num_degenerated_faces]() {
+      const FaceIndex begin(static_cast<int64_t>(num_faces) * r / num_parts);
+      const FaceIndex end(static_cast<int64_t>(num_faces) * (r + 1) /
+                          num_parts);
+      std::vector<std::vector<CornerIndex>> &range_buckets = buckets[r];
+      // Reserve space for a roughly even distribution of the half-edges.
+      const size_t expected_bucket_size =
+          3 * static_cast<size_t>(end.value() - begin.value()) / num_parts;
+      for (int p = 0; p < num_parts; ++p) {
+        range_buckets[p].reserve(expected_bucket_size +
+                                 expected_bucket_size / 8);
+      }
+      int max_vertex_id = -1;
+      int num_degenerated = 0;
+      for (FaceIndex fi = begin; fi < end; ++fi) {
+        const CornerIndex first_c = FirstCorner(fi);
+        const VertexIndex v[3] = {Vertex(first_c), Vertex(first_c + 1),
+                                  Vertex(first_c + 2)};
+        for (int i = 0; i < 3; ++i) {
+          max_vertex_id =
+              std::max(max_vertex_id, static_cast<int>(v[i].value()));
+        }
+        if (v[0] == v[1] || v[0] == v[2] || v[1] == v[2]) {
+          // Degenerated faces are ignored.
+          ++num_degenerated;
+          continue;
+        }
+        for (int i = 0; i < 3; ++i) {
+          // The half-edge opposite to corner |i| connects the other two
+          // vertices of the face.
+          const VertexIndex min_v = std::min(v[(i + 1) % 3], v[(i + 2) % 3]);
+          range_buckets[min_v.value() % num_parts].push_back(first_c + i);
+        }
+      }
+      max_vertex_ids[r] = max_vertex_id;
+      num_degenerated_faces[r] = num_degenerated;
+    });
+  }
+  thread_pool.Wait();
+
+  int max_vertex_id = -1;
+  for (int r = 0; r < num_parts; ++r) {
+    max_vertex_id = std::max(max_vertex_id, max_vertex_ids[r]);
+    num_degenerated_faces_ += num_degenerated_faces[r];
+  }
+  *num_vertices = max_vertex_id + 1;
+
+  // In the second step, half-edges of each partition are matched using the
+  // same algorithm as in ComputeOppositeCorners(), except that the unmatched
+  // half-edges are stored on their smaller vertex instead of their source
+  // vertex. Vertices of a partition are indexed locally by
+  // |vertex_id / num_parts|.
+  const int num_part_vertices = *num_vertices / num_parts + 1;
+  for (int p = 0; p < num_parts; ++p) {
+    thread_pool.Schedule([this, p, num_parts, num_part_vertices, &buckets]() {
+      std::vector<int> num_edges_on_vertices(num_part_vertices, 0);
+      for (int r = 0; r < num_parts; ++r) {
+        for (const CornerIndex c : buckets[r][p]) {
+          const VertexIndex min_v =
+              std::min(Vertex(Next(c)), Vertex(Previous(c)));
+          ++num_edges_on_vertices[min_v.value() / num_parts];
+        }
+      }
+      std::vector<int> vertex_offset(num_part_vertices);
+      int num_part_edges = 0;
+      for (int i = 0; i < num_part_vertices; ++i) {
+        vertex_offset[i] = num_part_edges;
+        num_part_edges += num_edges_on_vertices[i];
+      }
+
+      // Unused half-edges are marked with |sink_vert| == kInvalidVertexIndex.
+      struct HalfEdge {
+        HalfEdge()
+            : source_vert(kInvalidVertexIndex),
+              sink_vert(kInvalidVertexIndex),
+              edge_corner(kInvalidCornerIndex) {}
+        VertexIndex source_vert;
+        VertexIndex sink_vert;
+        CornerIndex edge_corner;
+      };
+      std::vector<HalfEdge> vertex_edges(num_part_edges, HalfEdge());
+
+      for (int r = 0; r < num_parts; ++r) {
+        for (const CornerIndex c : buckets[r][p]) {
+          const VertexIndex tip_v = Vertex(c);
+          const VertexIndex source_v = Vertex(Next(c));
+          const VertexIndex sink_v = Vertex(Previous(c));
+          const int local_v = std::min(source_v, sink_v).value() / num_parts;
+          const int num_edges_on_vert = num_edges_on_vertices[local_v];
+
+          CornerIndex opposite_c(kInvalidCornerIndex);
+          int offset = vertex_offset[local_v];
+          for (int i = 0; i < num_edges_on_vert; ++i, ++offset) {
+            const HalfEdge &edge = vertex_edges[offset];
+            if (edge.sink_vert == kInvalidVertexIndex) {
+              break;  // No matching half-edge found.
+            }
+            if (edge.source_vert == sink_v && edge.sink_vert == source_v) {
+              if (tip_v == Vertex(edge.edge_corner)) {
+                continue;  // Don't connect mirrored faces.
+              }
+              opposite_c = edge.edge_corner;
+              // Remove the matched half-edge while preserving the order of
+              // the remaining half-edges.
+              for (int j = i + 1; j < num_edges_on_vert; ++j, ++offset) {
+                vertex_edges[offset] = vertex_edges[offset + 1];
+                if (vertex_edges[offset].sink_vert == kInvalidVertexIndex) {
+                  break;  // Unused half-edge reached.
+                }
+              }
+              vertex_edges[offset].sink_vert = kInvalidVertexIndex;
+              break;
+            }
+          }
+          if (opposite_c == kInvalidCornerIndex) {
+            // No opposite corner found. Insert the new half-edge to the first
+            // unused slot.
+            offset = vertex_offset[local_v];
+            for (int i = 0; i < num_edges_on_vert; ++i, ++offset) {
+              if (vertex_edges[offset].sink_vert == kInvalidVertexIndex) {
+                vertex_edges[offset].source_vert = source_v;
+                vertex_edges[offset].sink_vert = sink_v;
+                vertex_edges[offset].edge_corner = c;
+                break;
+              }
+            }
+          } else {
+            // Both corners belong to the same partition so no other thread
+            // can access them.
+            opposite_corners_[c] = opposite_c;
+            opposite_corners_[opposite_c] = c;
+          }
+        }
+      }
+    });
+  }
+  thread_pool.Wait();
+  return true;
+}
+
 bool CornerTable::BreakNonManifoldEdges() {
   // This function detects and breaks non-manifold edges that are caused by
   // folds in 1-ring neighborhood around a vertex. Non-manifold edges can occur
@@ -59,15 +59,28 @@ class CornerTable {
   static std::unique_ptr<CornerTable> Create(
       const IndexTypeVector<FaceIndex, FaceType> &faces);
 
+  // Same as above but the opposite corners are computed using up to
+  // |num_threads| threads. The created corner table is the same for any
+  // number of threads.
+  static std::unique_ptr<CornerTable> Create(
+      const IndexTypeVector<FaceIndex, FaceType> &faces, int num_threads);
+
   // Initializes the CornerTable from provides set of indexed faces.
   // The input faces can represent a non-manifold topology, in which case the
   // non-manifold edges and vertices are going to be split.
   bool Init(const IndexTypeVector<FaceIndex, FaceType> &faces);
 
+  // Same as above but the opposite corners are computed using up to
+  // |num_threads| threads.
+  bool Init(const IndexTypeVector<FaceIndex, FaceType> &faces,
+            int num_threads);
+
   // Resets the corner table to the given number of invalid faces.
   bool Reset(int num_faces);
 
-  // Resets the corner table to the given number of invalid faces and vertices.
+  // Resets the corner table to the given number of invalid faces and reserves
+  // space for |num_vertices| vertices. All vertices of the table are removed
+  // so the table can be reused for a different mesh.
   bool Reset(int num_faces, int num_vertices);
 
   inline int num_vertices() const {
@@ -365,6 +378,11 @@ class CornerTable {
   // |corner_to_vertex_map_|.
   bool ComputeOppositeCorners(int *num_vertices);
 
+  // Same as ComputeOppositeCorners() but the half-edges are matched on
+  // |num_threads| threads. The computed opposite corners are the same as the
+  // ones computed by ComputeOppositeCorners().
+  bool ComputeOppositeCornersInParallel(int num_threads, int *num_vertices);
+
   // Finds and breaks non-manifold edges in the 1-ring neighborhood around
   // vertices (vertices themselves will be split in the ComputeVertexCorners()
   // function if necessary).
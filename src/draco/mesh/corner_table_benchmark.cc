@@ -0,0 +1,74 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include <map>
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#include "draco/mesh/corner_table.h"
+
+namespace draco {
+namespace {
+
+typedef IndexTypeVector<FaceIndex, CornerTable::FaceType> FaceVector;
+
+// Returns faces of a regular grid with |grid_size| x |grid_size| quads. Each
+// quad is split into two triangles. The faces are created only once for each
+// |grid_size| so that the construction time is not included in the
+// measurements.
+const FaceVector &GetGridFaces(int grid_size) {
+  static std::map<int, std::unique_ptr<FaceVector>> *const grids =
+      new std::map<int, std::unique_ptr<FaceVector>>();
+  std::unique_ptr<FaceVector> &faces = (*grids)[grid_size];
+  if (faces == nullptr) {
+    faces.reset(new FaceVector());
+    faces->reserve(2 * static_cast<size_t>(grid_size) * grid_size);
+    const int row_size = grid_size + 1;
+    for (int y = 0; y < grid_size; ++y) {
+      for (int x = 0; x < grid_size; ++x) {
+        const VertexIndex v0(y * row_size + x);
+        const VertexIndex v1 = v0 + 1;
+        const VertexIndex v2 = v0 + row_size;
+        const VertexIndex v3 = v2 + 1;
+        faces->push_back({v0, v1, v3});
+        faces->push_back({v0, v3, v2});
+      }
+    }
+  }
+  return *faces;
+}
+
+void BM_CornerTableInit(benchmark::State &state) {
+  const FaceVector &faces = GetGridFaces(state.range(0));
+  const int num_threads = state.range(1);
+  for (auto _ : state) {
+    CornerTable corner_table;
+    if (!corner_table.Init(faces, num_threads)) {
+      state.SkipWithError("Failed to initialize the corner table.");
+      return;
+    }
+    benchmark::DoNotOptimize(corner_table.num_vertices());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * 3 *
+                          faces.size());
+  state.counters["corners"] = static_cast<double>(3 * faces.size());
+}
+// A grid of size 2887 has about 50M corners.
+BENCHMARK(BM_CornerTableInit)
+    ->ArgsProduct({{256, 1024, 2887}, {1, 2, 4, 8}})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+}  // namespace
+}  // namespace draco
@@ -1,6 +1,8 @@
 #include "draco/mesh/corner_table.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/obj_decoder.h"
@@ -123,4 +125,59 @@ TEST_F(CornerTableTest, TestNewFace) {
   ASSERT_EQ(ct->Vertex(CornerIndex(3 * 12) + 2), new_vi);
 }
 
+TEST_F(CornerTableTest, TestParallelConstruction) {
+  // Tests that the corner table constructed on multiple threads is the same as
+  // the one constructed on a single thread.
+  const std::vector<std::string> file_names = {
+      "cube_att.obj", "non_manifold_wrap.obj", "test_nm.obj",
+      "degenerate_mesh.obj", "cube_subd.obj"};
+  for (const std::string &file_name : file_names) {
+    std::unique_ptr<Mesh> mesh = DecodeObj(file_name);
+    ASSERT_NE(mesh, nullptr) << "Failed to load test model " << file_name;
+    std::unique_ptr<CornerTable> ct =
+        draco::CreateCornerTableFromPositionAttribute(mesh.get());
+    ASSERT_NE(ct, nullptr);
+    for (const int num_threads : {2, 3, 8}) {
+      SCOPED_TRACE(file_name + " " + std::to_string(num_threads));
+      std::unique_ptr<CornerTable> parallel_ct =
+          draco::CreateCornerTableFromPositionAttribute(mesh.get(),
+                                                        num_threads);
+      ASSERT_NE(parallel_ct, nullptr);
+      ASSERT_EQ(parallel_ct->num_vertices(), ct->num_vertices());
+      ASSERT_EQ(parallel_ct->num_corners(), ct->num_corners());
+      ASSERT_EQ(parallel_ct->NumDegeneratedFaces(), ct->NumDegeneratedFaces());
+      ASSERT_EQ(parallel_ct->NumNewVertices(), ct->NumNewVertices());
+      for (CornerIndex c(0); c < ct->num_corners(); ++c) {
+        ASSERT_EQ(parallel_ct->Opposite(c), ct->Opposite(c));
+        ASSERT_EQ(parallel_ct->Vertex(c), ct->Vertex(c));
+      }
+    }
+  }
+}
+
+TEST_F(CornerTableTest, TestParallelConstructionNonManifoldEdges) {
+  // Four faces sharing the same edge <0, 1>, including a mirrored face and a
+  // degenerated face.
+  IndexTypeVector<FaceIndex, CornerTable::FaceType> faces;
+  faces.push_back({VertexIndex(0), VertexIndex(1), VertexIndex(2)});
+  faces.push_back({VertexIndex(1), VertexIndex(0), VertexIndex(3)});
+  faces.push_back({VertexIndex(0), VertexIndex(1), VertexIndex(4)});
+  faces.push_back({VertexIndex(1), VertexIndex(0), VertexIndex(2)});
+  faces.push_back({VertexIndex(0), VertexIndex(1), VertexIndex(1)});
+  faces.push_back({VertexIndex(1), VertexIndex(0), VertexIndex(5)});
+  std::unique_ptr<CornerTable> ct = CornerTable::Create(faces);
+  ASSERT_NE(ct, nullptr);
+  for (const int num_threads : {2, 4}) {
+    std::unique_ptr<CornerTable> parallel_ct =
+        CornerTable::Create(faces, num_threads);
+    ASSERT_NE(parallel_ct, nullptr);
+    ASSERT_EQ(parallel_ct->num_vertices(), ct->num_vertices());
+    ASSERT_EQ(parallel_ct->NumDegeneratedFaces(), 1);
+    for (CornerIndex c(0); c < ct->num_corners(); ++c) {
+      ASSERT_EQ(parallel_ct->Opposite(c), ct->Opposite(c));
+      ASSERT_EQ(parallel_ct->Vertex(c), ct->Vertex(c));
+    }
+  }
+}
+
 }  // namespace draco
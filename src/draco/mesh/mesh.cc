@@ -20,6 +20,9 @@
 #include <utility>
 #include <vector>
 
+#include "draco/core/hash_utils.h"
+#include "draco/core/index_hash_set.h"
+
 namespace draco {
 
 // Shortcut for typed conditionals.
@@ -65,33 +68,9 @@ void Mesh::Copy(const Mesh &src) {
   property_attributes_material_mask_ = src.property_attributes_material_mask_;
 }
 
-namespace {
-// A helper struct that augments a point index with an attribute value index.
-// A unique combination of |point_index| and |attribute_value_index|
-// corresponds to a unique point on the mesh. Used to identify unique points
-// after a new attribute is added to the mesh.
-struct AugmentedPointData {
-  PointIndex point_index;
-  AttributeValueIndex attribute_value_index;
-  bool operator<(const AugmentedPointData &pd) const {
-    if (point_index < pd.point_index) {
-      return true;
-    }
-    if (point_index > pd.point_index) {
-      return false;
-    }
-    return attribute_value_index < pd.attribute_value_index;
-  }
-};
-}  // namespace
-
 int32_t Mesh::AddAttributeWithConnectivity(
     std::unique_ptr<PointAttribute> att,
     const IndexTypeVector<CornerIndex, AttributeValueIndex> &corner_to_value) {
-  // Map between augmented point and new point indices (one augmented point
-  // corresponds to one PointIndex).
-  std::map<AugmentedPointData, PointIndex> old_to_new_point_map;
-
   // Map between corners and the new point indices.
   IndexTypeVector<CornerIndex, PointIndex> corner_to_point(num_faces() * 3,
                                                            kInvalidPointIndex);
@@ -101,30 +80,47 @@ int32_t Mesh::AddAttributeWithConnectivity(
   // than num_points() is identity. In other words, we want to keep indices of
   // the existing points intact and add new points to end.
   IndexTypeVector<PointIndex, bool> is_point_used(num_points(), false);
+  // Attribute value index of the first corner of each used existing point.
+  IndexTypeVector<PointIndex, AttributeValueIndex> point_to_value(
+      num_points(), kInvalidAttributeValueIndex);
+
+  // A unique combination of a point index and an attribute value index
+  // corresponds to a unique point on the mesh. Combinations that can not
+  // reuse an existing point index are identified by their first corner.
+  auto split_corner_hash = [this, &corner_to_value](CornerIndex ci) {
+    return HashCombine(CornerToPointId(ci).value(),
+                       corner_to_value[ci].value());
+  };
+  auto split_corner_equal = [this, &corner_to_value](CornerIndex c0,
+                                                     CornerIndex c1) {
+    return CornerToPointId(c0) == CornerToPointId(c1) &&
+           corner_to_value[c0] == corner_to_value[c1];
+  };
+  auto split_corners = CreateIndexHashSet<CornerIndex>(0, split_corner_hash,
+                                                       split_corner_equal);
 
   int new_num_points = num_points();
   for (CornerIndex ci(0); ci < num_faces() * 3; ++ci) {
-    AugmentedPointData apd;
-    apd.point_index = CornerToPointId(ci);
-    apd.attribute_value_index = corner_to_value[ci];
-    const auto it = old_to_new_point_map.find(apd);
-    if (it != old_to_new_point_map.end()) {
-      // Augmented point is already mapped to a point index. Reuse it.
-      corner_to_point[ci] = it->second;
+    const PointIndex pi = CornerToPointId(ci);
+    const AttributeValueIndex avi = corner_to_value[ci];
+    if (!is_point_used[pi]) {
+      // Reuse the existing (old) point index.
+      is_point_used[pi] = true;
+      point_to_value[pi] = avi;
+      corner_to_point[ci] = pi;
+    } else if (point_to_value[pi] == avi) {
+      corner_to_point[ci] = pi;
     } else {
-      // New combination of point index + attribute value index. Map it to a
-      // unique point index.
-      PointIndex new_point_index;
-      if (!is_point_used[apd.point_index]) {
-        // Reuse the existing (old) point index.
-        new_point_index = apd.point_index;
-        is_point_used[apd.point_index] = true;
+      // The point index is already mapped to a different attribute value.
+      const CornerIndex first_ci = split_corners.FindOrInsert(ci);
+      if (first_ci == ci) {
+        // New combination of point index + attribute value index. Add a new
+        // point index to the end.
+        corner_to_point[ci] = PointIndex(new_num_points++);
       } else {
-        // Add a new point index to the end.
-        new_point_index = PointIndex(new_num_points++);
+        // Reuse the point index of the same combination.
+        corner_to_point[ci] = corner_to_point[first_ci];
       }
-      old_to_new_point_map[apd] = new_point_index;
-      corner_to_point[ci] = new_point_index;
     }
   }
 
@@ -16,11 +16,14 @@
 
 #include <array>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
 
 #include "draco/core/hash_utils.h"
+#include "draco/mesh/corner_table.h"
+#include "draco/mesh/mesh_misc_functions.h"
 
 namespace draco {
 
@@ -43,6 +46,10 @@ Status MeshCleanup::Cleanup(Mesh *mesh, const MeshCleanupOptions &options) {
     RemoveDuplicateFaces(mesh);
   }
 
+  if (options.make_geometry_manifold) {
+    DRACO_RETURN_IF_ERROR(MakeGeometryManifold(mesh, options.num_threads))
+  }
+
   if (options.remove_unused_attributes) {
     RemoveUnusedAttributes(mesh);
   }
@@ -241,8 +248,129 @@ void MeshCleanup::RemoveUnusedAttributes(Mesh *mesh) {
   }
 }
 
-Status MeshCleanup::MakeGeometryManifold(Mesh *mesh) {
-  return Status(Status::DRACO_ERROR, "Unsupported function.");
+Status MeshCleanup::MakeGeometryManifold(Mesh *mesh, int num_threads) {
+  const int pos_att_id =
+      mesh->GetNamedAttributeId(GeometryAttribute::POSITION);
+  PointAttribute *const pos_att = mesh->attribute(pos_att_id);
+
+  // The corner table of the position connectivity already describes the
+  // manifold surface that we want to create. Its construction connects at
+  // most two faces on each edge and breaks all other connections on
+  // non-manifold edges. After that, each vertex with more than one disjoint
+  // fan of faces is split into new vertices, one for each fan.
+  const std::unique_ptr<CornerTable> corner_table =
+      CreateCornerTableFromPositionAttribute(mesh, num_threads);
+  if (corner_table == nullptr) {
+    return Status(Status::DRACO_ERROR, "Failed to compute mesh connectivity.");
+  }
+  if (corner_table->NumNewVertices() == 0) {
+    return OkStatus();  // The mesh is already manifold.
+  }
+
+  // Each new vertex gets a copy of the position value of its parent vertex.
+  // Vertices that were not split keep their original position values.
+  const int num_original_vertices = corner_table->NumOriginalVertices();
+  const int num_original_values = static_cast<int>(pos_att->size());
+  const int num_new_values = corner_table->NumNewVertices();
+  pos_att->Resize(num_original_values + num_new_values);
+  for (int i = 0; i < num_new_values; ++i) {
+    const VertexIndex parent =
+        corner_table->VertexParent(VertexIndex(num_original_vertices + i));
+    pos_att->buffer()->Write(
+        pos_att->GetBytePos(AttributeValueIndex(num_original_values + i)),
+        pos_att->GetAddress(AttributeValueIndex(parent.value())),
+        pos_att->byte_stride());
+  }
+  const auto vertex_to_value = [num_original_vertices,
+                                num_original_values](VertexIndex v) {
+    if (v.value() < static_cast<uint32_t>(num_original_vertices)) {
+      return AttributeValueIndex(v.value());
+    }
+    return AttributeValueIndex(num_original_values + v.value() -
+                               num_original_vertices);
+  };
+
+  // Compute the new position value of each corner.
+  IndexTypeVector<CornerIndex, AttributeValueIndex> corner_values(
+      corner_table->num_corners());
+  for (CornerIndex c(0); c < corner_table->num_corners(); ++c) {
+    corner_values[c] = vertex_to_value(corner_table->Vertex(c));
+  }
+
+  // Assign the new position values to points. A point whose corners map to
+  // different position values is split into new points, one for each value.
+  // The first value of each point is stored directly on the point.
+  const PointIndex::ValueType num_original_points = mesh->num_points();
+  IndexTypeVector<PointIndex, AttributeValueIndex> point_values(
+      num_original_points, kInvalidAttributeValueIndex);
+  // Source point and position value of each new point.
+  std::vector<std::pair<PointIndex, AttributeValueIndex>> new_points;
+  std::unordered_map<uint64_t, PointIndex> split_points;
+  for (FaceIndex f(0); f < mesh->num_faces(); ++f) {
+    Mesh::Face face = mesh->face(f);
+    bool face_changed = false;
+    for (int k = 0; k < 3; ++k) {
+      const PointIndex pi = face[k];
+      const AttributeValueIndex value =
+          corner_values[corner_table->FirstCorner(f) + k];
+      if (point_values[pi] == kInvalidAttributeValueIndex) {
+        point_values[pi] = value;
+        continue;
+      }
+      if (point_values[pi] == value) {
+        continue;
+      }
+      const uint64_t key =
+          (static_cast<uint64_t>(pi.value()) << 32) | value.value();
+      auto it = split_points.find(key);
+      if (it == split_points.end()) {
+        const PointIndex new_pi(num_original_points +
+                                static_cast<uint32_t>(new_points.size()));
+        new_points.push_back(std::make_pair(pi, value));
+        it = split_points.insert(std::make_pair(key, new_pi)).first;
+      }
+      face[k] = it->second;
+      face_changed = true;
+    }
+    if (face_changed) {
+      mesh->SetFace(f, face);
+    }
+  }
+
+  // Update the mapping between points and attribute values. New points use
+  // the same attribute values as their source points, except for positions.
+  const PointIndex::ValueType num_points =
+      num_original_points + static_cast<uint32_t>(new_points.size());
+  mesh->set_num_points(num_points);
+  for (int a = 0; a < mesh->num_attributes(); ++a) {
+    PointAttribute *const att = mesh->attribute(a);
+    if (a != pos_att_id && new_points.empty()) {
+      continue;
+    }
+    const bool was_mapping_identity = att->is_mapping_identity();
+    att->SetExplicitMapping(num_points);
+    if (was_mapping_identity) {
+      for (PointIndex pi(0); pi < num_original_points; ++pi) {
+        att->SetPointMapEntry(pi, AttributeValueIndex(pi.value()));
+      }
+    }
+    for (uint32_t i = 0; i < new_points.size(); ++i) {
+      const PointIndex new_pi(num_original_points + i);
+      if (a == pos_att_id) {
+        att->SetPointMapEntry(new_pi, new_points[i].second);
+      } else {
+        att->SetPointMapEntry(new_pi, att->mapped_index(new_points[i].first));
+      }
+    }
+    if (a == pos_att_id) {
+      for (PointIndex pi(0); pi < num_original_points; ++pi) {
+        if (point_values[pi] != kInvalidAttributeValueIndex) {
+          att->SetPointMapEntry(pi, point_values[pi]);
+        }
+      }
+    }
+  }
+  return OkStatus();
 }
 
 }  // namespace draco
@@ -39,8 +39,18 @@ struct MeshCleanupOptions {
 
   // If true, the cleanup tool splits vertices along non-manifold edges and
   // vertices. This ensures that the connectivity defined by position indices
-  // is manifold.
+  // is manifold. At most two faces stay connected on each edge, all other
+  // faces attached to the edge are disconnected from it. Each vertex is then
+  // split into one new vertex for every disjoint fan of faces around it.
+  // These are the same splits that the mesh encoders make when they build the
+  // connectivity of a non-manifold mesh, so the repair does not reduce the
+  // number of encoded vertices and barely changes the encoded size.
   bool make_geometry_manifold = false;
+
+  // Number of threads that can be used by the cleanup tool. Currently used
+  // only to build the position connectivity when |make_geometry_manifold| is
+  // true.
+  int num_threads = 1;
 };
 
 // Tool that can be used for removing bad or unused data from draco::Meshes.
@@ -53,7 +63,7 @@ class MeshCleanup {
   static void RemoveDegeneratedFaces(Mesh *mesh);
   static void RemoveDuplicateFaces(Mesh *mesh);
   static void RemoveUnusedAttributes(Mesh *mesh);
-  static Status MakeGeometryManifold(Mesh *mesh);
+  static Status MakeGeometryManifold(Mesh *mesh, int num_threads);
 };
 
 }  // namespace draco
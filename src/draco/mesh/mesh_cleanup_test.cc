@@ -14,9 +14,13 @@
 //
 #include "draco/mesh/mesh_cleanup.h"
 
+#include <cstring>
+#include <string>
+
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/core/vector_d.h"
+#include "draco/mesh/mesh_misc_functions.h"
 #include "draco/mesh/triangle_soup_mesh_builder.h"
 
 namespace draco {
@@ -207,4 +211,94 @@ TEST_F(MeshCleanupTest, TestDuplicateFaces) {
   ASSERT_EQ(mesh->num_faces(), 3);
 }
 
+TEST_F(MeshCleanupTest, TestMakeGeometryManifoldBowtie) {
+  // Two triangles sharing a single vertex. The shared vertex must be split so
+  // that each triangle gets its own copy of the position.
+  TriangleSoupMeshBuilder mb;
+  mb.Start(2);
+  const int pos_att_id =
+      mb.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+  // clang-format off
+  mb.SetAttributeValuesForFace(pos_att_id, FaceIndex(0),
+                               Vector3f(0.f, 0.f, 0.f).data(),
+                               Vector3f(1.f, 0.f, 0.f).data(),
+                               Vector3f(1.f, 1.f, 0.f).data());
+  mb.SetAttributeValuesForFace(pos_att_id, FaceIndex(1),
+                               Vector3f(0.f, 0.f, 0.f).data(),
+                               Vector3f(-1.f, 0.f, 0.f).data(),
+                               Vector3f(-1.f, -1.f, 0.f).data());
+  // clang-format on
+  std::unique_ptr<Mesh> mesh = mb.Finalize();
+  ASSERT_NE(mesh, nullptr);
+  ASSERT_EQ(mesh->num_points(), 5);
+  ASSERT_EQ(mesh->attribute(pos_att_id)->size(), 5u);
+
+  MeshCleanupOptions cleanup_options;
+  cleanup_options.make_geometry_manifold = true;
+  DRACO_ASSERT_OK(MeshCleanup::Cleanup(mesh.get(), cleanup_options));
+  ASSERT_EQ(mesh->num_faces(), 2);
+  ASSERT_EQ(mesh->num_points(), 6);
+  const PointAttribute *const pos_att = mesh->attribute(pos_att_id);
+  ASSERT_EQ(pos_att->size(), 6u);
+  const Vector3f origin(0.f, 0.f, 0.f);
+  for (FaceIndex f(0); f < 2; ++f) {
+    Vector3f pos;
+    pos_att->GetMappedValue(mesh->face(f)[0], &pos[0]);
+    ASSERT_EQ(pos, origin);
+  }
+  ASSERT_NE(pos_att->mapped_index(mesh->face(FaceIndex(0))[0]),
+            pos_att->mapped_index(mesh->face(FaceIndex(1))[0]));
+}
+
+TEST_F(MeshCleanupTest, TestMakeGeometryManifold) {
+  // Non-manifold meshes must become manifold without changing the geometry
+  // or any attribute values on the faces.
+  for (const std::string file_name :
+       {"test_nm.obj", "non_manifold_wrap.obj", "cube_att.obj"}) {
+    const std::unique_ptr<Mesh> input_mesh = ReadMeshFromTestFile(file_name);
+    ASSERT_NE(input_mesh, nullptr) << file_name;
+    const bool is_input_manifold =
+        CreateCornerTableFromPositionAttribute(input_mesh.get())
+            ->NumNewVertices() == 0;
+    ASSERT_EQ(is_input_manifold, file_name == "cube_att.obj") << file_name;
+    std::unique_ptr<Mesh> meshes[2];
+    for (int i = 0; i < 2; ++i) {
+      meshes[i] = ReadMeshFromTestFile(file_name);
+      ASSERT_NE(meshes[i], nullptr);
+      MeshCleanupOptions cleanup_options;
+      cleanup_options.remove_degenerated_faces = false;
+      cleanup_options.remove_duplicate_faces = false;
+      cleanup_options.remove_unused_attributes = false;
+      cleanup_options.make_geometry_manifold = true;
+      cleanup_options.num_threads = i == 0 ? 1 : 4;
+      DRACO_ASSERT_OK(MeshCleanup::Cleanup(meshes[i].get(), cleanup_options));
+    }
+    const Mesh &mesh = *meshes[0];
+    const std::unique_ptr<CornerTable> corner_table =
+        CreateCornerTableFromPositionAttribute(&mesh);
+    ASSERT_NE(corner_table, nullptr);
+    ASSERT_EQ(corner_table->NumNewVertices(), 0) << file_name;
+    ASSERT_EQ(mesh.num_faces(), input_mesh->num_faces());
+    for (FaceIndex f(0); f < mesh.num_faces(); ++f) {
+      // The result must not depend on the number of threads.
+      ASSERT_EQ(mesh.face(f), meshes[1]->face(f));
+      for (int c = 0; c < 3; ++c) {
+        const PointIndex pi = mesh.face(f)[c];
+        const PointIndex input_pi = input_mesh->face(f)[c];
+        for (int a = 0; a < mesh.num_attributes(); ++a) {
+          const PointAttribute *const att = mesh.attribute(a);
+          const PointAttribute *const input_att = input_mesh->attribute(a);
+          ASSERT_EQ(att->mapped_index(pi),
+                    meshes[1]->attribute(a)->mapped_index(pi));
+          ASSERT_EQ(std::memcmp(att->GetAddress(att->mapped_index(pi)),
+                                input_att->GetAddress(
+                                    input_att->mapped_index(input_pi)),
+                                att->byte_stride()),
+                    0);
+        }
+      }
+    }
+  }
+}
+
 }  // namespace draco
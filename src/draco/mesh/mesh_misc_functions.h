@@ -29,19 +29,20 @@
 namespace draco {
 
 // Creates a CornerTable from the position attribute of |mesh|. Returns nullptr
-// on error.
+// on error. The corner table is constructed using up to |num_threads|
+// threads (see CornerTable::Create()).
 std::unique_ptr<CornerTable> CreateCornerTableFromPositionAttribute(
-    const Mesh *mesh);
+    const Mesh *mesh, int num_threads = 1);
 
 // Creates a CornerTable from the first named attribute of |mesh| with a given
 // type. Returns nullptr on error.
 std::unique_ptr<CornerTable> CreateCornerTableFromAttribute(
-    const Mesh *mesh, GeometryAttribute::Type type);
+    const Mesh *mesh, GeometryAttribute::Type type, int num_threads = 1);
 
 // Creates a CornerTable from all attributes of |mesh|. Boundaries are
 // automatically introduced on all attribute seams. Returns nullptr on error.
 std::unique_ptr<CornerTable> CreateCornerTableFromAllAttributes(
-    const Mesh *mesh);
+    const Mesh *mesh, int num_threads = 1);
 
 // Returns true when the given corner lies opposite to an attribute seam.
 inline bool IsCornerOppositeToAttributeSeam(CornerIndex ci,
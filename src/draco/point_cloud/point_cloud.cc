@@ -15,8 +15,10 @@
 #include "draco/point_cloud/point_cloud.h"
 
 #include <algorithm>
-#include <unordered_map>
 #include <utility>
+#include <vector>
+
+#include "draco/core/index_hash_set.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include "draco/attributes/point_attribute.h"
@@ -236,19 +238,17 @@ void PointCloud::DeduplicatePointIds() {
     return true;
   };
 
-  std::unordered_map<PointIndex, PointIndex, decltype(point_hash),
-                     decltype(point_compare)>
-      unique_point_map(num_points_, point_hash, point_compare);
+  auto unique_points_set =
+      CreateIndexHashSet<PointIndex>(num_points_, point_hash, point_compare);
   int32_t num_unique_points = 0;
   IndexTypeVector<PointIndex, PointIndex> index_map(num_points_);
   std::vector<PointIndex> unique_points;
   // Go through all vertices and find their duplicates.
   for (PointIndex i(0); i < num_points_; ++i) {
-    const auto it = unique_point_map.find(i);
-    if (it != unique_point_map.end()) {
-      index_map[i] = it->second;
+    const PointIndex unique_point = unique_points_set.FindOrInsert(i);
+    if (unique_point != i) {
+      index_map[i] = index_map[unique_point];
     } else {
-      unique_point_map.insert(std::make_pair(i, PointIndex(num_unique_points)));
       index_map[i] = num_unique_points++;
       unique_points.push_back(i);
     }
@@ -285,13 +285,18 @@ void PointCloud::ApplyPointIdDeduplication(
 
 #ifdef DRACO_ATTRIBUTE_VALUES_DEDUPLICATION_SUPPORTED
 bool PointCloud::DeduplicateAttributeValues() {
+  return DeduplicateAttributeValuesInParallel(1);
+}
+
+bool PointCloud::DeduplicateAttributeValuesInParallel(int num_threads) {
   // Go over all attributes and create mapping between duplicate entries.
   if (num_points() == 0) {
     return true;  // Nothing to deduplicate.
   }
   // Deduplicate all attributes.
   for (int32_t att_id = 0; att_id < num_attributes(); ++att_id) {
-    if (!attribute(att_id)->DeduplicateValues(*attribute(att_id))) {
+    if (!attribute(att_id)->DeduplicateValues(
+            *attribute(att_id), AttributeValueIndex(0), num_threads)) {
       return false;
     }
   }
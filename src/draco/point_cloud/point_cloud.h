@@ -126,6 +126,11 @@ class PointCloud {
   // Deduplicates all attribute values (all attribute entries with the same
   // value are merged into a single entry).
   virtual bool DeduplicateAttributeValues();
+
+  // Same as DeduplicateAttributeValues() but the values of each attribute are
+  // deduplicated using up to |num_threads| threads. The result is the same for
+  // any number of threads.
+  bool DeduplicateAttributeValuesInParallel(int num_threads);
 #endif
 
 #ifdef DRACO_ATTRIBUTE_INDICES_DEDUPLICATION_SUPPORTED
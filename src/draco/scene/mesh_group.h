@@ -19,8 +19,10 @@
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
 #include <string>
+#include <utility>
 #include <vector>
 
+#include "draco/core/draco_index_type_vector.h"
 #include "draco/core/macros.h"
 #include "draco/scene/scene_indices.h"
 
@@ -127,6 +129,29 @@ class MeshGroup {
     }
   }
 
+  // Updates base mesh indices of all mesh instances according to |mesh_map|
+  // that maps the old base mesh indices to the new ones. Mesh instances
+  // referring to base meshes mapped to |kInvalidMeshIndex| are removed.
+  void RemapMeshInstances(
+      const IndexTypeVector<MeshIndex, MeshIndex> &mesh_map) {
+    int num_instances = 0;
+    for (int i = 0; i < mesh_instances_.size(); ++i) {
+      MeshInstance &instance = mesh_instances_[i];
+      if (instance.mesh_index != kInvalidMeshIndex) {
+        instance.mesh_index = mesh_map[instance.mesh_index];
+        if (instance.mesh_index == kInvalidMeshIndex) {
+          continue;
+        }
+      }
+      if (i != num_instances) {
+        mesh_instances_[num_instances] = std::move(instance);
+      }
+      num_instances++;
+    }
+    mesh_instances_.erase(mesh_instances_.begin() + num_instances,
+                          mesh_instances_.end());
+  }
+
  private:
   std::string name_;
   std::vector<MeshInstance> mesh_instances_;
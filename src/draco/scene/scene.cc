@@ -126,6 +126,40 @@ Status Scene::RemoveMesh(MeshIndex index) {
   return OkStatus();
 }
 
+Status Scene::RemoveMeshes(
+    const IndexTypeVector<MeshIndex, bool> &remove_mesh) {
+  if (remove_mesh.size() != meshes_.size()) {
+    return Status(Status::DRACO_ERROR, "Invalid number of base meshes.");
+  }
+
+  // Move the remaining base meshes to the front of |meshes_| and record their
+  // new indices.
+  IndexTypeVector<MeshIndex, MeshIndex> mesh_map(meshes_.size(),
+                                                 kInvalidMeshIndex);
+  MeshIndex num_meshes(0);
+  for (MeshIndex i(0); i < NumMeshes(); ++i) {
+    if (remove_mesh[i]) {
+      continue;
+    }
+    if (i != num_meshes) {
+      meshes_[num_meshes] = std::move(meshes_[i]);
+    }
+    mesh_map[i] = num_meshes++;
+  }
+  meshes_.resize(num_meshes.value());
+
+  // Remove references to removed base meshes from mesh groups, and update
+  // references to remaining base meshes in mesh groups.
+  for (MeshGroupIndex mgi(0); mgi < NumMeshGroups(); ++mgi) {
+    MeshGroup *const mesh_group = GetMeshGroup(mgi);
+    if (!mesh_group) {
+      return Status(Status::DRACO_ERROR, "MeshGroup is null.");
+    }
+    mesh_group->RemapMeshInstances(mesh_map);
+  }
+  return OkStatus();
+}
+
 Status Scene::RemoveMeshGroup(MeshGroupIndex index) {
   // Remove mesh group at |index| from |mesh_groups_| vector.
   const int new_num_mesh_groups = mesh_groups_.size() - 1;
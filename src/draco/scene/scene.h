@@ -61,6 +61,12 @@ class Scene {
   // updates references to remaining base meshes in mesh groups.
   Status RemoveMesh(MeshIndex index);
 
+  // Removes all base meshes for which |remove_mesh| is set in a single pass.
+  // Mesh instances of the removed base meshes are removed from mesh groups and
+  // references to the remaining base meshes are updated. |remove_mesh| must
+  // have an entry for each base mesh.
+  Status RemoveMeshes(const IndexTypeVector<MeshIndex, bool> &remove_mesh);
+
   // Returns the number of meshes in a scene before instancing is applied.
   int NumMeshes() const { return meshes_.size(); }
 
@@ -181,6 +181,59 @@ TEST(SceneTest, TestRemoveMesh) {
                  src_scene.GetMesh(draco::MeshIndex(3))));
 }
 
+TEST(SceneTest, TestRemoveMeshes) {
+  // Test that multiple base meshes can be removed from scene at once.
+  auto src_scene_ptr =
+      draco::ReadSceneFromTestFile("CesiumMilkTruck/glTF/CesiumMilkTruck.gltf");
+  ASSERT_NE(src_scene_ptr, nullptr);
+  const draco::Scene &src_scene = *src_scene_ptr;
+
+  // Copy scene.
+  draco::Scene dst_scene;
+  dst_scene.Copy(src_scene);
+  ASSERT_EQ(dst_scene.NumMeshes(), 4);
+
+  // Removal fails when the number of entries does not match the meshes.
+  draco::IndexTypeVector<draco::MeshIndex, bool> remove_mesh(3, false);
+  ASSERT_FALSE(dst_scene.RemoveMeshes(remove_mesh).ok());
+  ASSERT_EQ(dst_scene.NumMeshes(), 4);
+
+  // Remove the two middle base meshes from scene.
+  remove_mesh.assign(4, false);
+  remove_mesh[draco::MeshIndex(1)] = true;
+  remove_mesh[draco::MeshIndex(2)] = true;
+  DRACO_ASSERT_OK(dst_scene.RemoveMeshes(remove_mesh));
+  ASSERT_EQ(dst_scene.NumMeshes(), 2);
+  draco::MeshAreEquivalent eq;
+  ASSERT_TRUE(eq(dst_scene.GetMesh(draco::MeshIndex(0)),
+                 src_scene.GetMesh(draco::MeshIndex(0))));
+  ASSERT_TRUE(eq(dst_scene.GetMesh(draco::MeshIndex(1)),
+                 src_scene.GetMesh(draco::MeshIndex(3))));
+
+  // Check that the instances of the removed meshes are gone and that the
+  // instances of the last mesh refer to its new index.
+  ASSERT_EQ(dst_scene.NumMeshGroups(), src_scene.NumMeshGroups());
+  for (draco::MeshGroupIndex i(0); i < src_scene.NumMeshGroups(); ++i) {
+    const draco::MeshGroup *const src_group = src_scene.GetMeshGroup(i);
+    const draco::MeshGroup *const dst_group = dst_scene.GetMeshGroup(i);
+    std::vector<draco::MeshIndex> expected_mesh_indices;
+    for (int j = 0; j < src_group->NumMeshInstances(); ++j) {
+      const draco::MeshIndex mesh_index =
+          src_group->GetMeshInstance(j).mesh_index;
+      if (mesh_index == draco::MeshIndex(0)) {
+        expected_mesh_indices.push_back(draco::MeshIndex(0));
+      } else if (mesh_index == draco::MeshIndex(3)) {
+        expected_mesh_indices.push_back(draco::MeshIndex(1));
+      }
+    }
+    ASSERT_EQ(dst_group->NumMeshInstances(), expected_mesh_indices.size());
+    for (int j = 0; j < dst_group->NumMeshInstances(); ++j) {
+      ASSERT_EQ(dst_group->GetMeshInstance(j).mesh_index,
+                expected_mesh_indices[j]);
+    }
+  }
+}
+
 TEST(SceneTest, TestRemoveMeshGroup) {
   // Test that a mesh group can be removed from scene.
   auto src_scene_ptr =
@@ -16,18 +16,21 @@
 #include "draco/scene/scene_utils.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <cstring>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "draco/core/draco_index_type_vector.h"
 #include "draco/core/hash_utils.h"
 #include "draco/core/vector_d.h"
 #include "draco/mesh/mesh_splitter.h"
 #include "draco/mesh/mesh_utils.h"
+#include "draco/metadata/structural_metadata.h"
 #include "draco/scene/scene_indices.h"
 #include "draco/texture/texture_utils.h"
 
@@ -945,6 +948,174 @@ void SceneUtils::DeduplicateMeshGroups(Scene *scene) {
   Cleanup(scene);
 }
 
+namespace {
+
+// Returns true if all data of |mesh| that is relevant for the scene is
+// covered by ComputeMeshGeometryHash() and MeshGeometryEquals(). Meshes with
+// other data, such as mesh features, metadata, or transformed attributes, are
+// never deduplicated.
+bool CanDeduplicateMesh(const Mesh &mesh) {
+  if (mesh.NumMeshFeatures() > 0 || mesh.NumPropertyAttributesIndices() > 0 ||
+      mesh.GetMetadata() != nullptr ||
+      mesh.GetNonMaterialTextureLibrary().NumTextures() > 0 ||
+      mesh.GetStructuralMetadata() != StructuralMetadata()) {
+    return false;
+  }
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    if (mesh.attribute(i)->GetAttributeTransformData() != nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns the address and size in bytes of all values of |att|.
+std::pair<const char *, size_t> GetAttributeValues(const PointAttribute &att) {
+  if (att.size() == 0) {
+    return std::make_pair(nullptr, 0);
+  }
+  return std::make_pair(
+      reinterpret_cast<const char *>(att.GetAddress(AttributeValueIndex(0))),
+      att.size() * static_cast<size_t>(att.byte_stride()));
+}
+
+// Computes a hash of the content of |mesh|. Unlike MeshHasher, the hash does
+// not depend on the identity of the attribute buffers, so meshes with the
+// same geometry stored in different buffers get the same hash.
+uint64_t ComputeMeshGeometryHash(const Mesh &mesh) {
+  uint64_t hash = HashCombine(mesh.num_points(), mesh.num_faces());
+  hash = HashCombine(mesh.GetName(), hash);
+  hash = HashCombine(mesh.IsCompressionEnabled(), hash);
+  if (mesh.num_faces() > 0) {
+    hash = HashCombine(
+        FingerprintString(
+            reinterpret_cast<const char *>(&mesh.face(FaceIndex(0))),
+            mesh.num_faces() * sizeof(Mesh::Face)),
+        hash);
+  }
+  hash = HashCombine(mesh.num_attributes(), hash);
+  for (int i = 0; i < mesh.num_attributes(); ++i) {
+    const PointAttribute &att = *mesh.attribute(i);
+    hash = HashCombine(static_cast<int>(att.attribute_type()), hash);
+    hash = HashCombine(static_cast<int>(att.data_type()), hash);
+    hash = HashCombine(att.num_components(), hash);
+    hash = HashCombine(att.size(), hash);
+    hash = HashCombine(att.is_mapping_identity(), hash);
+    if (!att.is_mapping_identity()) {
+      for (PointIndex pi(0); pi < mesh.num_points(); ++pi) {
+        hash = HashCombine(att.mapped_index(pi).value(), hash);
+      }
+    }
+    const std::pair<const char *, size_t> values = GetAttributeValues(att);
+    if (values.second > 0) {
+      hash = HashCombine(FingerprintString(values.first, values.second), hash);
+    }
+  }
+  return hash;
+}
+
+// Returns true if |mesh0| and |mesh1| contain exactly the same data. Both
+// meshes must pass CanDeduplicateMesh().
+bool MeshGeometryEquals(const Mesh &mesh0, const Mesh &mesh1) {
+  if (mesh0.num_points() != mesh1.num_points() ||
+      mesh0.num_faces() != mesh1.num_faces() ||
+      mesh0.num_attributes() != mesh1.num_attributes() ||
+      mesh0.GetName() != mesh1.GetName() ||
+      mesh0.IsCompressionEnabled() != mesh1.IsCompressionEnabled()) {
+    return false;
+  }
+  if (mesh0.IsCompressionEnabled() &&
+      !(mesh0.GetCompressionOptions() == mesh1.GetCompressionOptions())) {
+    return false;
+  }
+  if (mesh0.num_faces() > 0 &&
+      memcmp(&mesh0.face(FaceIndex(0)), &mesh1.face(FaceIndex(0)),
+             mesh0.num_faces() * sizeof(Mesh::Face)) != 0) {
+    return false;
+  }
+  for (int i = 0; i < mesh0.num_attributes(); ++i) {
+    const PointAttribute &att0 = *mesh0.attribute(i);
+    const PointAttribute &att1 = *mesh1.attribute(i);
+    if (att0.attribute_type() != att1.attribute_type() ||
+        att0.data_type() != att1.data_type() ||
+        att0.num_components() != att1.num_components() ||
+        att0.normalized() != att1.normalized() ||
+        att0.byte_stride() != att1.byte_stride() ||
+        att0.size() != att1.size() || att0.name() != att1.name()) {
+      return false;
+    }
+    for (PointIndex pi(0); pi < mesh0.num_points(); ++pi) {
+      if (att0.mapped_index(pi) != att1.mapped_index(pi)) {
+        return false;
+      }
+    }
+    const std::pair<const char *, size_t> values0 = GetAttributeValues(att0);
+    const std::pair<const char *, size_t> values1 = GetAttributeValues(att1);
+    if (values0.second > 0 &&
+        memcmp(values0.first, values1.first, values0.second) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+Status SceneUtils::DeduplicateMeshes(Scene *scene) {
+  if (scene->NumMeshes() <= 1) {
+    return OkStatus();
+  }
+
+  // Find duplicate meshes. The meshes are indexed by a hash of their content
+  // so each mesh is compared only with the unique meshes that have the same
+  // hash.
+  std::unordered_map<uint64_t, std::vector<MeshIndex>> unique_meshes;
+  IndexTypeVector<MeshIndex, MeshIndex> parent_mesh(scene->NumMeshes(),
+                                                    kInvalidMeshIndex);
+  bool has_duplicates = false;
+  for (MeshIndex mi(0); mi < scene->NumMeshes(); ++mi) {
+    const Mesh &mesh = scene->GetMesh(mi);
+    if (!CanDeduplicateMesh(mesh)) {
+      continue;
+    }
+    std::vector<MeshIndex> &candidates =
+        unique_meshes[ComputeMeshGeometryHash(mesh)];
+    for (const MeshIndex &candidate : candidates) {
+      if (MeshGeometryEquals(scene->GetMesh(candidate), mesh)) {
+        parent_mesh[mi] = candidate;
+        has_duplicates = true;
+        break;
+      }
+    }
+    if (parent_mesh[mi] == kInvalidMeshIndex) {
+      candidates.push_back(mi);
+    }
+  }
+  if (!has_duplicates) {
+    return OkStatus();
+  }
+
+  // Replace instances of duplicate meshes by instances of the unique meshes.
+  for (MeshGroupIndex mgi(0); mgi < scene->NumMeshGroups(); ++mgi) {
+    MeshGroup *const mesh_group = scene->GetMeshGroup(mgi);
+    for (int i = 0; i < mesh_group->NumMeshInstances(); ++i) {
+      MeshGroup::MeshInstance &instance = mesh_group->GetMeshInstance(i);
+      if (instance.mesh_index != kInvalidMeshIndex &&
+          parent_mesh[instance.mesh_index] != kInvalidMeshIndex) {
+        instance.mesh_index = parent_mesh[instance.mesh_index];
+      }
+    }
+  }
+
+  // Remove the duplicate meshes that are no longer referenced. All of them are
+  // removed at once so that the remaining meshes are moved only once.
+  IndexTypeVector<MeshIndex, bool> remove_mesh(scene->NumMeshes(), false);
+  for (MeshIndex mi(0); mi < scene->NumMeshes(); ++mi) {
+    remove_mesh[mi] = parent_mesh[mi] != kInvalidMeshIndex;
+  }
+  return scene->RemoveMeshes(remove_mesh);
+}
+
 void SceneUtils::SetDracoCompressionOptions(
     const DracoCompressionOptions *options, Scene *scene) {
   for (MeshIndex i(0); i < scene->NumMeshes(); ++i) {
@@ -142,6 +142,16 @@ class SceneUtils {
   // exactly the same meshes and materials.
   static void DeduplicateMeshGroups(Scene *scene);
 
+  // Finds base meshes with exactly the same content, such as the same
+  // geometry referenced from different glTF accessors, and replaces all
+  // instances of the duplicates by instances of the first such mesh. The
+  // duplicate meshes are removed from the |scene|. Meshes are indexed by a
+  // hash of their faces and attribute values, so the duplicates are found in
+  // linear time. Meshes with mesh features, structural metadata, metadata, or
+  // transformed attributes are left untouched. Running this function before
+  // compression avoids compressing the same geometry multiple times.
+  static Status DeduplicateMeshes(Scene *scene);
+
   // Enables geometry compression and sets compression |options| to all meshes
   // in the |scene|. If |options| is nullptr then geometry compression is
   // disabled for all meshes in the |scene|.
@@ -0,0 +1,135 @@
+// Copyright 2026 The Draco Authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "draco/draco_features.h"
+
+#ifdef DRACO_TRANSCODER_SUPPORTED
+#include <memory>
+
+#include "benchmark/benchmark.h"
+#include "draco/mesh/triangle_soup_mesh_builder.h"
+#include "draco/scene/scene.h"
+#include "draco/scene/scene_utils.h"
+
+namespace draco {
+namespace {
+
+// Returns a scene with |num_meshes| single triangle base meshes. Each base
+// mesh is instanced by its own mesh group and two of every three base meshes
+// are duplicates of the mesh before them.
+std::unique_ptr<Scene> CreateSceneWithDuplicateMeshes(int num_meshes) {
+  std::unique_ptr<Scene> scene(new Scene());
+  for (int i = 0; i < num_meshes; ++i) {
+    TriangleSoupMeshBuilder builder;
+    builder.Start(1);
+    const int pos_att_id =
+        builder.AddAttribute(GeometryAttribute::POSITION, 3, DT_FLOAT32);
+    const float offset = static_cast<float>(i / 3);
+    const Vector3f p0(offset, 0.f, 0.f);
+    const Vector3f p1(offset + 1.f, 0.f, 0.f);
+    const Vector3f p2(offset, 1.f, 0.f);
+    builder.SetAttributeValuesForFace(pos_att_id, FaceIndex(0), p0.data(),
+                                      p1.data(), p2.data());
+    const MeshIndex mesh_index = scene->AddMesh(builder.Finalize());
+    const MeshGroupIndex mesh_group_index = scene->AddMeshGroup();
+    scene->GetMeshGroup(mesh_group_index)
+        ->AddMeshInstance(MeshGroup::MeshInstance(mesh_index, -1));
+  }
+  return scene;
+}
+
+// Returns the flags of the duplicate meshes of a scene created by
+// CreateSceneWithDuplicateMeshes().
+IndexTypeVector<MeshIndex, bool> GetDuplicateMeshes(int num_meshes) {
+  IndexTypeVector<MeshIndex, bool> remove_mesh(num_meshes, false);
+  for (MeshIndex mi(0); mi < num_meshes; ++mi) {
+    remove_mesh[mi] = mi.value() % 3 != 0;
+  }
+  return remove_mesh;
+}
+
+void BM_DeduplicateMeshes(benchmark::State &state) {
+  const int num_meshes = state.range(0);
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<Scene> scene = CreateSceneWithDuplicateMeshes(num_meshes);
+    state.ResumeTiming();
+    if (!SceneUtils::DeduplicateMeshes(scene.get()).ok()) {
+      state.SkipWithError("Failed to deduplicate the meshes.");
+      return;
+    }
+    benchmark::DoNotOptimize(scene->NumMeshes());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          num_meshes);
+}
+BENCHMARK(BM_DeduplicateMeshes)
+    ->Arg(3000)
+    ->Arg(30000)
+    ->Unit(benchmark::kMillisecond);
+
+// Removes the duplicate meshes with a single Scene::RemoveMeshes() call.
+void BM_RemoveMeshes(benchmark::State &state) {
+  const int num_meshes = state.range(0);
+  const IndexTypeVector<MeshIndex, bool> remove_mesh =
+      GetDuplicateMeshes(num_meshes);
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<Scene> scene = CreateSceneWithDuplicateMeshes(num_meshes);
+    state.ResumeTiming();
+    if (!scene->RemoveMeshes(remove_mesh).ok()) {
+      state.SkipWithError("Failed to remove the meshes.");
+      return;
+    }
+    benchmark::DoNotOptimize(scene->NumMeshes());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          num_meshes);
+}
+BENCHMARK(BM_RemoveMeshes)
+    ->Arg(3000)
+    ->Arg(30000)
+    ->Unit(benchmark::kMillisecond);
+
+// Removes the same meshes as BM_RemoveMeshes with one Scene::RemoveMesh() call
+// per mesh for comparison.
+void BM_RemoveMeshOneByOne(benchmark::State &state) {
+  const int num_meshes = state.range(0);
+  const IndexTypeVector<MeshIndex, bool> remove_mesh =
+      GetDuplicateMeshes(num_meshes);
+  for (auto _ : state) {
+    state.PauseTiming();
+    std::unique_ptr<Scene> scene = CreateSceneWithDuplicateMeshes(num_meshes);
+    state.ResumeTiming();
+    for (int i = num_meshes - 1; i >= 0; --i) {
+      const MeshIndex mi(i);
+      if (remove_mesh[mi] && !scene->RemoveMesh(mi).ok()) {
+        state.SkipWithError("Failed to remove the mesh.");
+        return;
+      }
+    }
+    benchmark::DoNotOptimize(scene->NumMeshes());
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          num_meshes);
+}
+BENCHMARK(BM_RemoveMeshOneByOne)
+    ->Arg(3000)
+    ->Arg(30000)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace draco
+
+#endif  // DRACO_TRANSCODER_SUPPORTED
@@ -677,6 +677,51 @@ TEST(SceneUtilsTest, TestDeduplicateMeshGroups) {
   ASSERT_EQ(draco::SceneUtils::ComputeAllInstances(*scene).size(), 7);
 }
 
+TEST(SceneUtilsTest, TestDeduplicateMeshes) {
+  // Input scene has a single base mesh that is used by four mesh groups.
+  auto scene =
+      draco::ReadSceneFromTestFile("DuplicateMeshes/duplicate_meshes.gltf");
+  ASSERT_NE(scene, nullptr);
+  ASSERT_EQ(scene->NumMeshes(), 1);
+  ASSERT_EQ(scene->NumMeshGroups(), 4);
+  ASSERT_EQ(draco::SceneUtils::ComputeAllInstances(*scene).size(), 7);
+
+  // Make all mesh groups but the first one reference their own copy of the
+  // base mesh. Position of the copy in the last mesh group is modified.
+  for (draco::MeshGroupIndex mgi(1); mgi < scene->NumMeshGroups(); ++mgi) {
+    std::unique_ptr<draco::Mesh> mesh(new draco::Mesh());
+    mesh->Copy(scene->GetMesh(MeshIndex(0)));
+    if (mgi == scene->NumMeshGroups() - 1) {
+      draco::PointAttribute *const pos_att = mesh->attribute(
+          mesh->GetNamedAttributeId(draco::GeometryAttribute::POSITION));
+      float pos[3];
+      pos_att->GetValue(draco::AttributeValueIndex(0), pos);
+      pos[0] += 1.f;
+      pos_att->SetAttributeValue(draco::AttributeValueIndex(0), pos);
+    }
+    const MeshIndex mesh_index = scene->AddMesh(std::move(mesh));
+    draco::MeshGroup *const mesh_group = scene->GetMeshGroup(mgi);
+    for (int i = 0; i < mesh_group->NumMeshInstances(); ++i) {
+      mesh_group->GetMeshInstance(i).mesh_index = mesh_index;
+    }
+  }
+  ASSERT_EQ(scene->NumMeshes(), 4);
+
+  DRACO_ASSERT_OK(draco::SceneUtils::DeduplicateMeshes(scene.get()));
+
+  // Only the modified mesh should remain in addition to the base mesh.
+  ASSERT_EQ(scene->NumMeshes(), 2);
+  ASSERT_EQ(scene->NumMeshGroups(), 4);
+  ASSERT_EQ(draco::SceneUtils::ComputeAllInstances(*scene).size(), 7);
+  for (draco::MeshGroupIndex mgi(0); mgi < scene->NumMeshGroups(); ++mgi) {
+    const draco::MeshGroup *const mesh_group = scene->GetMeshGroup(mgi);
+    const MeshIndex expected_index(mgi == scene->NumMeshGroups() - 1 ? 1 : 0);
+    for (int i = 0; i < mesh_group->NumMeshInstances(); ++i) {
+      ASSERT_EQ(mesh_group->GetMeshInstance(i).mesh_index, expected_index);
+    }
+  }
+}
+
 TEST(SceneUtilsTest, TestCleanupUnusedTexCoordsNoTextures) {
   // The glTF file has two tex coords that are unused because the materials do
   // not reference any textures.
@@ -13,13 +13,16 @@
 // limitations under the License.
 //
 #include <cinttypes>
+#include <cstdio>
 #include <cstdlib>
+#include <memory>
 
 #include "draco/compression/config/compression_shared.h"
 #include "draco/compression/encode.h"
 #include "draco/compression/expert_encode.h"
 #include "draco/core/cycle_timer.h"
 #include "draco/io/file_utils.h"
+#include "draco/io/file_writer_factory.h"
 #include "draco/io/mesh_io.h"
 #include "draco/io/point_cloud_io.h"
 
@@ -146,51 +149,79 @@ void PrintOptions(const draco::PointCloud &pc, const Options &options) {
   printf("\n");
 }
 
+// Encodes the geometry of |encoder| into |file|. The encoded data is streamed
+// into a temporary file that replaces |file| only when the encoding succeeds,
+// so that a failed encoding does not leave a truncated file behind.
+draco::Status EncodeToFile(const std::string &file,
+                           draco::ExpertEncoder *encoder,
+                           size_t *encoded_size) {
+  const std::string temp_file = file + ".tmp";
+  std::unique_ptr<draco::FileWriterInterface> file_writer =
+      draco::FileWriterFactory::OpenWriter(temp_file);
+  if (file_writer == nullptr) {
+    return draco::Status(draco::Status::IO_ERROR,
+                         "Failed to create the output file.");
+  }
+  draco::EncoderBuffer buffer;
+  draco::SetEncoderBufferOutput(file_writer.get(), &buffer);
+  draco::Status status = encoder->EncodeToBuffer(&buffer);
+  // Close the file before it is renamed or removed. Data that fails to be
+  // flushed must not replace |file|.
+  if (!file_writer->Close() && status.ok()) {
+    status = draco::Status(draco::Status::IO_ERROR,
+                           "Failed to write the output file.");
+  }
+  if (status.ok()) {
+#ifdef _WIN32
+    // std::rename() does not replace existing files on Windows.
+    std::remove(file.c_str());
+#endif
+    if (std::rename(temp_file.c_str(), file.c_str()) != 0) {
+      status = draco::Status(draco::Status::IO_ERROR,
+                             "Failed to write the output file.");
+    }
+  }
+  if (!status.ok()) {
+    std::remove(temp_file.c_str());
+    return status;
+  }
+  *encoded_size = buffer.num_flushed_bytes();
+  return draco::OkStatus();
+}
+
 int EncodePointCloudToFile(const draco::PointCloud &pc, const std::string &file,
                            draco::ExpertEncoder *encoder) {
   draco::CycleTimer timer;
-  // Encode the geometry.
-  draco::EncoderBuffer buffer;
+  size_t encoded_size = 0;
   timer.Start();
-  const draco::Status status = encoder->EncodeToBuffer(&buffer);
+  const draco::Status status = EncodeToFile(file, encoder, &encoded_size);
   if (!status.ok()) {
     printf("Failed to encode the point cloud.\n");
     printf("%s\n", status.error_msg());
     return -1;
   }
   timer.Stop();
-  // Save the encoded geometry into a file.
-  if (!draco::WriteBufferToFile(buffer.data(), buffer.size(), file)) {
-    printf("Failed to write the output file.\n");
-    return -1;
-  }
   printf("Encoded point cloud saved to %s (%" PRId64 " ms to encode).\n",
          file.c_str(), timer.GetInMs());
-  printf("\nEncoded size = %zu bytes\n\n", buffer.size());
+  printf("\nEncoded size = %zu bytes\n\n", encoded_size);
   return 0;
 }
 
 int EncodeMeshToFile(const draco::Mesh &mesh, const std::string &file,
                      draco::ExpertEncoder *encoder) {
   draco::CycleTimer timer;
-  // Encode the geometry.
-  draco::EncoderBuffer buffer;
+  size_t encoded_size = 0;
   timer.Start();
-  const draco::Status status = encoder->EncodeToBuffer(&buffer);
+  const draco::Status status = EncodeToFile(file, encoder, &encoded_size);
   if (!status.ok()) {
     printf("Failed to encode the mesh.\n");
     printf("%s\n", status.error_msg());
     return -1;
   }
   timer.Stop();
-  // Save the encoded geometry into a file.
-  if (!draco::WriteBufferToFile(buffer.data(), buffer.size(), file)) {
-    printf("Failed to create the output file.\n");
-    return -1;
-  }
   printf("Encoded mesh saved to %s (%" PRId64 " ms to encode).\n", file.c_str(),
          timer.GetInMs());
-  printf("\nEncoded size = %zu bytes\n\n", buffer.size());
+  printf("\nEncoded size = %zu bytes\n\n", encoded_size);
   return 0;
 }
 
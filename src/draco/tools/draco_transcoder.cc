@@ -14,10 +14,15 @@
 //
 #include <cinttypes>
 #include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
 
 #include "draco/core/cycle_timer.h"
 #include "draco/core/status.h"
+#include "draco/core/status_or.h"
 #include "draco/draco_features.h"
+#include "draco/io/file_utils.h"
 #include "draco/texture/texture_utils.h"
 #include "draco/tools/draco_transcoder_lib.h"
 
@@ -26,7 +31,8 @@ namespace {
 // TODO(fgalligan): Add support for no compression to the transcoder lib.
 void Usage() {
   // TODO(b/204212351): Revisit using a raw string literal here for readability.
-  printf("Usage: draco_transcoder [options] -i input -o output\n\n");
+  printf("Usage: draco_transcoder [options] -i input -o output\n");
+  printf("       draco_transcoder [options] -manifest manifest\n\n");
   printf("Main options:\n");
   printf("  -h | -?         show help.\n");
   printf("  -i <input>      input file name.\n");
@@ -45,6 +51,20 @@ void Usage() {
   printf("default=8.\n");
   printf("  -qg <value>     quantization bits for any generic attribute, ");
   printf("default=8.\n");
+  printf("  -threads <value> maximum number of threads used for decoding and ");
+  printf("compressing\n");
+  printf("                   the meshes, default=1.\n");
+  printf("  -deduplicate_meshes merge base meshes with identical content, ");
+  printf("default=false.\n");
+  printf("\nBatch options:\n");
+  printf("  -manifest <file> text file with one input and output file name ");
+  printf("per line,\n");
+  printf("                   separated by whitespace.\n");
+  printf("  -jobs <value>   number of files transcoded concurrently, ");
+  printf("default=1.\n");
+  printf("  -memory_budget <value> approximate limit in MB of the input files");
+  printf(" that are\n");
+  printf("                   transcoded concurrently, default=0 (no limit).\n");
 
   printf("\nBoolean options may be negated by prefixing 'no'.\n");
 }
@@ -76,11 +96,79 @@ draco::Status TranscodeFile(
   return draco::OkStatus();
 }
 
+// Reads input and output file names from |manifest_filename|. Empty lines and
+// lines starting with '#' are ignored.
+draco::Status ReadManifest(
+    const std::string &manifest_filename,
+    std::vector<draco::DracoTranscoder::FileOptions> *files) {
+  std::string contents;
+  if (!draco::ReadFileToString(manifest_filename, &contents)) {
+    return draco::Status(draco::Status::DRACO_ERROR,
+                         "Failed to read manifest.");
+  }
+  std::istringstream manifest(contents);
+  std::string line;
+  while (std::getline(manifest, line)) {
+    std::istringstream line_stream(line);
+    draco::DracoTranscoder::FileOptions file_options;
+    if (!(line_stream >> file_options.input_filename) ||
+        file_options.input_filename[0] == '#') {
+      continue;
+    }
+    if (!(line_stream >> file_options.output_filename)) {
+      return draco::Status(draco::Status::DRACO_ERROR,
+                           "Missing output file name in manifest line: " +
+                               line);
+    }
+    files->push_back(file_options);
+  }
+  return draco::OkStatus();
+}
+
+// Transcodes all files listed in |manifest_filename| and prints the results.
+// Returns the number of files that failed.
+draco::StatusOr<int> TranscodeManifest(
+    const std::string &manifest_filename,
+    const draco::DracoTranscodingOptions &transcode_options,
+    const draco::DracoTranscoder::BatchOptions &batch_options) {
+  std::vector<draco::DracoTranscoder::FileOptions> files;
+  DRACO_RETURN_IF_ERROR(ReadManifest(manifest_filename, &files));
+
+  draco::CycleTimer timer;
+  timer.Start();
+  std::vector<draco::DracoTranscoder::FileStats> stats;
+  DRACO_RETURN_IF_ERROR(draco::DracoTranscoder::TranscodeBatch(
+      transcode_options, batch_options, files, &stats));
+  timer.Stop();
+
+  int num_failed = 0;
+  printf("Result\tFile\tRead ms\tCompress ms\tWrite ms\tInput bytes\t");
+  printf("Output bytes\n");
+  for (size_t i = 0; i < files.size(); ++i) {
+    const draco::DracoTranscoder::FileStats &file_stats = stats[i];
+    if (!file_stats.status.ok()) {
+      printf("Failed\t%s\t%s\n", files[i].input_filename.c_str(),
+             file_stats.status.error_msg());
+      ++num_failed;
+      continue;
+    }
+    printf("Transcode\t%s\t%" PRId64 "\t%" PRId64 "\t%" PRId64 "\t%zu\t%zu\n",
+           files[i].input_filename.c_str(), file_stats.read_time_ms,
+           file_stats.compress_time_ms, file_stats.write_time_ms,
+           file_stats.input_size, file_stats.output_size);
+  }
+  printf("Batch\t%zu files\t%d failed\t%" PRId64 " ms\n", files.size(),
+         num_failed, timer.GetInMs());
+  return num_failed;
+}
+
 }  // anonymous namespace
 
 int main(int argc, char **argv) {
   draco::DracoTranscoder::FileOptions file_options;
   draco::DracoTranscodingOptions transcode_options;
+  draco::DracoTranscoder::BatchOptions batch_options;
+  std::string manifest_filename;
   const int argc_check = argc - 1;
 
   for (int i = 1; i < argc; ++i) {
@@ -112,7 +200,36 @@ int main(int argc, char **argv) {
     } else if (!strcmp("-qg", argv[i]) && i < argc_check) {
       transcode_options.geometry.quantization_bits_generic =
           StringToInt(argv[++i]);
+    } else if (!strcmp("-threads", argv[i]) && i < argc_check) {
+      transcode_options.num_compression_threads = StringToInt(argv[++i]);
+      transcode_options.num_decoding_threads =
+          transcode_options.num_compression_threads;
+    } else if (MatchesBooleanOption("deduplicate_meshes", argv[i])) {
+      transcode_options.deduplicate_meshes = strncmp("-no", argv[i], 3) != 0;
+    } else if (!strcmp("-manifest", argv[i]) && i < argc_check) {
+      manifest_filename = argv[++i];
+    } else if (!strcmp("-jobs", argv[i]) && i < argc_check) {
+      batch_options.num_workers = StringToInt(argv[++i]);
+    } else if (!strcmp("-memory_budget", argv[i]) && i < argc_check) {
+      batch_options.memory_budget =
+          static_cast<int64_t>(StringToInt(argv[++i])) * 1024 * 1024;
+    }
+  }
+  if (!manifest_filename.empty()) {
+    if (!file_options.input_filename.empty() ||
+        !file_options.output_filename.empty()) {
+      printf("-manifest cannot be combined with -i or -o.\n");
+      Usage();
+      return -1;
+    }
+    const draco::StatusOr<int> num_failed =
+        TranscodeManifest(manifest_filename, transcode_options, batch_options);
+    if (!num_failed.ok()) {
+      printf("Failed\t%s\t%s\n", manifest_filename.c_str(),
+             num_failed.status().error_msg());
+      return -1;
     }
+    return num_failed.value() == 0 ? 0 : -1;
   }
   if (argc < 3 || file_options.input_filename.empty() ||
       file_options.output_filename.empty()) {
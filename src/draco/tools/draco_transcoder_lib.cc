@@ -15,7 +15,17 @@
 #include "draco/tools/draco_transcoder_lib.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "draco/core/cycle_timer.h"
 #include "draco/core/status_or.h"
+#include "draco/core/thread_pool.h"
 #include "draco/io/file_utils.h"
 #include "draco/io/scene_io.h"
 #include "draco/scene/scene_utils.h"
@@ -23,13 +33,116 @@
 
 namespace draco {
 
+namespace {
+
+// Limits the total estimated memory of the files that are transcoded at the
+// same time. See DracoTranscoder::BatchOptions::memory_budget.
+class MemoryBudget {
+ public:
+  explicit MemoryBudget(int64_t budget)
+      : budget_(budget), used_(0), num_users_(0) {}
+
+  // Blocks until |bytes| fit into the budget or until nothing else is using
+  // the budget.
+  void Acquire(int64_t bytes) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    released_.wait(lock, [this, bytes] {
+      return budget_ <= 0 || num_users_ == 0 || used_ + bytes <= budget_;
+    });
+    used_ += bytes;
+    ++num_users_;
+  }
+
+  // Changes the acquired memory of a user by |bytes| (can be negative)
+  // without blocking. Used when the memory is already allocated.
+  void Charge(int64_t bytes) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      used_ += bytes;
+    }
+    released_.notify_all();
+  }
+
+  void Release(int64_t bytes) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      used_ -= bytes;
+      --num_users_;
+    }
+    released_.notify_all();
+  }
+
+ private:
+  const int64_t budget_;
+  int64_t used_;
+  int num_users_;
+  std::mutex mutex_;
+  std::condition_variable released_;
+};
+
+// Returns the total size of all distinct |files|.
+size_t GetFilesSize(const std::vector<std::string> &files) {
+  const std::set<std::string> distinct_files(files.begin(), files.end());
+  size_t size = 0;
+  for (const std::string &file : distinct_files) {
+    size += GetFileSize(file);
+  }
+  return size;
+}
+
+// Returns the approximate number of bytes used by the meshes and textures of
+// |scene|.
+int64_t GetSceneMemorySize(const Scene &scene) {
+  int64_t size = 0;
+  for (MeshIndex i(0); i < scene.NumMeshes(); ++i) {
+    const Mesh &mesh = scene.GetMesh(i);
+    size += static_cast<int64_t>(mesh.num_faces()) * sizeof(Mesh::Face);
+    for (int j = 0; j < mesh.num_attributes(); ++j) {
+      const PointAttribute *const att = mesh.attribute(j);
+      if (att->buffer() != nullptr) {
+        size += att->buffer()->data_size();
+      }
+      size += att->indices_map_size() * sizeof(AttributeValueIndex);
+    }
+  }
+  const TextureLibrary &textures =
+      scene.GetMaterialLibrary().GetTextureLibrary();
+  for (int i = 0; i < static_cast<int>(textures.NumTextures()); ++i) {
+    size += textures.GetTexture(i)->source_image().encoded_data().size();
+  }
+  return size;
+}
+
+// Returns the size of all files written for |file_options|.
+size_t GetOutputSize(const DracoTranscoder::FileOptions &file_options) {
+  size_t output_size = GetFileSize(file_options.output_filename);
+  if (!file_options.output_bin_filename.empty()) {
+    output_size += GetFileSize(file_options.output_bin_filename);
+  } else if (LowercaseFileExtension(file_options.output_filename) == "gltf") {
+    output_size += GetFileSize(
+        ReplaceFileExtension(file_options.output_filename, "bin"));
+  }
+  return output_size;
+}
+
+}  // namespace
+
 DracoTranscoder::DracoTranscoder() {}
 
 StatusOr<std::unique_ptr<DracoTranscoder>> DracoTranscoder::Create(
     const DracoTranscodingOptions &options) {
   DRACO_RETURN_IF_ERROR(options.geometry.Check());
+  if (options.num_compression_threads < 1) {
+    return Status(Status::DRACO_ERROR,
+                  "Invalid number of compression threads.");
+  }
+  if (options.num_decoding_threads < 1) {
+    return Status(Status::DRACO_ERROR, "Invalid number of decoding threads.");
+  }
   std::unique_ptr<DracoTranscoder> dt(new DracoTranscoder());
   dt->transcoding_options_ = options;
+  dt->gltf_encoder_.set_num_compression_threads(
+      options.num_compression_threads);
   return dt;
 }
 
@@ -41,20 +154,112 @@ StatusOr<std::unique_ptr<DracoTranscoder>> DracoTranscoder::Create(
 }
 
 Status DracoTranscoder::Transcode(const FileOptions &file_options) {
-  DRACO_RETURN_IF_ERROR(ReadScene(file_options));
+  DRACO_RETURN_IF_ERROR(ReadScene(file_options, nullptr));
   DRACO_RETURN_IF_ERROR(CompressScene());
   DRACO_RETURN_IF_ERROR(WriteScene(file_options));
   return OkStatus();
 }
 
-Status DracoTranscoder::ReadScene(const FileOptions &file_options) {
+Status DracoTranscoder::TranscodeBatch(const DracoTranscodingOptions &options,
+                                       const BatchOptions &batch_options,
+                                       const std::vector<FileOptions> &files,
+                                       std::vector<FileStats> *stats) {
+  if (batch_options.num_workers < 1) {
+    return Status(Status::DRACO_ERROR, "Invalid number of workers.");
+  }
+  if (batch_options.memory_budget < 0) {
+    return Status(Status::DRACO_ERROR, "Invalid memory budget.");
+  }
+  // Fail early on invalid compression options.
+  DRACO_RETURN_IF_ERROR(Create(options).status());
+
+  stats->clear();
+  stats->resize(files.size());
+  MemoryBudget memory_budget(batch_options.memory_budget);
+  std::atomic<size_t> next_file(0);
+  CycleTimer batch_timer;
+  batch_timer.Start();
+  // Returns the time in milliseconds since the start of the batch.
+  const auto get_batch_time_ms = [&batch_timer]() {
+    CycleTimer timer = batch_timer;
+    timer.Stop();
+    return timer.GetInMs();
+  };
+
+  // Each worker owns a transcoder and takes the files in order, so that
+  // the files that are in flight at the same time are spread across the
+  // read, compress, and write stages.
+  auto worker = [&]() {
+    std::unique_ptr<DracoTranscoder> dt = Create(options).value();
+    std::vector<std::string> scene_files;
+    for (size_t i = next_file++; i < files.size(); i = next_file++) {
+      const FileOptions &file_options = files[i];
+      FileStats &file_stats = (*stats)[i];
+      file_stats.input_size = GetFileSize(file_options.input_filename);
+      // The files referenced by the input file (such as .bin buffers and
+      // textures of .gltf files) are known only after the file is read, so
+      // the memory is first estimated from the input file alone. See
+      // BatchOptions::memory_budget.
+      int64_t memory = static_cast<int64_t>(file_stats.input_size);
+      memory_budget.Acquire(memory);
+      file_stats.start_time_ms = get_batch_time_ms();
+
+      CycleTimer timer;
+      timer.Start();
+      scene_files.clear();
+      file_stats.status = dt->ReadScene(file_options, &scene_files);
+      timer.Stop();
+      file_stats.read_time_ms = timer.GetInMs();
+      if (file_stats.status.ok()) {
+        file_stats.input_size = GetFilesSize(scene_files);
+        const int64_t scene_memory =
+            std::max(static_cast<int64_t>(file_stats.input_size),
+                     GetSceneMemorySize(*dt->scene_));
+        memory_budget.Charge(scene_memory - memory);
+        memory = scene_memory;
+
+        timer.Start();
+        file_stats.status = dt->CompressScene();
+        timer.Stop();
+        file_stats.compress_time_ms = timer.GetInMs();
+      }
+      if (file_stats.status.ok()) {
+        timer.Start();
+        file_stats.status = dt->WriteScene(file_options);
+        timer.Stop();
+        file_stats.write_time_ms = timer.GetInMs();
+      }
+      // Free the scene before giving its memory back to the budget.
+      dt->scene_.reset();
+      file_stats.end_time_ms = get_batch_time_ms();
+      memory_budget.Release(memory);
+      if (file_stats.status.ok()) {
+        file_stats.output_size = GetOutputSize(file_options);
+      }
+    }
+  };
+
+  ThreadPool pool(batch_options.num_workers);
+  for (int i = 0; i < pool.num_threads(); ++i) {
+    pool.Schedule(worker);
+  }
+  pool.Wait();
+  return OkStatus();
+}
+
+Status DracoTranscoder::ReadScene(const FileOptions &file_options,
+                                  std::vector<std::string> *scene_files) {
   if (file_options.input_filename.empty()) {
     return Status(Status::DRACO_ERROR, "Input filename is empty.");
   } else if (file_options.output_filename.empty()) {
     return Status(Status::DRACO_ERROR, "Output filename is empty.");
   }
-  DRACO_ASSIGN_OR_RETURN(scene_,
-                         ReadSceneFromFile(file_options.input_filename));
+  Options read_options;
+  read_options.SetInt("num_decoding_threads",
+                      transcoding_options_.num_decoding_threads);
+  DRACO_ASSIGN_OR_RETURN(
+      scene_, ReadSceneFromFile(file_options.input_filename, read_options,
+                                scene_files));
   return OkStatus();
 }
 
@@ -76,6 +281,10 @@ Status DracoTranscoder::WriteScene(const FileOptions &file_options) {
 }
 
 Status DracoTranscoder::CompressScene() {
+  if (transcoding_options_.deduplicate_meshes) {
+    DRACO_RETURN_IF_ERROR(SceneUtils::DeduplicateMeshes(scene_.get()));
+  }
+
   // Apply geometry compression settings to all scene meshes.
   SceneUtils::SetDracoCompressionOptions(&transcoding_options_.geometry,
                                          scene_.get());
@@ -18,7 +18,9 @@
 #include "draco/draco_features.h"
 
 #ifdef DRACO_TRANSCODER_SUPPORTED
+#include <cstdint>
 #include <string>
+#include <vector>
 
 #include "draco/compression/draco_compression_options.h"
 #include "draco/core/options.h"
@@ -33,6 +35,22 @@ struct DracoTranscodingOptions {
 
   // Options used when geometry compression optimization is disabled.
   DracoCompressionOptions geometry;
+
+  // Maximum number of threads used for compressing the meshes of a scene.
+  // The meshes are compressed concurrently when greater than one. The output
+  // does not depend on the number of threads. Must be at least 1.
+  int num_compression_threads = 1;
+
+  // Maximum number of threads used for building the meshes of the input glTF
+  // primitives. The decoded scene does not depend on the number of threads.
+  // Must be at least 1.
+  int num_decoding_threads = 1;
+
+  // When true, base meshes with identical content are merged before
+  // compression so that the shared geometry is compressed only once. This
+  // changes the meshes of the output glTF and is therefore off by default. See
+  // SceneUtils::DeduplicateMeshes().
+  bool deduplicate_meshes = false;
 };
 
 // Class that supports input of glTF (and some simple USD) files, encodes
@@ -60,6 +78,42 @@ class DracoTranscoder {
     std::string output_resource_directory = "";
   };
 
+  // Options for transcoding a batch of files with TranscodeBatch().
+  struct BatchOptions {
+    // Number of files that are transcoded concurrently. Must be at least 1.
+    int num_workers = 1;
+
+    // Approximate limit in bytes of the memory used by the files that are
+    // transcoded at the same time. Before a file is read, its memory is
+    // estimated from the size of the input file. A worker does not start
+    // reading a file while the estimate would exceed the budget, but a file
+    // larger than the budget is still transcoded when no other file is in
+    // flight. Once the file is read, the estimate is replaced by the larger of
+    // the total size of all files the scene was read from (including .bin
+    // buffers and textures referenced by .gltf files) and the size of the
+    // decoded meshes and textures. The corrected estimate does not stop the
+    // file that is already in memory, but it delays the reading of the next
+    // files. Zero means no limit.
+    int64_t memory_budget = 0;
+  };
+
+  // Result of transcoding a single file with TranscodeBatch().
+  struct FileStats {
+    Status status;
+    int64_t read_time_ms = 0;
+    int64_t compress_time_ms = 0;
+    int64_t write_time_ms = 0;
+    // Time in milliseconds since the start of TranscodeBatch() when the file
+    // started to be read and when its memory was released.
+    int64_t start_time_ms = 0;
+    int64_t end_time_ms = 0;
+    // Size of the input file including all files referenced by it, such as
+    // .bin buffers and textures of .gltf files.
+    size_t input_size = 0;
+    // Size of the output glTF file including its .bin buffer.
+    size_t output_size = 0;
+  };
+
   DracoTranscoder();
 
   // Creates a DracoTranscoder object. |options| sets the compression options
@@ -77,9 +131,23 @@ class DracoTranscoder {
   // transcoder once and call Transcode for multiple files.
   Status Transcode(const FileOptions &file_options);
 
+  // Transcodes all |files| with compression |options|. The files are
+  // processed by |batch_options.num_workers| threads, each with its own
+  // transcoder, so that reading and writing of some files overlaps with
+  // compression of others. Results of the files are stored in |stats| in the
+  // same order as |files|. A failure of an individual file is reported in its
+  // FileStats::status and does not stop the other files. Returns an error
+  // only when the options are invalid.
+  static Status TranscodeBatch(const DracoTranscodingOptions &options,
+                               const BatchOptions &batch_options,
+                               const std::vector<FileOptions> &files,
+                               std::vector<FileStats> *stats);
+
  private:
-  // Read scene from file.
-  Status ReadScene(const FileOptions &file_options);
+  // Read scene from file. All files the scene was read from are added to
+  // |scene_files| (can be nullptr).
+  Status ReadScene(const FileOptions &file_options,
+                   std::vector<std::string> *scene_files);
 
   // Write scene to file.
   Status WriteScene(const FileOptions &file_options);
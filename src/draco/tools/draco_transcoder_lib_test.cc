@@ -16,6 +16,11 @@
 
 #include "draco/tools/draco_transcoder_lib.h"
 
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "draco/core/draco_test_base.h"
 #include "draco/core/draco_test_utils.h"
 #include "draco/io/file_utils.h"
@@ -169,4 +174,97 @@ TEST(DracoTranscoderTest, TestPositionQuantization) {
   ASSERT_GT(first_glb_size, second_glb_size);
 }
 
+// Tests that the transcoded output does not depend on the number of threads
+// used for decoding and compressing the meshes.
+TEST(DracoTranscoderTest, TranscodeWithMultipleThreads) {
+  draco::DracoTranscoder::FileOptions file_options;
+  file_options.input_filename =
+      draco::GetTestFileFullPath("CesiumMilkTruck/glTF/CesiumMilkTruck.gltf");
+
+  std::vector<char> outputs[2];
+  const int num_threads[2] = {1, 4};
+  for (int i = 0; i < 2; ++i) {
+    draco::DracoTranscodingOptions options;
+    options.num_decoding_threads = num_threads[i];
+    options.num_compression_threads = num_threads[i];
+    DRACO_ASSIGN_OR_ASSERT(std::unique_ptr<draco::DracoTranscoder> dt,
+                           draco::DracoTranscoder::Create(options));
+    file_options.output_filename = draco::GetTestTempFileFullPath(
+        "threads" + std::to_string(num_threads[i]) + ".glb");
+    DRACO_ASSERT_OK(dt->Transcode(file_options));
+    ASSERT_TRUE(
+        draco::ReadFileToBuffer(file_options.output_filename, &outputs[i]));
+  }
+  ASSERT_FALSE(outputs[0].empty());
+  ASSERT_EQ(outputs[0], outputs[1]);
+
+  // Invalid number of threads.
+  draco::DracoTranscodingOptions options;
+  options.num_decoding_threads = 0;
+  ASSERT_FALSE(draco::DracoTranscoder::Create(options).ok());
+  options.num_decoding_threads = 1;
+  options.num_compression_threads = 0;
+  ASSERT_FALSE(draco::DracoTranscoder::Create(options).ok());
+}
+
+// Tests transcoding multiple files concurrently, including a file that fails.
+TEST(DracoTranscoderTest, TranscodeBatch) {
+  std::vector<draco::DracoTranscoder::FileOptions> files(3);
+  files[0].input_filename = draco::GetTestFileFullPath("sphere.gltf");
+  files[0].output_filename = draco::GetTestTempFileFullPath("batch0.gltf");
+  files[1].input_filename = draco::GetTestFileFullPath("missing.gltf");
+  files[1].output_filename = draco::GetTestTempFileFullPath("batch1.gltf");
+  files[2].input_filename = draco::GetTestFileFullPath(
+      "KhronosSampleModels/Duck/glTF_Binary/Duck.glb");
+  files[2].output_filename = draco::GetTestTempFileFullPath("batch2.glb");
+
+  const draco::DracoTranscodingOptions options;
+  draco::DracoTranscoder::BatchOptions batch_options;
+  batch_options.num_workers = 2;
+  // Smaller than the input files so that the files are transcoded one by one.
+  batch_options.memory_budget = 1;
+  std::vector<draco::DracoTranscoder::FileStats> stats;
+  DRACO_ASSERT_OK(draco::DracoTranscoder::TranscodeBatch(options, batch_options,
+                                                         files, &stats));
+  ASSERT_EQ(stats.size(), files.size());
+  DRACO_ASSERT_OK(stats[0].status);
+  ASSERT_FALSE(stats[1].status.ok());
+  DRACO_ASSERT_OK(stats[2].status);
+  // The input size includes the buffer and the textures of the .gltf file.
+  ASSERT_EQ(stats[0].input_size,
+            draco::GetFileSize(files[0].input_filename) +
+                draco::GetFileSize(
+                    draco::GetTestFileFullPath("sphere_buffer0.bin")) +
+                draco::GetFileSize(
+                    draco::GetTestFileFullPath("sphere_Texture0_Normal.png")) +
+                draco::GetFileSize(draco::GetTestFileFullPath(
+                    "sphere_Texture1_BaseColor.png")));
+  ASSERT_GT(stats[0].output_size, 0);
+  ASSERT_EQ(stats[2].output_size,
+            draco::GetFileSize(files[2].output_filename));
+
+  // With the tiny memory budget no two files may be in flight at the same
+  // time.
+  std::vector<const draco::DracoTranscoder::FileStats *> sorted_stats;
+  for (const auto &file_stats : stats) {
+    ASSERT_LE(file_stats.start_time_ms, file_stats.end_time_ms);
+    sorted_stats.push_back(&file_stats);
+  }
+  std::sort(sorted_stats.begin(), sorted_stats.end(),
+            [](const draco::DracoTranscoder::FileStats *a,
+               const draco::DracoTranscoder::FileStats *b) {
+              return std::make_pair(a->start_time_ms, a->end_time_ms) <
+                     std::make_pair(b->start_time_ms, b->end_time_ms);
+            });
+  for (int i = 1; i < static_cast<int>(sorted_stats.size()); ++i) {
+    ASSERT_LE(sorted_stats[i - 1]->end_time_ms, sorted_stats[i]->start_time_ms);
+  }
+
+  // Invalid number of workers.
+  batch_options.num_workers = 0;
+  ASSERT_FALSE(draco::DracoTranscoder::TranscodeBatch(options, batch_options,
+                                                      files, &stats)
+                   .ok());
+}
+
 #endif  // DRACO_TRANSCODER_SUPPORTED
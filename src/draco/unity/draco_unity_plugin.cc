@@ -35,33 +35,11 @@ T *CopyAttributeData(int num_points, const draco::PointAttribute *attr) {
   const int num_components = attr->num_components();
   T *const data = new T[num_points * num_components];
 
-  for (draco::PointIndex i(0); i < num_points; ++i) {
-    const draco::AttributeValueIndex val_index = attr->mapped_index(i);
-    bool got_data = false;
-    switch (num_components) {
-      case 1:
-        got_data = attr->ConvertValue<T, 1>(val_index,
-                                            data + i.value() * num_components);
-        break;
-      case 2:
-        got_data = attr->ConvertValue<T, 2>(val_index,
-                                            data + i.value() * num_components);
-        break;
-      case 3:
-        got_data = attr->ConvertValue<T, 3>(val_index,
-                                            data + i.value() * num_components);
-        break;
-      case 4:
-        got_data = attr->ConvertValue<T, 4>(val_index,
-                                            data + i.value() * num_components);
-        break;
-      default:
-        break;
-    }
-    if (!got_data) {
-      delete[] data;
-      return nullptr;
-    }
+  if (num_components < 1 || num_components > 4 ||
+      !attr->ConvertMappedValues<T>(draco::PointIndex(0), num_points,
+                                    num_components, data)) {
+    delete[] data;
+    return nullptr;
   }
 
   return data;
@@ -106,6 +84,20 @@ void EXPORT_API ReleaseDracoMesh(DracoMesh **mesh_ptr) {
   *mesh_ptr = nullptr;
 }
 
+void EXPORT_API ReleaseDracoVertexBuffer(DracoVertexBuffer **buffer_ptr) {
+  if (!buffer_ptr) {
+    return;
+  }
+  const DracoVertexBuffer *const buffer = *buffer_ptr;
+  if (!buffer) {
+    return;
+  }
+  delete[] buffer->vertex_data;
+  delete[] buffer->indices;
+  delete buffer;
+  *buffer_ptr = nullptr;
+}
+
 void EXPORT_API ReleaseDracoAttribute(DracoAttribute **attr_ptr) {
   if (!attr_ptr) {
     return;
@@ -186,6 +178,56 @@ int EXPORT_API DecodeDracoMesh(char *data, unsigned int length,
   return unity_mesh->num_faces;
 }
 
+int EXPORT_API DecodeDracoMeshToVertexBuffer(char *data, unsigned int length,
+                                             const DracoVertexElement *elements,
+                                             int num_elements, int stride,
+                                             DracoVertexBuffer **buffer) {
+  if (buffer == nullptr || *buffer != nullptr ||
+      (num_elements > 0 && elements == nullptr)) {
+    return -1;
+  }
+  draco::DecoderBuffer decoder_buffer;
+  decoder_buffer.Init(data, length);
+  VertexBufferLayout layout;
+  layout.stride = stride;
+  for (int i = 0; i < num_elements; ++i) {
+    VertexElement element;
+    element.attribute_type = elements[i].attribute_type;
+    element.attribute_index = elements[i].attribute_index;
+    element.data_type = elements[i].data_type;
+    element.num_components = elements[i].num_components;
+    element.normalized = elements[i].normalized;
+    element.offset = elements[i].offset;
+    layout.elements.push_back(element);
+  }
+
+  std::unique_ptr<DracoVertexBuffer> unity_buffer(new DracoVertexBuffer());
+  unity_buffer->stride = stride;
+  draco::Decoder decoder;
+  const Status status = decoder.DecodeMeshToVertexBuffer(
+      &decoder_buffer, layout,
+      [&unity_buffer, stride](int num_vertices, int num_faces,
+                              uint8_t **out_vertex_data,
+                              uint32_t **out_indices) {
+        unity_buffer->num_vertices = num_vertices;
+        unity_buffer->num_faces = num_faces;
+        unity_buffer->vertex_data =
+            new uint8_t[static_cast<size_t>(num_vertices) * stride];
+        unity_buffer->indices =
+            new uint32_t[3 * static_cast<size_t>(num_faces)];
+        *out_vertex_data = unity_buffer->vertex_data;
+        *out_indices = unity_buffer->indices;
+        return OkStatus();
+      });
+  if (!status.ok()) {
+    DracoVertexBuffer *failed_buffer = unity_buffer.release();
+    ReleaseDracoVertexBuffer(&failed_buffer);
+    return -2;
+  }
+  *buffer = unity_buffer.release();
+  return (*buffer)->num_faces;
+}
+
 bool EXPORT_API GetAttribute(const DracoMesh *mesh, int index,
                              DracoAttribute **attribute) {
   if (mesh == nullptr || attribute == nullptr || *attribute != nullptr) {
@@ -72,8 +72,46 @@ struct EXPORT_API DracoMesh {
   void *private_mesh;
 };
 
+// Struct representing an element of an interleaved vertex buffer within Unity.
+// See VertexElement.
+struct EXPORT_API DracoVertexElement {
+  DracoVertexElement()
+      : attribute_type(GeometryAttribute::INVALID),
+        attribute_index(0),
+        data_type(DT_FLOAT32),
+        num_components(0),
+        normalized(false),
+        offset(0) {}
+
+  GeometryAttribute::Type attribute_type;
+  int attribute_index;
+  DataType data_type;
+  int num_components;
+  bool normalized;
+  int offset;
+};
+
+// Struct representing the interleaved vertex buffer and the indices of a
+// decoded Draco mesh within Unity.
+struct EXPORT_API DracoVertexBuffer {
+  DracoVertexBuffer()
+      : num_faces(0),
+        num_vertices(0),
+        stride(0),
+        vertex_data(nullptr),
+        indices(nullptr) {}
+
+  int num_faces;
+  int num_vertices;
+  int stride;
+  uint8_t *vertex_data;
+  uint32_t *indices;
+};
+
 // Release data associated with DracoMesh.
 void EXPORT_API ReleaseDracoMesh(DracoMesh **mesh_ptr);
+// Release data associated with DracoVertexBuffer.
+void EXPORT_API ReleaseDracoVertexBuffer(DracoVertexBuffer **buffer_ptr);
 // Release data associated with DracoAttribute.
 void EXPORT_API ReleaseDracoAttribute(DracoAttribute **attr_ptr);
 // Release attribute data.
@@ -84,6 +122,18 @@ void EXPORT_API ReleaseDracoData(DracoData **data_ptr);
 int EXPORT_API DecodeDracoMesh(char *data, unsigned int length,
                                DracoMesh **mesh);
 
+// Decodes compressed Draco mesh in |data| directly into an interleaved vertex
+// buffer with |num_elements| |elements| and |stride| bytes per vertex and
+// returns it in |buffer|. Attribute transforms such as dequantization are
+// reverted while the vertex buffer is written so the values are not stored in
+// an intermediate mesh. On input, |buffer| must be null. The returned |buffer|
+// must be released with ReleaseDracoVertexBuffer. Returns the number of faces
+// or a negative value on error.
+int EXPORT_API DecodeDracoMeshToVertexBuffer(char *data, unsigned int length,
+                                             const DracoVertexElement *elements,
+                                             int num_elements, int stride,
+                                             DracoVertexBuffer **buffer);
+
 // Returns |attribute| at |index| in |mesh|.  On input, |attribute| must be
 // null. The returned |attribute| must be released with ReleaseDracoAttribute.
 bool EXPORT_API GetAttribute(const DracoMesh *mesh, int index,
@@ -24,20 +24,25 @@
 
 namespace {
 
-draco::DracoMesh *DecodeToDracoMesh(const std::string &file_name) {
+bool ReadTestFile(const std::string &file_name, std::vector<char> *data) {
   std::ifstream input_file(draco::GetTestFileFullPath(file_name),
                            std::ios::binary);
   if (!input_file) {
-    return nullptr;
+    return false;
   }
   // Read the file stream into a buffer.
   std::streampos file_size = 0;
   input_file.seekg(0, std::ios::end);
   file_size = input_file.tellg() - file_size;
   input_file.seekg(0, std::ios::beg);
-  std::vector<char> data(file_size);
-  input_file.read(data.data(), file_size);
-  if (data.empty()) {
+  data->resize(file_size);
+  input_file.read(data->data(), file_size);
+  return !data->empty();
+}
+
+draco::DracoMesh *DecodeToDracoMesh(const std::string &file_name) {
+  std::vector<char> data;
+  if (!ReadTestFile(file_name, &data)) {
     return nullptr;
   }
 
@@ -75,6 +80,66 @@ TEST(DracoUnityPluginTest, TestDecode) {
   draco::ReleaseDracoMesh(&draco_mesh);
 }
 
+TEST(DracoUnityPluginTest, TestDecodeToVertexBuffer) {
+  const std::string file_name = "test_nm.obj.edgebreaker.cl4.2.2.drc";
+  std::vector<char> data;
+  ASSERT_TRUE(ReadTestFile(file_name, &data));
+
+  // Store positions followed by normals as normalized signed shorts.
+  draco::DracoVertexElement elements[2];
+  elements[0].attribute_type = draco::GeometryAttribute::POSITION;
+  elements[0].data_type = draco::DT_FLOAT32;
+  elements[0].num_components = 3;
+  elements[1].attribute_type = draco::GeometryAttribute::NORMAL;
+  elements[1].data_type = draco::DT_INT16;
+  elements[1].num_components = 4;
+  elements[1].normalized = true;
+  elements[1].offset = 12;
+  draco::DracoVertexBuffer *buffer = nullptr;
+  ASSERT_EQ(draco::DecodeDracoMeshToVertexBuffer(data.data(), data.size(),
+                                                 elements, 2, 20, &buffer),
+            170);
+  ASSERT_NE(buffer, nullptr);
+  ASSERT_EQ(buffer->num_vertices, 99);
+  ASSERT_EQ(buffer->stride, 20);
+
+  // Compare the values with the attributes of the decoded mesh.
+  draco::DracoMesh *draco_mesh = DecodeToDracoMesh(file_name);
+  ASSERT_NE(draco_mesh, nullptr);
+  const draco::Mesh *const mesh =
+      static_cast<const draco::Mesh *>(draco_mesh->private_mesh);
+  for (draco::FaceIndex fi(0); fi < mesh->num_faces(); ++fi) {
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_EQ(buffer->indices[3 * fi.value() + c],
+                mesh->face(fi)[c].value());
+    }
+  }
+  const draco::PointAttribute *const pos_att =
+      mesh->GetNamedAttribute(draco::GeometryAttribute::POSITION);
+  const draco::PointAttribute *const normal_att =
+      mesh->GetNamedAttribute(draco::GeometryAttribute::NORMAL);
+  for (draco::PointIndex pi(0); pi < mesh->num_points(); ++pi) {
+    const uint8_t *const vertex =
+        buffer->vertex_data + pi.value() * buffer->stride;
+    float expected_pos[3];
+    pos_att->GetMappedValue(pi, expected_pos);
+    float pos[3];
+    memcpy(pos, vertex, sizeof(pos));
+    float expected_normal[3];
+    normal_att->GetMappedValue(pi, expected_normal);
+    int16_t normal[4];
+    memcpy(normal, vertex + 12, sizeof(normal));
+    for (int c = 0; c < 3; ++c) {
+      ASSERT_EQ(pos[c], expected_pos[c]);
+      ASSERT_NEAR(normal[c], expected_normal[c] * 32767.f, 0.5f + 1e-2f);
+    }
+    ASSERT_EQ(normal[3], 0);
+  }
+  draco::ReleaseDracoMesh(&draco_mesh);
+  draco::ReleaseDracoVertexBuffer(&buffer);
+  ASSERT_EQ(buffer, nullptr);
+}
+
 TEST(DracoUnityPluginTest, TestAttributeTypes) {
   draco::DracoMesh *draco_mesh = DecodeToDracoMesh("color_attr.drc");
   ASSERT_NE(draco_mesh, nullptr);